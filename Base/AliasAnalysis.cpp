@@ -0,0 +1,197 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "AliasAnalysis.hpp"
+#include "BaseExtension.hpp"
+#include "BaseSymbols.hpp"
+#include "BaseTypes.hpp"
+#include "Function.hpp"
+#include "Operation.hpp"
+#include "Value.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+bool
+AliasAnalysis::mayAlias(Symbol *s1, Symbol *s2) const {
+    if (s1 == s2)
+        return true;
+    if (!s1->isKind<AliasSymbol>() || !s2->isKind<AliasSymbol>())
+        return false;
+    return classesMayAlias(s1->refine<AliasSymbol>(), s2->refine<AliasSymbol>());
+}
+
+bool
+AliasAnalysis::mayRead(Operation *op, Symbol *sym) const {
+    for (int32_t s=0;s < op->numMayReadSymbols();s++) {
+        if (mayAlias(op->mayReadSymbol(s), sym))
+            return true;
+    }
+    return false;
+}
+
+bool
+AliasAnalysis::mayWrite(Operation *op, Symbol *sym) const {
+    for (int32_t s=0;s < op->numMayWriteSymbols();s++) {
+        if (mayAlias(op->mayWriteSymbol(s), sym))
+            return true;
+    }
+    return false;
+}
+
+bool
+AliasAnalysis::mayInterfere(Operation *op1, Operation *op2) const {
+    for (int32_t s=0;s < op1->numMayWriteSymbols();s++) {
+        Symbol *sym = op1->mayWriteSymbol(s);
+        if (mayRead(op2, sym) || mayWrite(op2, sym))
+            return true;
+    }
+    for (int32_t s=0;s < op2->numMayWriteSymbols();s++) {
+        if (mayRead(op1, op2->mayWriteSymbol(s)))
+            return true;
+    }
+    return false;
+}
+
+bool
+AliasAnalysis::pointersMayAlias(Value *p1, Value *p2) const {
+    const Type *t1 = p1->type();
+    const Type *t2 = p2->type();
+    if (t1->isKind<PointerType>() && t2->isKind<PointerType>()) {
+        const Type *base1 = t1->refine<PointerType>()->baseType();
+        const Type *base2 = t2->refine<PointerType>()->baseType();
+        if (!typesMayAlias(base1, base2))
+            return false;
+    }
+
+    Value *root1 = rootPointer(p1);
+    Value *root2 = rootPointer(p2);
+    if (root1 == root2)
+        return true;
+
+    Symbol *sym1 = rootSymbol(root1);
+    if (sym1 != NULL && sym1 == rootSymbol(root2))
+        return true;
+
+    return !isNoAlias(root1) && !isNoAlias(root2);
+}
+
+Value *
+AliasAnalysis::rootPointer(Value *p) const {
+    const Operation *def = p->definition();
+    while (def != NULL && def->action() == _base->aIndexAt) {
+        p = def->operand(0);
+        def = p->definition();
+    }
+    return p;
+}
+
+Symbol *
+AliasAnalysis::rootSymbol(Value *root) const {
+    const Operation *def = root->definition();
+    if (def != NULL && def->action() == _base->aLoad)
+        return def->symbol();
+    return NULL;
+}
+
+bool
+AliasAnalysis::isNoAlias(Value *root) const {
+    if (_func != NULL && _func->assumesNoAlias(root))
+        return true;
+
+    Symbol *sym = rootSymbol(root);
+    return sym != NULL && sym->isKind<ParameterSymbol>() && sym->refine<ParameterSymbol>()->isNoAlias();
+}
+
+bool
+AliasAnalysis::classesMayAlias(AliasSymbol *a1, AliasSymbol *a2) const {
+    if (a1->isAnyMemory() || a2->isAnyMemory())
+        return true;
+
+    const FieldType *f1 = a1->fieldType();
+    const FieldType *f2 = a2->fieldType();
+    if (f1 != NULL && f2 != NULL) {
+        if (f1 == f2)
+            return true;
+        if (f1->owningStruct() != f2->owningStruct())
+            return false;
+        // fields of the same struct overlap if their bits do (e.g. all the fields of a union)
+        return f1->offset() < f2->offset() + f2->type()->size()
+            && f2->offset() < f1->offset() + f1->type()->size();
+    }
+
+    if (f1 != NULL)
+        return fieldMayAlias(f1, a2->accessType());
+    if (f2 != NULL)
+        return fieldMayAlias(f2, a1->accessType());
+
+    return typesMayAlias(a1->accessType(), a2->accessType());
+}
+
+// a field overlaps accesses of its own type and accesses of whole structs that contain it
+bool
+AliasAnalysis::fieldMayAlias(const FieldType *field, const Type *type) const {
+    const Type *owningStruct = field->owningStruct();
+    return typesMayAlias(field->type(), type) || type == owningStruct || containsType(type, owningStruct);
+}
+
+bool
+AliasAnalysis::typesMayAlias(const Type *t1, const Type *t2) const {
+    t1 = aliasType(t1);
+    t2 = aliasType(t2);
+    if (t1 == t2)
+        return true;
+
+    // byte accesses can reach any part of any object
+    if (t1 == _base->Int8 || t2 == _base->Int8)
+        return true;
+
+    return containsType(t1, t2) || containsType(t2, t1);
+}
+
+// true if type is the type of some (possibly nested) field of structType
+bool
+AliasAnalysis::containsType(const Type *structType, const Type *type) const {
+    if (!structType->isKind<StructType>())
+        return false;
+
+    type = aliasType(type);
+    const StructType *st = structType->refine<StructType>();
+    for (auto it = st->FieldsBegin(); it != st->FieldsEnd(); it++) {
+        const Type *fieldType = aliasType(it->second->type());
+        if (fieldType == type || containsType(fieldType, type))
+            return true;
+    }
+    return false;
+}
+
+const Type *
+AliasAnalysis::aliasType(const Type *type) const {
+    if (type->isKind<PointerType>())
+        return _base->Address;
+    return type;
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
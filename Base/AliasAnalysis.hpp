@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#ifndef ALIASANALYSIS_INCL
+#define ALIASANALYSIS_INCL
+
+#include <stddef.h>
+
+namespace OMR {
+namespace JitBuilder {
+
+class Operation;
+class Symbol;
+class Type;
+class Value;
+
+namespace Base {
+
+class AliasSymbol;
+class BaseExtension;
+class FieldType;
+class Function;
+
+// AliasAnalysis answers whether two Symbols may name overlapping storage, and so whether two
+// Operations may interfere through memory, using each Operation's may read and may write sets
+// (see Operation::mayReadSymbol() and mayWriteSymbol()). LocalSymbols are never addressable, so
+// each only aliases itself. Memory reached through pointers is partitioned into AliasSymbol
+// classes by type (type based alias analysis): accesses of different types do not overlap except
+// that Int8 accesses may overlap anything, all pointer types share one class, and a StructType
+// overlaps the types of its fields. Fields of a struct overlap each other only if their offsets
+// and sizes do (as all the fields of a union do), and a field overlaps accesses of its own type
+// and of any StructType that contains it. AnyMemory (e.g. the
+// memory a Call may touch) overlaps every class.
+//
+// pointersMayAlias() also uses what func knows about pointer Values: two pointers derived (by
+// IndexAt) from different roots do not alias if either root is a noAlias ParameterSymbol (loaded
+// by a Load) or a Value the Function assumesNoAlias().
+class AliasAnalysis {
+public:
+    AliasAnalysis(BaseExtension *base, Function *func=NULL)
+        : _base(base)
+        , _func(func) {
+
+    }
+
+    bool mayAlias(Symbol *s1, Symbol *s2) const;
+
+    // true if op may read or write storage that overlaps sym
+    bool mayRead(Operation *op, Symbol *sym) const;
+    bool mayWrite(Operation *op, Symbol *sym) const;
+
+    // true if op1 and op2 may access overlapping storage and at least one of them writes it,
+    // in which case they cannot be reordered
+    bool mayInterfere(Operation *op1, Operation *op2) const;
+
+    // true if the objects p1 and p2 point into may overlap
+    bool pointersMayAlias(Value *p1, Value *p2) const;
+
+    // the Value p is derived from by IndexAt, and the Symbol that Value was loaded from (or NULL)
+    Value *rootPointer(Value *p) const;
+    Symbol *rootSymbol(Value *root) const;
+
+protected:
+    bool classesMayAlias(AliasSymbol *a1, AliasSymbol *a2) const;
+    bool fieldMayAlias(const FieldType *field, const Type *type) const;
+    bool typesMayAlias(const Type *t1, const Type *t2) const;
+    bool containsType(const Type *structType, const Type *type) const;
+    const Type *aliasType(const Type *type) const;
+    bool isNoAlias(Value *root) const;
+
+    BaseExtension *_base;
+    Function *_func;
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(ALIASANALYSIS_INCL)
+
@@ -39,6 +39,25 @@ namespace OMR {
 namespace JitBuilder {
 namespace Base {
 
+//
+// Abs
+//
+Op_Abs::Op_Abs(LOCATION, Extension *ext, Builder * parent, ActionID aAbs, Value *result, Value *value)
+    : OperationR1V1(PASSLOC, aAbs, ext, parent, result, value) {
+
+}
+
+Operation *
+Op_Abs::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_Abs(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0));
+}
+
+void
+Op_Abs::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->Abs(location(), this->parent(), this->_result, this->_value);
+}
+
+
 //
 // Add
 //
@@ -58,6 +77,63 @@ Op_Add::jbgen(JB1MethodBuilder *j1mb) const {
 }
 
 
+//
+// AddWithOverflow
+//
+Op_AddWithOverflow::Op_AddWithOverflow(LOCATION, Extension *ext, Builder * parent, ActionID aAddWithOverflow, Value *result, Builder *overflowTarget, Value *left, Value *right)
+    : OperationB1R1V2(PASSLOC, aAddWithOverflow, ext, parent, result, overflowTarget, left, right) {
+
+}
+
+Operation *
+Op_AddWithOverflow::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_AddWithOverflow(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->builder(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_AddWithOverflow::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->AddWithOverflow(location(), this->parent(), this->_result, this->_builder, this->_left, this->_right);
+}
+
+
+//
+// And
+//
+Op_And::Op_And(LOCATION, Extension *ext, Builder * parent, ActionID aAnd, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aAnd, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_And::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_And(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_And::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->And(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// Ceil
+//
+Op_Ceil::Op_Ceil(LOCATION, Extension *ext, Builder * parent, ActionID aCeil, Value *result, Value *value)
+    : OperationR1V1(PASSLOC, aCeil, ext, parent, result, value) {
+
+}
+
+Operation *
+Op_Ceil::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_Ceil(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0));
+}
+
+void
+Op_Ceil::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->Ceil(location(), this->parent(), this->_result, this->_value);
+}
+
+
 //
 // ConvertTo
 //
@@ -77,6 +153,196 @@ Op_ConvertTo::jbgen(JB1MethodBuilder *j1mb) const {
 }
 
 
+//
+// CopySign
+//
+Op_CopySign::Op_CopySign(LOCATION, Extension *ext, Builder * parent, ActionID aCopySign, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aCopySign, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_CopySign::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_CopySign(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_CopySign::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->CopySign(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// CountLeadingZeros
+//
+Op_CountLeadingZeros::Op_CountLeadingZeros(LOCATION, Extension *ext, Builder * parent, ActionID aCountLeadingZeros, Value *result, Value *value)
+    : OperationR1V1(PASSLOC, aCountLeadingZeros, ext, parent, result, value) {
+
+}
+
+Operation *
+Op_CountLeadingZeros::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_CountLeadingZeros(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0));
+}
+
+void
+Op_CountLeadingZeros::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->CountLeadingZeros(location(), this->parent(), this->_result, this->_value);
+}
+
+
+//
+// CountTrailingZeros
+//
+Op_CountTrailingZeros::Op_CountTrailingZeros(LOCATION, Extension *ext, Builder * parent, ActionID aCountTrailingZeros, Value *result, Value *value)
+    : OperationR1V1(PASSLOC, aCountTrailingZeros, ext, parent, result, value) {
+
+}
+
+Operation *
+Op_CountTrailingZeros::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_CountTrailingZeros(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0));
+}
+
+void
+Op_CountTrailingZeros::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->CountTrailingZeros(location(), this->parent(), this->_result, this->_value);
+}
+
+
+//
+// Div
+//
+Op_Div::Op_Div(LOCATION, Extension *ext, Builder * parent, ActionID aDiv, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aDiv, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_Div::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_Div(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_Div::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->Div(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// FMA
+//
+Op_FMA::Op_FMA(LOCATION, Extension *ext, Builder * parent, ActionID aFMA, Value *result, Value *left, Value *right, Value *addend)
+    : OperationR1V3(PASSLOC, aFMA, ext, parent, result, left, right, addend) {
+
+}
+
+Operation *
+Op_FMA::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_FMA(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1), cloner->operand(2));
+}
+
+void
+Op_FMA::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->FMA(location(), this->parent(), this->_result, this->_first, this->_second, this->_third);
+}
+
+
+//
+// FMS
+//
+Op_FMS::Op_FMS(LOCATION, Extension *ext, Builder * parent, ActionID aFMS, Value *result, Value *left, Value *right, Value *subtrahend)
+    : OperationR1V3(PASSLOC, aFMS, ext, parent, result, left, right, subtrahend) {
+
+}
+
+Operation *
+Op_FMS::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_FMS(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1), cloner->operand(2));
+}
+
+void
+Op_FMS::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->FMS(location(), this->parent(), this->_result, this->_first, this->_second, this->_third);
+}
+
+
+//
+// FNMA
+//
+Op_FNMA::Op_FNMA(LOCATION, Extension *ext, Builder * parent, ActionID aFNMA, Value *result, Value *left, Value *right, Value *minuend)
+    : OperationR1V3(PASSLOC, aFNMA, ext, parent, result, left, right, minuend) {
+
+}
+
+Operation *
+Op_FNMA::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_FNMA(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1), cloner->operand(2));
+}
+
+void
+Op_FNMA::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->FNMA(location(), this->parent(), this->_result, this->_first, this->_second, this->_third);
+}
+
+
+//
+// Floor
+//
+Op_Floor::Op_Floor(LOCATION, Extension *ext, Builder * parent, ActionID aFloor, Value *result, Value *value)
+    : OperationR1V1(PASSLOC, aFloor, ext, parent, result, value) {
+
+}
+
+Operation *
+Op_Floor::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_Floor(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0));
+}
+
+void
+Op_Floor::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->Floor(location(), this->parent(), this->_result, this->_value);
+}
+
+
+//
+// Max
+//
+Op_Max::Op_Max(LOCATION, Extension *ext, Builder * parent, ActionID aMax, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aMax, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_Max::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_Max(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_Max::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->Max(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// Min
+//
+Op_Min::Op_Min(LOCATION, Extension *ext, Builder * parent, ActionID aMin, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aMin, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_Min::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_Min(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_Min::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->Min(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
 //
 // Mul
 //
@@ -96,6 +362,215 @@ Op_Mul::jbgen(JB1MethodBuilder *j1mb) const {
 }
 
 
+//
+// MulWithOverflow
+//
+Op_MulWithOverflow::Op_MulWithOverflow(LOCATION, Extension *ext, Builder * parent, ActionID aMulWithOverflow, Value *result, Builder *overflowTarget, Value *left, Value *right)
+    : OperationB1R1V2(PASSLOC, aMulWithOverflow, ext, parent, result, overflowTarget, left, right) {
+
+}
+
+Operation *
+Op_MulWithOverflow::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_MulWithOverflow(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->builder(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_MulWithOverflow::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->MulWithOverflow(location(), this->parent(), this->_result, this->_builder, this->_left, this->_right);
+}
+
+
+//
+// MulHigh
+//
+Op_MulHigh::Op_MulHigh(LOCATION, Extension *ext, Builder * parent, ActionID aMulHigh, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aMulHigh, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_MulHigh::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_MulHigh(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_MulHigh::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->MulHigh(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// Not
+//
+Op_Not::Op_Not(LOCATION, Extension *ext, Builder * parent, ActionID aNot, Value *result, Value *value)
+    : OperationR1V1(PASSLOC, aNot, ext, parent, result, value) {
+
+}
+
+Operation *
+Op_Not::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_Not(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0));
+}
+
+void
+Op_Not::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->Not(location(), this->parent(), this->_result, this->_value);
+}
+
+
+//
+// Or
+//
+Op_Or::Op_Or(LOCATION, Extension *ext, Builder * parent, ActionID aOr, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aOr, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_Or::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_Or(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_Or::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->Or(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// PopCount
+//
+Op_PopCount::Op_PopCount(LOCATION, Extension *ext, Builder * parent, ActionID aPopCount, Value *result, Value *value)
+    : OperationR1V1(PASSLOC, aPopCount, ext, parent, result, value) {
+
+}
+
+Operation *
+Op_PopCount::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_PopCount(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0));
+}
+
+void
+Op_PopCount::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->PopCount(location(), this->parent(), this->_result, this->_value);
+}
+
+
+//
+// Rem
+//
+Op_Rem::Op_Rem(LOCATION, Extension *ext, Builder * parent, ActionID aRem, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aRem, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_Rem::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_Rem(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_Rem::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->Rem(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// RotateL
+//
+Op_RotateL::Op_RotateL(LOCATION, Extension *ext, Builder * parent, ActionID aRotateL, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aRotateL, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_RotateL::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_RotateL(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_RotateL::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->RotateL(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// RotateR
+//
+Op_RotateR::Op_RotateR(LOCATION, Extension *ext, Builder * parent, ActionID aRotateR, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aRotateR, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_RotateR::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_RotateR(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_RotateR::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->RotateR(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// ShiftL
+//
+Op_ShiftL::Op_ShiftL(LOCATION, Extension *ext, Builder * parent, ActionID aShiftL, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aShiftL, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_ShiftL::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_ShiftL(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_ShiftL::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->ShiftL(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// ShiftR
+//
+Op_ShiftR::Op_ShiftR(LOCATION, Extension *ext, Builder * parent, ActionID aShiftR, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aShiftR, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_ShiftR::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_ShiftR(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_ShiftR::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->ShiftR(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// Sqrt
+//
+Op_Sqrt::Op_Sqrt(LOCATION, Extension *ext, Builder * parent, ActionID aSqrt, Value *result, Value *value)
+    : OperationR1V1(PASSLOC, aSqrt, ext, parent, result, value) {
+
+}
+
+Operation *
+Op_Sqrt::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_Sqrt(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0));
+}
+
+void
+Op_Sqrt::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->Sqrt(location(), this->parent(), this->_result, this->_value);
+}
+
+
 //
 // Sub
 //
@@ -117,6 +592,120 @@ Op_Sub::jbgen(JB1MethodBuilder *j1mb) const {
 
 ///////////////////////////////////////////////////////////////////////////////////
 #if 0
+//
+// SubWithOverflow
+//
+Op_SubWithOverflow::Op_SubWithOverflow(LOCATION, Extension *ext, Builder * parent, ActionID aSubWithOverflow, Value *result, Builder *overflowTarget, Value *left, Value *right)
+    : OperationB1R1V2(PASSLOC, aSubWithOverflow, ext, parent, result, overflowTarget, left, right) {
+
+}
+
+Operation *
+Op_SubWithOverflow::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_SubWithOverflow(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->builder(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_SubWithOverflow::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->SubWithOverflow(location(), this->parent(), this->_result, this->_builder, this->_left, this->_right);
+}
+
+
+//
+// UnsignedDiv
+//
+Op_UnsignedDiv::Op_UnsignedDiv(LOCATION, Extension *ext, Builder * parent, ActionID aUnsignedDiv, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aUnsignedDiv, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_UnsignedDiv::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_UnsignedDiv(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_UnsignedDiv::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->UnsignedDiv(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// UnsignedMulHigh
+//
+Op_UnsignedMulHigh::Op_UnsignedMulHigh(LOCATION, Extension *ext, Builder * parent, ActionID aUnsignedMulHigh, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aUnsignedMulHigh, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_UnsignedMulHigh::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_UnsignedMulHigh(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_UnsignedMulHigh::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->UnsignedMulHigh(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// UnsignedRem
+//
+Op_UnsignedRem::Op_UnsignedRem(LOCATION, Extension *ext, Builder * parent, ActionID aUnsignedRem, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aUnsignedRem, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_UnsignedRem::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_UnsignedRem(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_UnsignedRem::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->UnsignedRem(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// UnsignedShiftR
+//
+Op_UnsignedShiftR::Op_UnsignedShiftR(LOCATION, Extension *ext, Builder * parent, ActionID aUnsignedShiftR, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aUnsignedShiftR, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_UnsignedShiftR::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_UnsignedShiftR(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_UnsignedShiftR::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->UnsignedShiftR(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// Xor
+//
+Op_Xor::Op_Xor(LOCATION, Extension *ext, Builder * parent, ActionID aXor, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aXor, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_Xor::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_Xor(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_Xor::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->Xor(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
 // keep these here so they're handy during the migration
 void
 Add::cloneTo(Builder *b, ValueMapper **resultMappers, ValueMapper **operandMappers, TypeMapper **typeMappers, LiteralMapper **literalMappers, SymbolMapper **symbolMappers, BuilderMapper **builderMappers) const
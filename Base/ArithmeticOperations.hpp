@@ -29,6 +29,17 @@ namespace OMR {
 namespace JitBuilder {
 namespace Base {
 
+// |value|; the most negative integer is its own absolute value
+class Op_Abs : public OperationR1V1 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_Abs(LOCATION, Extension *ext, Builder * parent, ActionID aAbs, Value *result, Value *value);
+    };
+
 class Op_Add : public OperationR1V2 {
     friend class BaseExtension;
 public:
@@ -39,6 +50,39 @@ protected:
     Op_Add(LOCATION, Extension *ext, Builder * parent, ActionID aAdd, Value *result, Value *left, Value *right);
     };
 
+// left + right, branching to overflowTarget instead if the signed result overflows
+class Op_AddWithOverflow : public OperationB1R1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_AddWithOverflow(LOCATION, Extension *ext, Builder * parent, ActionID aAddWithOverflow, Value *result, Builder *overflowTarget, Value *left, Value *right);
+    };
+
+// left & right
+class Op_And : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_And(LOCATION, Extension *ext, Builder * parent, ActionID aAnd, Value *result, Value *left, Value *right);
+    };
+
+// the smallest integral value not less than value
+class Op_Ceil : public OperationR1V1 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_Ceil(LOCATION, Extension *ext, Builder * parent, ActionID aCeil, Value *result, Value *value);
+    };
+
 class Op_ConvertTo : public OperationR1V1T1 {
     friend class BaseExtension;
 public:
@@ -49,6 +93,116 @@ protected:
     Op_ConvertTo(LOCATION, Extension *ext, Builder * parent, ActionID aConvertTo, Value *result, const Type *type, Value *value);
     };
 
+// a value with the magnitude of left and the sign of right
+class Op_CopySign : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_CopySign(LOCATION, Extension *ext, Builder * parent, ActionID aCopySign, Value *result, Value *left, Value *right);
+    };
+
+// the number of zero bits above the highest one bit of value (an Int32)
+class Op_CountLeadingZeros : public OperationR1V1 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_CountLeadingZeros(LOCATION, Extension *ext, Builder * parent, ActionID aCountLeadingZeros, Value *result, Value *value);
+    };
+
+// the number of zero bits below the lowest one bit of value (an Int32)
+class Op_CountTrailingZeros : public OperationR1V1 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_CountTrailingZeros(LOCATION, Extension *ext, Builder * parent, ActionID aCountTrailingZeros, Value *result, Value *value);
+    };
+
+// left / right; integer division truncates toward zero
+class Op_Div : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_Div(LOCATION, Extension *ext, Builder * parent, ActionID aDiv, Value *result, Value *left, Value *right);
+    };
+
+// left * right + addend, rounded once
+class Op_FMA : public OperationR1V3 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_FMA(LOCATION, Extension *ext, Builder * parent, ActionID aFMA, Value *result, Value *left, Value *right, Value *addend);
+    };
+
+// left * right - subtrahend, rounded once
+class Op_FMS : public OperationR1V3 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_FMS(LOCATION, Extension *ext, Builder * parent, ActionID aFMS, Value *result, Value *left, Value *right, Value *subtrahend);
+    };
+
+// minuend - left * right, rounded once
+class Op_FNMA : public OperationR1V3 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_FNMA(LOCATION, Extension *ext, Builder * parent, ActionID aFNMA, Value *result, Value *left, Value *right, Value *minuend);
+    };
+
+// the largest integral value not greater than value
+class Op_Floor : public OperationR1V1 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_Floor(LOCATION, Extension *ext, Builder * parent, ActionID aFloor, Value *result, Value *value);
+    };
+
+// the larger of left and right (left if they are unordered)
+class Op_Max : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_Max(LOCATION, Extension *ext, Builder * parent, ActionID aMax, Value *result, Value *left, Value *right);
+    };
+
+// the smaller of left and right (left if they are unordered)
+class Op_Min : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_Min(LOCATION, Extension *ext, Builder * parent, ActionID aMin, Value *result, Value *left, Value *right);
+    };
+
 class Op_Mul : public OperationR1V2 {
     friend class BaseExtension;
 public:
@@ -59,6 +213,127 @@ protected:
     Op_Mul(LOCATION, Extension *ext, Builder * parent, ActionID aMul, Value *result, Value *left, Value *right);
     };
 
+// left * right, branching to overflowTarget instead if the signed result overflows
+class Op_MulWithOverflow : public OperationB1R1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_MulWithOverflow(LOCATION, Extension *ext, Builder * parent, ActionID aMulWithOverflow, Value *result, Builder *overflowTarget, Value *left, Value *right);
+    };
+
+// the high half of the double width product of left and right
+class Op_MulHigh : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_MulHigh(LOCATION, Extension *ext, Builder * parent, ActionID aMulHigh, Value *result, Value *left, Value *right);
+    };
+
+// ~value
+class Op_Not : public OperationR1V1 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_Not(LOCATION, Extension *ext, Builder * parent, ActionID aNot, Value *result, Value *value);
+    };
+
+// left | right
+class Op_Or : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_Or(LOCATION, Extension *ext, Builder * parent, ActionID aOr, Value *result, Value *left, Value *right);
+    };
+
+// the number of one bits in value (an Int32)
+class Op_PopCount : public OperationR1V1 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_PopCount(LOCATION, Extension *ext, Builder * parent, ActionID aPopCount, Value *result, Value *value);
+    };
+
+// left % right; the result has the sign of left
+class Op_Rem : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_Rem(LOCATION, Extension *ext, Builder * parent, ActionID aRem, Value *result, Value *left, Value *right);
+    };
+
+// left rotated left by right bits (modulo the number of bits in left)
+class Op_RotateL : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_RotateL(LOCATION, Extension *ext, Builder * parent, ActionID aRotateL, Value *result, Value *left, Value *right);
+    };
+
+// left rotated right by right bits (modulo the number of bits in left)
+class Op_RotateR : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_RotateR(LOCATION, Extension *ext, Builder * parent, ActionID aRotateR, Value *result, Value *left, Value *right);
+    };
+
+// left shifted left by right bits, filling with zeroes
+class Op_ShiftL : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_ShiftL(LOCATION, Extension *ext, Builder * parent, ActionID aShiftL, Value *result, Value *left, Value *right);
+    };
+
+// left shifted right by right bits, filling with copies of the sign bit
+class Op_ShiftR : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_ShiftR(LOCATION, Extension *ext, Builder * parent, ActionID aShiftR, Value *result, Value *left, Value *right);
+    };
+
+// the square root of value, correctly rounded
+class Op_Sqrt : public OperationR1V1 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_Sqrt(LOCATION, Extension *ext, Builder * parent, ActionID aSqrt, Value *result, Value *value);
+    };
+
 class Op_Sub : public OperationR1V2 {
     friend class BaseExtension;
 public:
@@ -69,6 +344,72 @@ protected:
     Op_Sub(LOCATION, Extension *ext, Builder * parent, ActionID aSub, Value *result, Value *left, Value *right);
     };
 
+// left - right, branching to overflowTarget instead if the signed result overflows
+class Op_SubWithOverflow : public OperationB1R1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_SubWithOverflow(LOCATION, Extension *ext, Builder * parent, ActionID aSubWithOverflow, Value *result, Builder *overflowTarget, Value *left, Value *right);
+    };
+
+// left / right, treating both as unsigned integers
+class Op_UnsignedDiv : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_UnsignedDiv(LOCATION, Extension *ext, Builder * parent, ActionID aUnsignedDiv, Value *result, Value *left, Value *right);
+    };
+
+// the high half of the double width product of left and right, treating both as unsigned integers
+class Op_UnsignedMulHigh : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_UnsignedMulHigh(LOCATION, Extension *ext, Builder * parent, ActionID aUnsignedMulHigh, Value *result, Value *left, Value *right);
+    };
+
+// left % right, treating both as unsigned integers
+class Op_UnsignedRem : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_UnsignedRem(LOCATION, Extension *ext, Builder * parent, ActionID aUnsignedRem, Value *result, Value *left, Value *right);
+    };
+
+// left shifted right by right bits, filling with zeroes
+class Op_UnsignedShiftR : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_UnsignedShiftR(LOCATION, Extension *ext, Builder * parent, ActionID aUnsignedShiftR, Value *result, Value *left, Value *right);
+    };
+
+// left ^ right
+class Op_Xor : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_Xor(LOCATION, Extension *ext, Builder * parent, ActionID aXor, Value *result, Value *left, Value *right);
+    };
+
 } // namespace Base
 } // namespace JitBuilder
 } // namespace OMR
@@ -22,17 +22,37 @@
 #ifndef OMR_JITBUILDER_Base_INCL
 #define OMR_JITBUILDER_Base_INCL
 
+#include "Base/AliasAnalysis.hpp"
 #include "Base/ArithmeticOperations.hpp"
 #include "Base/BaseExtension.hpp"
 #include "Base/BaseIterator.hpp"
 #include "Base/BaseSymbols.hpp"
 #include "Base/BaseTypes.hpp"
+#include "Base/ColdBuilderLayout.hpp"
+#include "Base/CompareOperations.hpp"
 #include "Base/ConstOperations.hpp"
+#include "Base/ConstantFolding.hpp"
 #include "Base/ControlOperations.hpp"
+#include "Base/DivisionByConstant.hpp"
+#include "Base/EscapeAnalysis.hpp"
+#include "Base/FMAContraction.hpp"
 #include "Base/Function.hpp"
 #include "Base/FunctionCompilation.hpp"
+#include "Base/FunctionProfile.hpp"
+#include "Base/IfConversion.hpp"
+#include "Base/Inliner.hpp"
+#include "Base/LocalForwarding.hpp"
+#include "Base/LoopNestOptimizer.hpp"
+#include "Base/LoopUnroller.hpp"
 #include "Base/MemoryOperations.hpp"
 #include "Base/NativeCallableContext.hpp"
+#include "Base/Outliner.hpp"
+#include "Base/ProfileFeedback.hpp"
+#include "Base/ProfileInstrumentation.hpp"
+#include "Base/SSAConstruction.hpp"
+#include "Base/SSADestruction.hpp"
+#include "Base/ScalarReplacement.hpp"
+#include "Base/StrengthReduction.hpp"
 
 #endif // defined(OMR_JITBUILDER_Base_INCL)
 
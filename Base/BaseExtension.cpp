@@ -20,12 +20,14 @@
  *******************************************************************************/
 
 #include <cstdarg>
+#include <set>
 
 #include "ArithmeticOperations.hpp"
 #include "BaseExtension.hpp"
 #include "BaseSymbols.hpp"
 #include "BaseTypes.hpp"
 #include "Builder.hpp"
+#include "CompareOperations.hpp"
 #include "ConstOperations.hpp"
 #include "ControlOperations.hpp"
 #include "Compilation.hpp"
@@ -65,10 +67,52 @@ BaseExtension::BaseExtension(Compiler *compiler, bool extended, std::string exte
     , Address(new AddressType(LOC, this))
     , Word(compiler->platformWordSize() == 64 ? this->Int64->refine<Type>() : this->Int32->refine<Type>())
     , aConst(registerAction(std::string("Const")))
+    , aAbs(registerAction(std::string("Abs")))
     , aAdd(registerAction(std::string("Add")))
+    , aAddWithOverflow(registerAction(std::string("AddWithOverflow")))
+    , aAnd(registerAction(std::string("And")))
+    , aCeil(registerAction(std::string("Ceil")))
     , aConvertTo(registerAction(std::string("ConvertTo")))
+    , aCopySign(registerAction(std::string("CopySign")))
+    , aCountLeadingZeros(registerAction(std::string("CountLeadingZeros")))
+    , aCountTrailingZeros(registerAction(std::string("CountTrailingZeros")))
+    , aDiv(registerAction(std::string("Div")))
+    , aFMA(registerAction(std::string("FMA")))
+    , aFMS(registerAction(std::string("FMS")))
+    , aFNMA(registerAction(std::string("FNMA")))
+    , aFloor(registerAction(std::string("Floor")))
+    , aMax(registerAction(std::string("Max")))
+    , aMin(registerAction(std::string("Min")))
     , aMul(registerAction(std::string("Mul")))
+    , aMulHigh(registerAction(std::string("MulHigh")))
+    , aMulWithOverflow(registerAction(std::string("MulWithOverflow")))
+    , aNot(registerAction(std::string("Not")))
+    , aOr(registerAction(std::string("Or")))
+    , aPopCount(registerAction(std::string("PopCount")))
+    , aRem(registerAction(std::string("Rem")))
+    , aRotateL(registerAction(std::string("RotateL")))
+    , aRotateR(registerAction(std::string("RotateR")))
+    , aShiftL(registerAction(std::string("ShiftL")))
+    , aShiftR(registerAction(std::string("ShiftR")))
+    , aSqrt(registerAction(std::string("Sqrt")))
     , aSub(registerAction(std::string("Sub")))
+    , aSubWithOverflow(registerAction(std::string("SubWithOverflow")))
+    , aUnsignedDiv(registerAction(std::string("UnsignedDiv")))
+    , aUnsignedMulHigh(registerAction(std::string("UnsignedMulHigh")))
+    , aUnsignedRem(registerAction(std::string("UnsignedRem")))
+    , aUnsignedShiftR(registerAction(std::string("UnsignedShiftR")))
+    , aXor(registerAction(std::string("Xor")))
+    , aEqualTo(registerAction(std::string("EqualTo")))
+    , aGreaterOrEqualTo(registerAction(std::string("GreaterOrEqualTo")))
+    , aGreaterThan(registerAction(std::string("GreaterThan")))
+    , aLessOrEqualTo(registerAction(std::string("LessOrEqualTo")))
+    , aLessThan(registerAction(std::string("LessThan")))
+    , aNotEqualTo(registerAction(std::string("NotEqualTo")))
+    , aSelect(registerAction(std::string("Select")))
+    , aUnsignedGreaterOrEqualTo(registerAction(std::string("UnsignedGreaterOrEqualTo")))
+    , aUnsignedGreaterThan(registerAction(std::string("UnsignedGreaterThan")))
+    , aUnsignedLessOrEqualTo(registerAction(std::string("UnsignedLessOrEqualTo")))
+    , aUnsignedLessThan(registerAction(std::string("UnsignedLessThan")))
     , aLoad(registerAction(std::string("Load")))
     , aStore(registerAction(std::string("Store")))
     , aLoadAt(registerAction(std::string("LoadAt")))
@@ -96,10 +140,53 @@ BaseExtension::BaseExtension(Compiler *compiler, bool extended, std::string exte
     , aIfCmpUnsignedLessThan(registerAction(std::string("IfCmpUnsignedLessThan")))
     , aIfCmpUnsignedLessOrEqual(registerAction(std::string("IfCmpUnsignedLessOrEqual")))
     , aReturn(registerAction(std::string("Return")))
+    , aSwitch(registerAction(std::string("Switch")))
+    , CompileFail_BadInputTypes_Abs(registerReturnCode("CompileFail_BadInputTypes_Abs"))
     , CompileFail_BadInputTypes_Add(registerReturnCode("CompileFail_BadInputTypes_Add"))
+    , CompileFail_BadInputTypes_AddWithOverflow(registerReturnCode("CompileFail_BadInputTypes_AddWithOverflow"))
+    , CompileFail_BadInputTypes_And(registerReturnCode("CompileFail_BadInputTypes_And"))
+    , CompileFail_BadInputTypes_Ceil(registerReturnCode("CompileFail_BadInputTypes_Ceil"))
     , CompileFail_BadInputTypes_ConvertTo(registerReturnCode("CompileFail_BadInputTypes_ConvertTo"))
+    , CompileFail_BadInputTypes_CopySign(registerReturnCode("CompileFail_BadInputTypes_CopySign"))
+    , CompileFail_BadInputTypes_CountLeadingZeros(registerReturnCode("CompileFail_BadInputTypes_CountLeadingZeros"))
+    , CompileFail_BadInputTypes_CountTrailingZeros(registerReturnCode("CompileFail_BadInputTypes_CountTrailingZeros"))
+    , CompileFail_BadInputTypes_Div(registerReturnCode("CompileFail_BadInputTypes_Div"))
+    , CompileFail_BadInputTypes_FMA(registerReturnCode("CompileFail_BadInputTypes_FMA"))
+    , CompileFail_BadInputTypes_FMS(registerReturnCode("CompileFail_BadInputTypes_FMS"))
+    , CompileFail_BadInputTypes_FNMA(registerReturnCode("CompileFail_BadInputTypes_FNMA"))
+    , CompileFail_BadInputTypes_Floor(registerReturnCode("CompileFail_BadInputTypes_Floor"))
+    , CompileFail_BadInputTypes_Max(registerReturnCode("CompileFail_BadInputTypes_Max"))
+    , CompileFail_BadInputTypes_Min(registerReturnCode("CompileFail_BadInputTypes_Min"))
     , CompileFail_BadInputTypes_Mul(registerReturnCode("CompileFail_BadInputTypes_Mul"))
+    , CompileFail_BadInputTypes_MulHigh(registerReturnCode("CompileFail_BadInputTypes_MulHigh"))
+    , CompileFail_BadInputTypes_MulWithOverflow(registerReturnCode("CompileFail_BadInputTypes_MulWithOverflow"))
+    , CompileFail_BadInputTypes_Not(registerReturnCode("CompileFail_BadInputTypes_Not"))
+    , CompileFail_BadInputTypes_Or(registerReturnCode("CompileFail_BadInputTypes_Or"))
+    , CompileFail_BadInputTypes_PopCount(registerReturnCode("CompileFail_BadInputTypes_PopCount"))
+    , CompileFail_BadInputTypes_Rem(registerReturnCode("CompileFail_BadInputTypes_Rem"))
+    , CompileFail_BadInputTypes_RotateL(registerReturnCode("CompileFail_BadInputTypes_RotateL"))
+    , CompileFail_BadInputTypes_RotateR(registerReturnCode("CompileFail_BadInputTypes_RotateR"))
+    , CompileFail_BadInputTypes_ShiftL(registerReturnCode("CompileFail_BadInputTypes_ShiftL"))
+    , CompileFail_BadInputTypes_ShiftR(registerReturnCode("CompileFail_BadInputTypes_ShiftR"))
+    , CompileFail_BadInputTypes_Sqrt(registerReturnCode("CompileFail_BadInputTypes_Sqrt"))
     , CompileFail_BadInputTypes_Sub(registerReturnCode("CompileFail_BadInputTypes_Sub"))
+    , CompileFail_BadInputTypes_SubWithOverflow(registerReturnCode("CompileFail_BadInputTypes_SubWithOverflow"))
+    , CompileFail_BadInputTypes_UnsignedDiv(registerReturnCode("CompileFail_BadInputTypes_UnsignedDiv"))
+    , CompileFail_BadInputTypes_UnsignedMulHigh(registerReturnCode("CompileFail_BadInputTypes_UnsignedMulHigh"))
+    , CompileFail_BadInputTypes_UnsignedRem(registerReturnCode("CompileFail_BadInputTypes_UnsignedRem"))
+    , CompileFail_BadInputTypes_UnsignedShiftR(registerReturnCode("CompileFail_BadInputTypes_UnsignedShiftR"))
+    , CompileFail_BadInputTypes_Xor(registerReturnCode("CompileFail_BadInputTypes_Xor"))
+    , CompileFail_BadInputTypes_EqualTo(registerReturnCode("CompileFail_BadInputTypes_EqualTo"))
+    , CompileFail_BadInputTypes_GreaterOrEqualTo(registerReturnCode("CompileFail_BadInputTypes_GreaterOrEqualTo"))
+    , CompileFail_BadInputTypes_GreaterThan(registerReturnCode("CompileFail_BadInputTypes_GreaterThan"))
+    , CompileFail_BadInputTypes_LessOrEqualTo(registerReturnCode("CompileFail_BadInputTypes_LessOrEqualTo"))
+    , CompileFail_BadInputTypes_LessThan(registerReturnCode("CompileFail_BadInputTypes_LessThan"))
+    , CompileFail_BadInputTypes_NotEqualTo(registerReturnCode("CompileFail_BadInputTypes_NotEqualTo"))
+    , CompileFail_BadInputTypes_Select(registerReturnCode("CompileFail_BadInputTypes_Select"))
+    , CompileFail_BadInputTypes_UnsignedGreaterOrEqualTo(registerReturnCode("CompileFail_BadInputTypes_UnsignedGreaterOrEqualTo"))
+    , CompileFail_BadInputTypes_UnsignedGreaterThan(registerReturnCode("CompileFail_BadInputTypes_UnsignedGreaterThan"))
+    , CompileFail_BadInputTypes_UnsignedLessOrEqualTo(registerReturnCode("CompileFail_BadInputTypes_UnsignedLessOrEqualTo"))
+    , CompileFail_BadInputTypes_UnsignedLessThan(registerReturnCode("CompileFail_BadInputTypes_UnsignedLessThan"))
     , CompileFail_BadInputTypes_IfCmpEqual(registerReturnCode("CompileFail_BadInputTypes_IfCmpEqual"))
     , CompileFail_BadInputTypes_IfCmpEqualZero(registerReturnCode("CompileFail_BadInputTypes_IfCmpEqualZero"))
     , CompileFail_BadInputTypes_IfCmpGreaterThan(registerReturnCode("CompileFail_BadInputTypes_IfCmpGreaterThan"))
@@ -113,9 +200,12 @@ BaseExtension::BaseExtension(Compiler *compiler, bool extended, std::string exte
     , CompileFail_BadInputTypes_IfCmpUnsignedLessThan(registerReturnCode("CompileFail_BadInputTypes_IfCmpUnsignedLessThan"))
     , CompileFail_BadInputTypes_IfCmpUnsignedLessOrEqual(registerReturnCode("CompileFail_BadInputTypes_IfCmpUnsignedLessOrEqual"))
     , CompileFail_BadInputTypes_ForLoopUp(registerReturnCode("CompileFail_BadInputTypes_ForLoopUp"))
+    , CompileFail_BadInputTypes_Switch(registerReturnCode("CompileFail_BadInputTypes_Switch"))
     , CompileFail_BadInputArray_OffsetAt(registerReturnCode("CompileFail_BadInputArray_OffsetAt"))
     , CompileFail_MismatchedArgumentTypes_Call(registerReturnCode("CompileFail_MismatchedArgumentTypes_Call")) {
 
+    _anyMemory = new AliasSymbol("AnyMemory", NoType, NULL, NULL);
+
     if (!extended) {
         Strategy *jb1cgStrategy = new Strategy(compiler, "jb1cg");
         Pass *jb1cg = new JB1CodeGenerator(compiler);
@@ -126,6 +216,12 @@ BaseExtension::BaseExtension(Compiler *compiler, bool extended, std::string exte
 }
 
 BaseExtension::~BaseExtension() {
+    for (auto it = _fieldAliasClasses.begin(); it != _fieldAliasClasses.end(); it++)
+        delete it->second;
+    for (auto it = _typeAliasClasses.begin(); it != _typeAliasClasses.end(); it++)
+        delete it->second;
+    delete _anyMemory;
+
     delete Address;
     delete Float64;
     delete Float32;
@@ -137,6 +233,37 @@ BaseExtension::~BaseExtension() {
     // what about other types!?
 }
 
+//
+// Alias classes
+//
+
+AliasSymbol *
+BaseExtension::TypeAliasClass(const Type *type) {
+    // pointers of every type may be stored to and loaded from the same memory as each other
+    if (type->isKind<PointerType>())
+        type = Address;
+
+    auto it = _typeAliasClasses.find(type);
+    if (it != _typeAliasClasses.end())
+        return it->second;
+
+    AliasSymbol *aliasClass = new AliasSymbol(std::string("AliasOf(") + type->name() + std::string(")"), type, type, NULL);
+    _typeAliasClasses[type] = aliasClass;
+    return aliasClass;
+}
+
+AliasSymbol *
+BaseExtension::FieldAliasClass(const FieldType *fieldType) {
+    auto it = _fieldAliasClasses.find(fieldType);
+    if (it != _fieldAliasClasses.end())
+        return it->second;
+
+    std::string name = std::string("AliasOf(") + fieldType->owningStruct()->name() + std::string(".") + fieldType->fieldName() + std::string(")");
+    AliasSymbol *aliasClass = new AliasSymbol(name, fieldType->type(), NULL, fieldType);
+    _fieldAliasClasses[fieldType] = aliasClass;
+    return aliasClass;
+}
+
 //
 // Const Operations
 //
@@ -152,6 +279,19 @@ BaseExtension::Const(LOCATION, Builder *b, Literal * lv) {
 //
 // Arithmetic operations
 //
+Value *
+BaseExtension::Abs(LOCATION, Builder *b, Value *value) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateMathUnaryOp(PASSLOC, b, value, true, CompileFail_BadInputTypes_Abs, "Abs"))
+            break;
+    }
+
+    Value *result = createValue(b, value->type());
+    addOperation(b, new Op_Abs(PASSLOC, this, b, aAbs, result, value));
+    return result;
+}
+
 bool
 BaseExtensionChecker::validateAdd(LOCATION, Builder *b, Value *left, Value *right) {
     const Type *lType = left->type();
@@ -184,199 +324,1003 @@ BaseExtensionChecker::validateAdd(LOCATION, Builder *b, Value *left, Value *righ
     }
 
     // we defined this operation, so if we can't validate it we have to fail it
-    failValidateAdd(PASSLOC, b, left, right);
+    failValidateAdd(PASSLOC, b, left, right);
+    return true;
+}
+
+void
+BaseExtensionChecker::failValidateAdd(LOCATION, Builder *b, Value *left, Value *right) {
+    CompilationException e(PASSLOC, _base->compiler(), _base->CompileFail_BadInputTypes_Add);
+    const Type *lType = left->type();
+    const Type *rType = right->type();
+    e.setMessageLine(std::string("Add: invalid input types"))
+     .appendMessageLine(std::string("    left ").append(lType->to_string()))
+     .appendMessageLine(std::string("   right ").append(rType->to_string()))
+     .appendMessageLine(std::string("Left and right types are expected to be the same for integer types (Int8,Int16,Int32,Int64,Float32,Float64)"))
+     .appendMessageLine(std::string("If left/right type is Address then the right/left (respectively) type must be Word"));
+    throw e;
+}
+
+Value *
+BaseExtension::Add(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateAdd(PASSLOC, b, left, right))
+            break;
+    }
+
+    if (right->type() == Address) { // reverse left and right
+        Value *save = left;
+        left = right;
+        right = save;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_Add(PASSLOC, this, b, aAdd, result, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::AddWithOverflow(LOCATION, Builder *b, Builder *overflowTarget, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateIntegerOp(PASSLOC, b, left, right, CompileFail_BadInputTypes_AddWithOverflow, "AddWithOverflow"))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_AddWithOverflow(PASSLOC, this, b, aAddWithOverflow, result, overflowTarget, left, right));
+    return result;
+}
+
+bool
+BaseExtensionChecker::validateIntegerOp(LOCATION, Builder *b, Value *left, Value *right, CompilerReturnCode failCode, std::string opCodeName) {
+    const Type *lType = left->type();
+    if (lType == _base->Int8
+     || lType == _base->Int16
+     || lType == _base->Int32
+     || lType == _base->Int64) {
+        if (right->type() != lType)
+            failValidateIntegerOp(PASSLOC, b, left, right, failCode, opCodeName);
+        return true;
+    }
+
+    // we defined this operation, so if we can't validate it we have to fail it
+    failValidateIntegerOp(PASSLOC, b, left, right, failCode, opCodeName);
+    return true;
+}
+
+void
+BaseExtensionChecker::failValidateIntegerOp(LOCATION, Builder *b, Value *left, Value *right, CompilerReturnCode failCode, std::string opCodeName) {
+    CompilationException e(PASSLOC, _base->compiler(), failCode);
+    e.setMessageLine(opCodeName.append(std::string(": invalid input types")))
+     .appendMessageLine(std::string("    left ").append(left->type()->to_string()))
+     .appendMessageLine(std::string("   right ").append(right->type()->to_string()))
+     .appendMessageLine(std::string("Left and right types are expected to be the same integer type (Int8,Int16,Int32,Int64)"));
+    throw e;
+}
+
+bool
+BaseExtensionChecker::validateIntegerUnaryOp(LOCATION, Builder *b, Value *value, CompilerReturnCode failCode, std::string opCodeName) {
+    const Type *vType = value->type();
+    if (vType == _base->Int8
+     || vType == _base->Int16
+     || vType == _base->Int32
+     || vType == _base->Int64) {
+        return true;
+    }
+
+    // we defined this operation, so if we can't validate it we have to fail it
+    failValidateIntegerUnaryOp(PASSLOC, b, value, failCode, opCodeName);
+    return true;
+}
+
+void
+BaseExtensionChecker::failValidateIntegerUnaryOp(LOCATION, Builder *b, Value *value, CompilerReturnCode failCode, std::string opCodeName) {
+    CompilationException e(PASSLOC, _base->compiler(), failCode);
+    e.setMessageLine(opCodeName.append(std::string(": invalid input type")))
+     .appendMessageLine(std::string("    value ").append(value->type()->to_string()))
+     .appendMessageLine(std::string("Value type must be an integer type (Int8,Int16,Int32,Int64)"));
+    throw e;
+}
+
+bool
+BaseExtensionChecker::validateShift(LOCATION, Builder *b, Value *value, Value *amount, CompilerReturnCode failCode, std::string opCodeName) {
+    const Type *vType = value->type();
+    if (vType == _base->Int8
+     || vType == _base->Int16
+     || vType == _base->Int32
+     || vType == _base->Int64) {
+        if (amount->type() != _base->Int32)
+            failValidateShift(PASSLOC, b, value, amount, failCode, opCodeName);
+        return true;
+    }
+
+    // we defined this operation, so if we can't validate it we have to fail it
+    failValidateShift(PASSLOC, b, value, amount, failCode, opCodeName);
+    return true;
+}
+
+void
+BaseExtensionChecker::failValidateShift(LOCATION, Builder *b, Value *value, Value *amount, CompilerReturnCode failCode, std::string opCodeName) {
+    CompilationException e(PASSLOC, _base->compiler(), failCode);
+    e.setMessageLine(opCodeName.append(std::string(": invalid input types")))
+     .appendMessageLine(std::string("    value ").append(value->type()->to_string()))
+     .appendMessageLine(std::string("   amount ").append(amount->type()->to_string()))
+     .appendMessageLine(std::string("Value type must be an integer type (Int8,Int16,Int32,Int64) and amount type must be Int32"));
+    throw e;
+}
+
+bool
+BaseExtensionChecker::validateMathOp(LOCATION, Builder *b, Value *left, Value *right, bool allowIntegers, CompilerReturnCode failCode, std::string opCodeName) {
+    const Type *lType = left->type();
+    if (lType == _base->Float32
+     || lType == _base->Float64
+     || (allowIntegers && (lType == _base->Int8
+                        || lType == _base->Int16
+                        || lType == _base->Int32
+                        || lType == _base->Int64))) {
+        if (right->type() != lType)
+            failValidateMathOp(PASSLOC, b, left, right, allowIntegers, failCode, opCodeName);
+        return true;
+    }
+
+    // we defined this operation, so if we can't validate it we have to fail it
+    failValidateMathOp(PASSLOC, b, left, right, allowIntegers, failCode, opCodeName);
+    return true;
+}
+
+void
+BaseExtensionChecker::failValidateMathOp(LOCATION, Builder *b, Value *left, Value *right, bool allowIntegers, CompilerReturnCode failCode, std::string opCodeName) {
+    CompilationException e(PASSLOC, _base->compiler(), failCode);
+    e.setMessageLine(opCodeName.append(std::string(": invalid input types")))
+     .appendMessageLine(std::string("    left ").append(left->type()->to_string()))
+     .appendMessageLine(std::string("   right ").append(right->type()->to_string()));
+    if (allowIntegers)
+        e.appendMessageLine(std::string("Left and right types are expected to be the same primitive numeric type (Int8,Int16,Int32,Int64,Float32,Float64)"));
+    else
+        e.appendMessageLine(std::string("Left and right types are expected to be the same floating point type (Float32,Float64)"));
+    throw e;
+}
+
+bool
+BaseExtensionChecker::validateMathUnaryOp(LOCATION, Builder *b, Value *value, bool allowIntegers, CompilerReturnCode failCode, std::string opCodeName) {
+    const Type *vType = value->type();
+    if (vType == _base->Float32
+     || vType == _base->Float64
+     || (allowIntegers && (vType == _base->Int8
+                        || vType == _base->Int16
+                        || vType == _base->Int32
+                        || vType == _base->Int64))) {
+        return true;
+    }
+
+    // we defined this operation, so if we can't validate it we have to fail it
+    failValidateMathUnaryOp(PASSLOC, b, value, allowIntegers, failCode, opCodeName);
+    return true;
+}
+
+void
+BaseExtensionChecker::failValidateMathUnaryOp(LOCATION, Builder *b, Value *value, bool allowIntegers, CompilerReturnCode failCode, std::string opCodeName) {
+    CompilationException e(PASSLOC, _base->compiler(), failCode);
+    e.setMessageLine(opCodeName.append(std::string(": invalid input type")))
+     .appendMessageLine(std::string("    value ").append(value->type()->to_string()));
+    if (allowIntegers)
+        e.appendMessageLine(std::string("Value type must be a primitive numeric type (Int8,Int16,Int32,Int64,Float32,Float64)"));
+    else
+        e.appendMessageLine(std::string("Value type must be a floating point type (Float32,Float64)"));
+    throw e;
+}
+
+Value *
+BaseExtension::And(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateIntegerOp(PASSLOC, b, left, right, CompileFail_BadInputTypes_And, "And"))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_And(PASSLOC, this, b, aAnd, result, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::Ceil(LOCATION, Builder *b, Value *value) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateMathUnaryOp(PASSLOC, b, value, false, CompileFail_BadInputTypes_Ceil, "Ceil"))
+            break;
+    }
+
+    Value *result = createValue(b, value->type());
+    addOperation(b, new Op_Ceil(PASSLOC, this, b, aCeil, result, value));
+    return result;
+}
+
+bool
+BaseExtensionChecker::validateConvertTo(LOCATION, Builder *b, const Type *type, Value *value) {
+    // TODO: enhance type checking
+    const Type *vType = value->type();
+    if (type == _base->Int8
+     || type == _base->Int16
+     || type == _base->Int32
+     || type == _base->Int64
+     || type == _base->Float32
+     || type == _base->Float64
+     || type == _base->Address) {
+        if (vType == _base->Int8
+         || vType == _base->Int16
+         || vType == _base->Int32
+         || vType == _base->Int64
+         || vType == _base->Float32
+         || vType == _base->Float64
+         || vType == _base->Address) {
+
+            return true;
+        }
+    }
+
+    // we defined this operation, so if we can't validate it we have to fail it
+    failValidateConvertTo(PASSLOC, b, type, value);
+    return true;
+}
+
+void
+BaseExtensionChecker::failValidateConvertTo(LOCATION, Builder *b, const Type *type, Value *value) {
+    CompilationException e(PASSLOC, _base->compiler(), _base->CompileFail_BadInputTypes_ConvertTo);
+    const Type *vType = value->type();
+    e.setMessageLine(std::string("ConvertTo: invalid input types"))
+     .appendMessageLine(std::string("    type ").append(type->to_string()))
+     .appendMessageLine(std::string("   value ").append(vType->to_string()))
+     .appendMessageLine(std::string("Source value and destination types must be a primitive type (Int8,Int16,Int32,Int64,Float32,Float64,Address)"));
+    throw e;
+}
+
+Value *
+BaseExtension::ConvertTo(LOCATION, Builder *b, const Type *type, Value *value) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateConvertTo(PASSLOC, b, type, value))
+            break;
+    }
+
+    Value *result = createValue(b, type);
+    addOperation(b, new Op_ConvertTo(PASSLOC, this, b, aConvertTo, result, type, value));
+    return result;
+}
+
+Value *
+BaseExtension::CopySign(LOCATION, Builder *b, Value *magnitude, Value *sign) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateMathOp(PASSLOC, b, magnitude, sign, false, CompileFail_BadInputTypes_CopySign, "CopySign"))
+            break;
+    }
+
+    Value *result = createValue(b, magnitude->type());
+    addOperation(b, new Op_CopySign(PASSLOC, this, b, aCopySign, result, magnitude, sign));
+    return result;
+}
+
+Value *
+BaseExtension::CountLeadingZeros(LOCATION, Builder *b, Value *value) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateIntegerUnaryOp(PASSLOC, b, value, CompileFail_BadInputTypes_CountLeadingZeros, "CountLeadingZeros"))
+            break;
+    }
+
+    Value *result = createValue(b, Int32);
+    addOperation(b, new Op_CountLeadingZeros(PASSLOC, this, b, aCountLeadingZeros, result, value));
+    return result;
+}
+
+Value *
+BaseExtension::CountTrailingZeros(LOCATION, Builder *b, Value *value) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateIntegerUnaryOp(PASSLOC, b, value, CompileFail_BadInputTypes_CountTrailingZeros, "CountTrailingZeros"))
+            break;
+    }
+
+    Value *result = createValue(b, Int32);
+    addOperation(b, new Op_CountTrailingZeros(PASSLOC, this, b, aCountTrailingZeros, result, value));
+    return result;
+}
+
+bool
+BaseExtensionChecker::validateDiv(LOCATION, Builder *b, Value *left, Value *right) {
+    const Type *lType = left->type();
+    if (lType == _base->Int8
+     || lType == _base->Int16
+     || lType == _base->Int32
+     || lType == _base->Int64
+     || lType == _base->Float32
+     || lType == _base->Float64) {
+        if (right->type() != lType)
+            failValidateDiv(PASSLOC, b, left, right);
+        return true;
+    }
+
+    // we defined this operation, so if we can't validate it we have to fail it
+    failValidateDiv(PASSLOC, b, left, right);
+    return true;
+}
+
+void
+BaseExtensionChecker::failValidateDiv(LOCATION, Builder *b, Value *left, Value *right) {
+    CompilationException e(PASSLOC, _base->compiler(), _base->CompileFail_BadInputTypes_Div);
+    const Type *lType = left->type();
+    const Type *rType = right->type();
+    e.setMessageLine(std::string("Div: invalid input types"))
+     .appendMessageLine(std::string("    left ").append(lType->to_string()))
+     .appendMessageLine(std::string("   right ").append(rType->to_string()))
+     .appendMessageLine(std::string("Left and right types are expected to be the same primitive numeric type (Int8,Int16,Int32,Int64,Float32,Float64)"));
+    throw e;
+}
+
+Value *
+BaseExtension::Div(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateDiv(PASSLOC, b, left, right))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_Div(PASSLOC, this, b, aDiv, result, left, right));
+    return result;
+}
+
+bool
+BaseExtensionChecker::validateFMA(LOCATION, Builder *b, Value *left, Value *right, Value *third, CompilerReturnCode failCode, std::string opCodeName) {
+    const Type *lType = left->type();
+    if (lType == _base->Int8
+     || lType == _base->Int16
+     || lType == _base->Int32
+     || lType == _base->Int64
+     || lType == _base->Float32
+     || lType == _base->Float64) {
+        if (right->type() != lType || third->type() != lType)
+            failValidateFMA(PASSLOC, b, left, right, third, failCode, opCodeName);
+        return true;
+    }
+
+    // we defined this operation, so if we can't validate it we have to fail it
+    failValidateFMA(PASSLOC, b, left, right, third, failCode, opCodeName);
+    return true;
+}
+
+void
+BaseExtensionChecker::failValidateFMA(LOCATION, Builder *b, Value *left, Value *right, Value *third, CompilerReturnCode failCode, std::string opCodeName) {
+    CompilationException e(PASSLOC, _base->compiler(), failCode);
+    e.setMessageLine(opCodeName.append(std::string(": invalid input types")))
+     .appendMessageLine(std::string("    left ").append(left->type()->to_string()))
+     .appendMessageLine(std::string("   right ").append(right->type()->to_string()))
+     .appendMessageLine(std::string("   third ").append(third->type()->to_string()))
+     .appendMessageLine(std::string("All three types are expected to be the same primitive numeric type (Int8,Int16,Int32,Int64,Float32,Float64)"));
+    throw e;
+}
+
+Value *
+BaseExtension::FMA(LOCATION, Builder *b, Value *left, Value *right, Value *addend) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateFMA(PASSLOC, b, left, right, addend, CompileFail_BadInputTypes_FMA, "FMA"))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_FMA(PASSLOC, this, b, aFMA, result, left, right, addend));
+    return result;
+}
+
+Value *
+BaseExtension::FMS(LOCATION, Builder *b, Value *left, Value *right, Value *subtrahend) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateFMA(PASSLOC, b, left, right, subtrahend, CompileFail_BadInputTypes_FMS, "FMS"))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_FMS(PASSLOC, this, b, aFMS, result, left, right, subtrahend));
+    return result;
+}
+
+Value *
+BaseExtension::FNMA(LOCATION, Builder *b, Value *left, Value *right, Value *minuend) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateFMA(PASSLOC, b, left, right, minuend, CompileFail_BadInputTypes_FNMA, "FNMA"))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_FNMA(PASSLOC, this, b, aFNMA, result, left, right, minuend));
+    return result;
+}
+
+
+Value *
+BaseExtension::Floor(LOCATION, Builder *b, Value *value) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateMathUnaryOp(PASSLOC, b, value, false, CompileFail_BadInputTypes_Floor, "Floor"))
+            break;
+    }
+
+    Value *result = createValue(b, value->type());
+    addOperation(b, new Op_Floor(PASSLOC, this, b, aFloor, result, value));
+    return result;
+}
+
+Value *
+BaseExtension::Max(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateMathOp(PASSLOC, b, left, right, true, CompileFail_BadInputTypes_Max, "Max"))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_Max(PASSLOC, this, b, aMax, result, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::Min(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateMathOp(PASSLOC, b, left, right, true, CompileFail_BadInputTypes_Min, "Min"))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_Min(PASSLOC, this, b, aMin, result, left, right));
+    return result;
+}
+
+bool
+BaseExtensionChecker::validateMul(LOCATION, Builder *b, Value *left, Value *right) {
+    const Type *lType = left->type();
+    const Type *rType = right->type();
+
+    if (lType == _base->Address || rType == _base->Address)
+        failValidateMul(PASSLOC, b, left, right);
+
+    if (lType == _base->Int8
+     || lType == _base->Int16
+     || lType == _base->Int32
+     || lType == _base->Int64
+     || lType == _base->Float32
+     || lType == _base->Float64) {
+        if (rType != lType)
+            failValidateMul(PASSLOC, b, left, right);
+        return true;
+    }
+
+    // we defined this operation, so if we can't validate it we have to fail it
+    failValidateMul(PASSLOC, b, left, right);
+    return true;
+}
+
+void
+BaseExtensionChecker::failValidateMul(LOCATION, Builder *b, Value *left, Value *right) {
+    CompilationException e(PASSLOC, _base->compiler(), _base->CompileFail_BadInputTypes_Mul);
+    const Type *lType = left->type();
+    const Type *rType = right->type();
+    e.setMessageLine(std::string("Mul: invalid input types"))
+     .appendMessageLine(std::string("    left ").append(lType->to_string()))
+     .appendMessageLine(std::string("   right ").append(rType->to_string()))
+     .appendMessageLine(std::string("Left and right types are expected to be the same for integer types (Int8,Int16,Int32,Int64,Float32,Float64)"))
+     .appendMessageLine(std::string("Address types cannot be used"));
+    throw e;
+}
+
+Value *
+BaseExtension::Mul(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateMul(PASSLOC, b, left, right))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_Mul(PASSLOC, this, b, aMul, result, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::MulHigh(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateIntegerOp(PASSLOC, b, left, right, CompileFail_BadInputTypes_MulHigh, "MulHigh"))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_MulHigh(PASSLOC, this, b, aMulHigh, result, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::MulWithOverflow(LOCATION, Builder *b, Builder *overflowTarget, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateIntegerOp(PASSLOC, b, left, right, CompileFail_BadInputTypes_MulWithOverflow, "MulWithOverflow"))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_MulWithOverflow(PASSLOC, this, b, aMulWithOverflow, result, overflowTarget, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::Not(LOCATION, Builder *b, Value *value) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateIntegerUnaryOp(PASSLOC, b, value, CompileFail_BadInputTypes_Not, "Not"))
+            break;
+    }
+
+    Value *result = createValue(b, value->type());
+    addOperation(b, new Op_Not(PASSLOC, this, b, aNot, result, value));
+    return result;
+}
+
+Value *
+BaseExtension::Or(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateIntegerOp(PASSLOC, b, left, right, CompileFail_BadInputTypes_Or, "Or"))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_Or(PASSLOC, this, b, aOr, result, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::PopCount(LOCATION, Builder *b, Value *value) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateIntegerUnaryOp(PASSLOC, b, value, CompileFail_BadInputTypes_PopCount, "PopCount"))
+            break;
+    }
+
+    Value *result = createValue(b, Int32);
+    addOperation(b, new Op_PopCount(PASSLOC, this, b, aPopCount, result, value));
+    return result;
+}
+
+Value *
+BaseExtension::Rem(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateIntegerOp(PASSLOC, b, left, right, CompileFail_BadInputTypes_Rem, "Rem"))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_Rem(PASSLOC, this, b, aRem, result, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::RotateL(LOCATION, Builder *b, Value *value, Value *amount) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateShift(PASSLOC, b, value, amount, CompileFail_BadInputTypes_RotateL, "RotateL"))
+            break;
+    }
+
+    Value *result = createValue(b, value->type());
+    addOperation(b, new Op_RotateL(PASSLOC, this, b, aRotateL, result, value, amount));
+    return result;
+}
+
+Value *
+BaseExtension::RotateR(LOCATION, Builder *b, Value *value, Value *amount) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateShift(PASSLOC, b, value, amount, CompileFail_BadInputTypes_RotateR, "RotateR"))
+            break;
+    }
+
+    Value *result = createValue(b, value->type());
+    addOperation(b, new Op_RotateR(PASSLOC, this, b, aRotateR, result, value, amount));
+    return result;
+}
+
+Value *
+BaseExtension::ShiftL(LOCATION, Builder *b, Value *value, Value *amount) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateShift(PASSLOC, b, value, amount, CompileFail_BadInputTypes_ShiftL, "ShiftL"))
+            break;
+    }
+
+    Value *result = createValue(b, value->type());
+    addOperation(b, new Op_ShiftL(PASSLOC, this, b, aShiftL, result, value, amount));
+    return result;
+}
+
+Value *
+BaseExtension::ShiftR(LOCATION, Builder *b, Value *value, Value *amount) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateShift(PASSLOC, b, value, amount, CompileFail_BadInputTypes_ShiftR, "ShiftR"))
+            break;
+    }
+
+    Value *result = createValue(b, value->type());
+    addOperation(b, new Op_ShiftR(PASSLOC, this, b, aShiftR, result, value, amount));
+    return result;
+}
+
+Value *
+BaseExtension::Sqrt(LOCATION, Builder *b, Value *value) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateMathUnaryOp(PASSLOC, b, value, false, CompileFail_BadInputTypes_Sqrt, "Sqrt"))
+            break;
+    }
+
+    Value *result = createValue(b, value->type());
+    addOperation(b, new Op_Sqrt(PASSLOC, this, b, aSqrt, result, value));
+    return result;
+}
+
+bool
+BaseExtensionChecker::validateSub(LOCATION, Builder *b, Value *left, Value *right) {
+    const Type *lType = left->type();
+    const Type *rType = right->type();
+
+    const Type *Address = _base->Address;
+    if (lType == Address) {
+        if (rType != Address && rType != _base->Word)
+            failValidateSub(PASSLOC, b, left, right);
+        return true;
+    }
+
+    if (rType == Address) // lType cannot be Address
+        failValidateSub(PASSLOC, b, left, right);
+
+    if (lType == _base->Int8
+     || lType == _base->Int16
+     || lType == _base->Int32
+     || lType == _base->Int64
+     || lType == _base->Float32
+     || lType == _base->Float64) {
+        if (rType != lType)
+            failValidateSub(PASSLOC, b, left, right);
+        return true;
+    }
+
+    // we defined this operation, so if we can't validate it we have to fail it
+    failValidateSub(PASSLOC, b, left, right);
     return true;
 }
 
 void
-BaseExtensionChecker::failValidateAdd(LOCATION, Builder *b, Value *left, Value *right) {
-    CompilationException e(PASSLOC, _base->compiler(), _base->CompileFail_BadInputTypes_Add);
+BaseExtensionChecker::failValidateSub(LOCATION, Builder *b, Value *left, Value *right) {
+    CompilationException e(PASSLOC, _base->compiler(), _base->CompileFail_BadInputTypes_Sub);
     const Type *lType = left->type();
     const Type *rType = right->type();
-    e.setMessageLine(std::string("Add: invalid input types"))
+    e.setMessageLine(std::string("Sub: invalid input types"))
      .appendMessageLine(std::string("    left ").append(lType->to_string()))
      .appendMessageLine(std::string("   right ").append(rType->to_string()))
      .appendMessageLine(std::string("Left and right types are expected to be the same for integer types (Int8,Int16,Int32,Int64,Float32,Float64)"))
-     .appendMessageLine(std::string("If left/right type is Address then the right/left (respectively) type must be Word"));
+     .appendMessageLine(std::string("If left type is Address then the right type must be either Address or Word"));
     throw e;
 }
 
 Value *
-BaseExtension::Add(LOCATION, Builder *b, Value *left, Value *right) {
+BaseExtension::Sub(LOCATION, Builder *b, Value *left, Value *right) {
     for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
         BaseExtensionChecker *checker = *it;
-        if (checker->validateAdd(PASSLOC, b, left, right))
+        if (checker->validateSub(PASSLOC, b, left, right))
             break;
     }
 
-    if (right->type() == Address) { // reverse left and right
-        Value *save = left;
-        left = right;
-        right = save;
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_Sub(PASSLOC, this, b, aSub, result, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::SubWithOverflow(LOCATION, Builder *b, Builder *overflowTarget, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateIntegerOp(PASSLOC, b, left, right, CompileFail_BadInputTypes_SubWithOverflow, "SubWithOverflow"))
+            break;
     }
 
     Value *result = createValue(b, left->type());
-    addOperation(b, new Op_Add(PASSLOC, this, b, aAdd, result, left, right));
+    addOperation(b, new Op_SubWithOverflow(PASSLOC, this, b, aSubWithOverflow, result, overflowTarget, left, right));
     return result;
 }
 
-bool
-BaseExtensionChecker::validateConvertTo(LOCATION, Builder *b, const Type *type, Value *value) {
-    // TODO: enhance type checking
-    const Type *vType = value->type();
-    if (type == _base->Int8
-     || type == _base->Int16
-     || type == _base->Int32
-     || type == _base->Int64
-     || type == _base->Float32
-     || type == _base->Float64
-     || type == _base->Address) {
-        if (vType == _base->Int8
-         || vType == _base->Int16
-         || vType == _base->Int32
-         || vType == _base->Int64
-         || vType == _base->Float32
-         || vType == _base->Float64
-         || vType == _base->Address) {
+Value *
+BaseExtension::UnsignedDiv(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateIntegerOp(PASSLOC, b, left, right, CompileFail_BadInputTypes_UnsignedDiv, "UnsignedDiv"))
+            break;
+    }
 
-            return true;
-        }
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_UnsignedDiv(PASSLOC, this, b, aUnsignedDiv, result, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::UnsignedMulHigh(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateIntegerOp(PASSLOC, b, left, right, CompileFail_BadInputTypes_UnsignedMulHigh, "UnsignedMulHigh"))
+            break;
     }
 
-    // we defined this operation, so if we can't validate it we have to fail it
-    failValidateConvertTo(PASSLOC, b, type, value);
-    return true;
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_UnsignedMulHigh(PASSLOC, this, b, aUnsignedMulHigh, result, left, right));
+    return result;
 }
 
-void
-BaseExtensionChecker::failValidateConvertTo(LOCATION, Builder *b, const Type *type, Value *value) {
-    CompilationException e(PASSLOC, _base->compiler(), _base->CompileFail_BadInputTypes_ConvertTo);
-    const Type *vType = value->type();
-    e.setMessageLine(std::string("ConvertTo: invalid input types"))
-     .appendMessageLine(std::string("    type ").append(type->to_string()))
-     .appendMessageLine(std::string("   value ").append(vType->to_string()))
-     .appendMessageLine(std::string("Source value and destination types must be a primitive type (Int8,Int16,Int32,Int64,Float32,Float64,Address)"));
-    throw e;
+Value *
+BaseExtension::UnsignedRem(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateIntegerOp(PASSLOC, b, left, right, CompileFail_BadInputTypes_UnsignedRem, "UnsignedRem"))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_UnsignedRem(PASSLOC, this, b, aUnsignedRem, result, left, right));
+    return result;
 }
 
 Value *
-BaseExtension::ConvertTo(LOCATION, Builder *b, const Type *type, Value *value) {
+BaseExtension::UnsignedShiftR(LOCATION, Builder *b, Value *value, Value *amount) {
     for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
         BaseExtensionChecker *checker = *it;
-        if (checker->validateConvertTo(PASSLOC, b, type, value))
+        if (checker->validateShift(PASSLOC, b, value, amount, CompileFail_BadInputTypes_UnsignedShiftR, "UnsignedShiftR"))
             break;
     }
 
-    Value *result = createValue(b, type);
-    addOperation(b, new Op_ConvertTo(PASSLOC, this, b, aConvertTo, result, type, value));
+    Value *result = createValue(b, value->type());
+    addOperation(b, new Op_UnsignedShiftR(PASSLOC, this, b, aUnsignedShiftR, result, value, amount));
+    return result;
+}
+
+Value *
+BaseExtension::Xor(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateIntegerOp(PASSLOC, b, left, right, CompileFail_BadInputTypes_Xor, "Xor"))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_Xor(PASSLOC, this, b, aXor, result, left, right));
     return result;
 }
 
+//
+// Compare operations
+//
 
 bool
-BaseExtensionChecker::validateMul(LOCATION, Builder *b, Value *left, Value *right) {
+BaseExtensionChecker::validateCompare(LOCATION, Builder *b, Value *left, Value *right, CompilerReturnCode failCode, std::string opCodeName) {
     const Type *lType = left->type();
     const Type *rType = right->type();
 
-    if (lType == _base->Address || rType == _base->Address)
-        failValidateMul(PASSLOC, b, left, right);
-
     if (lType == _base->Int8
      || lType == _base->Int16
      || lType == _base->Int32
      || lType == _base->Int64
      || lType == _base->Float32
-     || lType == _base->Float64) {
+     || lType == _base->Float64
+     || lType == _base->Address
+     || lType->isKind<PointerType>()) {
         if (rType != lType)
-            failValidateMul(PASSLOC, b, left, right);
+            failValidateCompare(PASSLOC, b, left, right, failCode, opCodeName);
         return true;
     }
 
-    // we defined this operation, so if we can't validate it we have to fail it
-    failValidateMul(PASSLOC, b, left, right);
+    // operation is declared by this extension, so if we can't validate it we have to fail it
+    failValidateCompare(PASSLOC, b, left, right, failCode, opCodeName);
     return true;
 }
 
 void
-BaseExtensionChecker::failValidateMul(LOCATION, Builder *b, Value *left, Value *right) {
-    CompilationException e(PASSLOC, _base->compiler(), _base->CompileFail_BadInputTypes_Mul);
-    const Type *lType = left->type();
-    const Type *rType = right->type();
-    e.setMessageLine(std::string("Mul: invalid input types"))
-     .appendMessageLine(std::string("    left ").append(lType->to_string()))
-     .appendMessageLine(std::string("   right ").append(rType->to_string()))
-     .appendMessageLine(std::string("Left and right types are expected to be the same for integer types (Int8,Int16,Int32,Int64,Float32,Float64)"))
-     .appendMessageLine(std::string("Address types cannot be used"));
+BaseExtensionChecker::failValidateCompare(LOCATION, Builder *b, Value *left, Value *right, CompilerReturnCode failCode, std::string opCodeName) {
+    CompilationException e(PASSLOC, _base->compiler(), failCode);
+    e.setMessageLine(opCodeName.append(std::string(": invalid input types")))
+     .appendMessageLine(std::string("    left ").append(left->type()->to_string()))
+     .appendMessageLine(std::string("   right ").append(right->type()->to_string()))
+     .appendMessageLine(std::string("Left and right types are expected to be the same type (Int8,Int16,Int32,Int64,Float32,Float64,Address or a pointer type)"));
     throw e;
 }
 
 Value *
-BaseExtension::Mul(LOCATION, Builder *b, Value *left, Value *right) {
+BaseExtension::EqualTo(LOCATION, Builder *b, Value *left, Value *right) {
     for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
         BaseExtensionChecker *checker = *it;
-        if (checker->validateMul(PASSLOC, b, left, right))
+        if (checker->validateCompare(PASSLOC, b, left, right, CompileFail_BadInputTypes_EqualTo, "EqualTo"))
             break;
     }
 
-    Value *result = createValue(b, left->type());
-    addOperation(b, new Op_Mul(PASSLOC, this, b, aMul, result, left, right));
+    Value *result = createValue(b, Int32);
+    addOperation(b, new Op_EqualTo(PASSLOC, this, b, aEqualTo, result, left, right));
     return result;
 }
 
-bool
-BaseExtensionChecker::validateSub(LOCATION, Builder *b, Value *left, Value *right) {
-    const Type *lType = left->type();
-    const Type *rType = right->type();
+Value *
+BaseExtension::GreaterOrEqualTo(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateCompare(PASSLOC, b, left, right, CompileFail_BadInputTypes_GreaterOrEqualTo, "GreaterOrEqualTo"))
+            break;
+    }
 
-    const Type *Address = _base->Address;
-    if (lType == Address) {
-        if (rType != Address && rType != _base->Word)
-            failValidateSub(PASSLOC, b, left, right);
-        return true;
+    Value *result = createValue(b, Int32);
+    addOperation(b, new Op_GreaterOrEqualTo(PASSLOC, this, b, aGreaterOrEqualTo, result, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::GreaterThan(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateCompare(PASSLOC, b, left, right, CompileFail_BadInputTypes_GreaterThan, "GreaterThan"))
+            break;
     }
 
-    if (rType == Address) // lType cannot be Address
-        failValidateSub(PASSLOC, b, left, right);
+    Value *result = createValue(b, Int32);
+    addOperation(b, new Op_GreaterThan(PASSLOC, this, b, aGreaterThan, result, left, right));
+    return result;
+}
 
-    if (lType == _base->Int8
-     || lType == _base->Int16
-     || lType == _base->Int32
-     || lType == _base->Int64
-     || lType == _base->Float32
-     || lType == _base->Float64) {
-        if (rType != lType)
-            failValidateSub(PASSLOC, b, left, right);
+Value *
+BaseExtension::LessOrEqualTo(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateCompare(PASSLOC, b, left, right, CompileFail_BadInputTypes_LessOrEqualTo, "LessOrEqualTo"))
+            break;
+    }
+
+    Value *result = createValue(b, Int32);
+    addOperation(b, new Op_LessOrEqualTo(PASSLOC, this, b, aLessOrEqualTo, result, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::LessThan(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateCompare(PASSLOC, b, left, right, CompileFail_BadInputTypes_LessThan, "LessThan"))
+            break;
+    }
+
+    Value *result = createValue(b, Int32);
+    addOperation(b, new Op_LessThan(PASSLOC, this, b, aLessThan, result, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::NotEqualTo(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateCompare(PASSLOC, b, left, right, CompileFail_BadInputTypes_NotEqualTo, "NotEqualTo"))
+            break;
+    }
+
+    Value *result = createValue(b, Int32);
+    addOperation(b, new Op_NotEqualTo(PASSLOC, this, b, aNotEqualTo, result, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::UnsignedGreaterOrEqualTo(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateCompare(PASSLOC, b, left, right, CompileFail_BadInputTypes_UnsignedGreaterOrEqualTo, "UnsignedGreaterOrEqualTo"))
+            break;
+    }
+
+    Value *result = createValue(b, Int32);
+    addOperation(b, new Op_UnsignedGreaterOrEqualTo(PASSLOC, this, b, aUnsignedGreaterOrEqualTo, result, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::UnsignedGreaterThan(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateCompare(PASSLOC, b, left, right, CompileFail_BadInputTypes_UnsignedGreaterThan, "UnsignedGreaterThan"))
+            break;
+    }
+
+    Value *result = createValue(b, Int32);
+    addOperation(b, new Op_UnsignedGreaterThan(PASSLOC, this, b, aUnsignedGreaterThan, result, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::UnsignedLessOrEqualTo(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateCompare(PASSLOC, b, left, right, CompileFail_BadInputTypes_UnsignedLessOrEqualTo, "UnsignedLessOrEqualTo"))
+            break;
+    }
+
+    Value *result = createValue(b, Int32);
+    addOperation(b, new Op_UnsignedLessOrEqualTo(PASSLOC, this, b, aUnsignedLessOrEqualTo, result, left, right));
+    return result;
+}
+
+Value *
+BaseExtension::UnsignedLessThan(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateCompare(PASSLOC, b, left, right, CompileFail_BadInputTypes_UnsignedLessThan, "UnsignedLessThan"))
+            break;
+    }
+
+    Value *result = createValue(b, Int32);
+    addOperation(b, new Op_UnsignedLessThan(PASSLOC, this, b, aUnsignedLessThan, result, left, right));
+    return result;
+}
+
+bool
+BaseExtensionChecker::validateSelect(LOCATION, Builder *b, Value *condition, Value *trueValue, Value *falseValue) {
+    const Type *type = trueValue->type();
+
+    if (condition->type() == _base->Int32
+     && (type == _base->Int8
+      || type == _base->Int16
+      || type == _base->Int32
+      || type == _base->Int64
+      || type == _base->Float32
+      || type == _base->Float64
+      || type == _base->Address
+      || type->isKind<PointerType>())) {
+        if (falseValue->type() != type)
+            failValidateSelect(PASSLOC, b, condition, trueValue, falseValue);
         return true;
     }
 
-    // we defined this operation, so if we can't validate it we have to fail it
-    failValidateSub(PASSLOC, b, left, right);
+    // operation is declared by this extension, so if we can't validate it we have to fail it
+    failValidateSelect(PASSLOC, b, condition, trueValue, falseValue);
     return true;
 }
 
 void
-BaseExtensionChecker::failValidateSub(LOCATION, Builder *b, Value *left, Value *right) {
-    CompilationException e(PASSLOC, _base->compiler(), _base->CompileFail_BadInputTypes_Sub);
-    const Type *lType = left->type();
-    const Type *rType = right->type();
-    e.setMessageLine(std::string("Sub: invalid input types"))
-     .appendMessageLine(std::string("    left ").append(lType->to_string()))
-     .appendMessageLine(std::string("   right ").append(rType->to_string()))
-     .appendMessageLine(std::string("Left and right types are expected to be the same for integer types (Int8,Int16,Int32,Int64,Float32,Float64)"))
-     .appendMessageLine(std::string("If left type is Address then the right type must be either Address or Word"));
+BaseExtensionChecker::failValidateSelect(LOCATION, Builder *b, Value *condition, Value *trueValue, Value *falseValue) {
+    CompilationException e(PASSLOC, _base->compiler(), _base->CompileFail_BadInputTypes_Select);
+    e.setMessageLine(std::string("Select: invalid input types"))
+     .appendMessageLine(std::string("   condition ").append(condition->type()->to_string()))
+     .appendMessageLine(std::string("   trueValue ").append(trueValue->type()->to_string()))
+     .appendMessageLine(std::string("  falseValue ").append(falseValue->type()->to_string()))
+     .appendMessageLine(std::string("Condition is expected to be Int32, and trueValue and falseValue the same type (Int8,Int16,Int32,Int64,Float32,Float64,Address or a pointer type)"));
     throw e;
 }
 
 Value *
-BaseExtension::Sub(LOCATION, Builder *b, Value *left, Value *right) {
+BaseExtension::Select(LOCATION, Builder *b, Value *condition, Value *trueValue, Value *falseValue) {
     for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
         BaseExtensionChecker *checker = *it;
-        if (checker->validateSub(PASSLOC, b, left, right))
+        if (checker->validateSelect(PASSLOC, b, condition, trueValue, falseValue))
             break;
     }
 
-    Value *result = createValue(b, left->type());
-    addOperation(b, new Op_Sub(PASSLOC, this, b, aSub, result, left, right));
+    Value *result = createValue(b, trueValue->type());
+    addOperation(b, new Op_Select(PASSLOC, this, b, aSelect, result, condition, trueValue, falseValue));
     return result;
 }
 
@@ -511,7 +1455,8 @@ BaseExtensionChecker::validateIfCmp(LOCATION, Builder *b, Builder *target, Value
      || lType == _base->Int64
      || lType == _base->Float32
      || lType == _base->Float64
-     || lType == _base->Address) {
+     || lType == _base->Address
+     || lType->isKind<PointerType>()) {
         if (rType != lType)
             failValidateIfCmp(PASSLOC, b, target, left, right, failCode, opCodeName);
         return true;
@@ -531,7 +1476,7 @@ BaseExtensionChecker::failValidateIfCmp(LOCATION, Builder *b, Builder *target, V
      .appendMessageLine(std::string("    left ").append(lType->to_string()))
      .appendMessageLine(std::string("   right ").append(rType->to_string()))
      .appendMessageLine(std::string("  target ").append(target->to_string()))
-     .appendMessageLine(std::string("Left and right types are expected to be the same type (Int8,Int16,Int32,Int64,Float32,Float64,Address)"));
+     .appendMessageLine(std::string("Left and right types are expected to be the same type (Int8,Int16,Int32,Int64,Float32,Float64,Address or a pointer type)"));
     throw e;
 }
 
@@ -707,6 +1652,44 @@ BaseExtension::Return(LOCATION, Builder *b, Value *v) {
     addOperation(b, new Op_Return(PASSLOC, this, b, this->aReturn, v));
 }
 
+bool
+BaseExtensionChecker::validateSwitch(LOCATION, Builder *b, Value *selector, Builder *defaultTarget, int32_t numCases, Literal **caseValues, Builder **caseTargets) {
+    if (selector->type() != _base->Int32)
+        failValidateSwitch(PASSLOC, b, selector, defaultTarget, numCases, caseValues, caseTargets);
+
+    std::set<int64_t> values;
+    for (int32_t c=0;c < numCases;c++) {
+        if (caseValues[c]->type() != _base->Int32 || !values.insert(caseValues[c]->getInteger()).second)
+            failValidateSwitch(PASSLOC, b, selector, defaultTarget, numCases, caseValues, caseTargets);
+    }
+
+    return true;
+}
+
+void
+BaseExtensionChecker::failValidateSwitch(LOCATION, Builder *b, Value *selector, Builder *defaultTarget, int32_t numCases, Literal **caseValues, Builder **caseTargets) {
+    CompilationException e(PASSLOC, _base->compiler(), _base->CompileFail_BadInputTypes_Switch);
+    std::string caseList;
+    for (int32_t c=0;c < numCases;c++)
+        caseList.append(" ").append(std::to_string(caseValues[c]->getInteger())).append(":").append(caseValues[c]->type()->to_string());
+    e.setMessageLine(std::string("Switch: invalid inputs"))
+     .appendMessageLine(std::string("  selector ").append(selector->type()->to_string()))
+     .appendMessageLine(std::string("     cases").append(caseList))
+     .appendMessageLine(std::string("Selector and case values must be Int32, and case values must be distinct"));
+    throw e;
+}
+
+void
+BaseExtension::Switch(LOCATION, Builder *b, Value *selector, Builder *defaultTarget, int32_t numCases, Literal **caseValues, Builder **caseTargets) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        BaseExtensionChecker *checker = *it;
+        if (checker->validateSwitch(PASSLOC, b, selector, defaultTarget, numCases, caseValues, caseTargets))
+            break;
+    }
+
+    addOperation(b, new Op_Switch(PASSLOC, this, b, aSwitch, selector, defaultTarget, numCases, caseValues, caseTargets));
+}
+
 //
 // Memory operations
 //
@@ -66,6 +66,7 @@ class StructType;
 class UnionType;
 class FunctionType;
 
+class AliasSymbol;
 class BaseExtensionChecker;
 class ForLoopBuilder;
 class FunctionCompilation;
@@ -84,8 +85,8 @@ public:
     static const MinorID BASEEXT_MINOR=1;
     static const PatchID BASEEXT_PATCH=0;
 
-    // 4 == LocalSymbol, ParameterSymbol, FunctionSymbol, FieldSymbol
-    uint32_t numSymbolTypes() const { return 4; }
+    // 5 == LocalSymbol, ParameterSymbol, FunctionSymbol, FieldSymbol, AliasSymbol
+    uint32_t numSymbolTypes() const { return 5; }
 
     virtual const SemanticVersion * semver() const {
         return &version;
@@ -113,6 +114,19 @@ public:
     // deprecated
     const FunctionType * DefineFunctionType(LOCATION, FunctionCompilation *comp, const Type *returnType, int32_t numParms, const Type **parmTypes);
 
+    //
+    // Alias classes (see AliasSymbol and AliasAnalysis)
+    //
+
+    // the class of memory accessed as type through a pointer (all pointer types share one class)
+    AliasSymbol *TypeAliasClass(const Type *type);
+
+    // the class of memory holding one field of a struct
+    AliasSymbol *FieldAliasClass(const FieldType *fieldType);
+
+    // the class of all memory, which operations like Call may read and write
+    AliasSymbol *AnyMemory() const { return _anyMemory; }
+
     //
     // Actions
     //
@@ -121,10 +135,54 @@ public:
     const ActionID aConst;
 
     // Arithmetic actions
+    const ActionID aAbs;
     const ActionID aAdd;
+    const ActionID aAddWithOverflow;
+    const ActionID aAnd;
+    const ActionID aCeil;
     const ActionID aConvertTo;
+    const ActionID aCopySign;
+    const ActionID aCountLeadingZeros;
+    const ActionID aCountTrailingZeros;
+    const ActionID aDiv;
+    const ActionID aFMA;
+    const ActionID aFMS;
+    const ActionID aFNMA;
+    const ActionID aFloor;
+    const ActionID aMax;
+    const ActionID aMin;
     const ActionID aMul;
+    const ActionID aMulHigh;
+    const ActionID aMulWithOverflow;
+    const ActionID aNot;
+    const ActionID aOr;
+    const ActionID aPopCount;
+    const ActionID aRem;
+    const ActionID aRotateL;
+    const ActionID aRotateR;
+    const ActionID aShiftL;
+    const ActionID aShiftR;
+    const ActionID aSqrt;
     const ActionID aSub;
+    const ActionID aSubWithOverflow;
+    const ActionID aUnsignedDiv;
+    const ActionID aUnsignedMulHigh;
+    const ActionID aUnsignedRem;
+    const ActionID aUnsignedShiftR;
+    const ActionID aXor;
+
+    // Compare actions
+    const ActionID aEqualTo;
+    const ActionID aGreaterOrEqualTo;
+    const ActionID aGreaterThan;
+    const ActionID aLessOrEqualTo;
+    const ActionID aLessThan;
+    const ActionID aNotEqualTo;
+    const ActionID aSelect;
+    const ActionID aUnsignedGreaterOrEqualTo;
+    const ActionID aUnsignedGreaterThan;
+    const ActionID aUnsignedLessOrEqualTo;
+    const ActionID aUnsignedLessThan;
 
     // Control actions
     const ActionID aCall;
@@ -143,6 +201,7 @@ public:
     const ActionID aIfCmpUnsignedLessThan;
     const ActionID aIfCmpUnsignedLessOrEqual;
     const ActionID aReturn;
+    const ActionID aSwitch;
 
     // Memory actions
     const ActionID aLoad;
@@ -162,10 +221,52 @@ public:
     // CompilerReturnCodes
     //
 
+    const CompilerReturnCode CompileFail_BadInputTypes_Abs;
     const CompilerReturnCode CompileFail_BadInputTypes_Add;
+    const CompilerReturnCode CompileFail_BadInputTypes_AddWithOverflow;
+    const CompilerReturnCode CompileFail_BadInputTypes_And;
+    const CompilerReturnCode CompileFail_BadInputTypes_Ceil;
     const CompilerReturnCode CompileFail_BadInputTypes_ConvertTo;
+    const CompilerReturnCode CompileFail_BadInputTypes_CopySign;
+    const CompilerReturnCode CompileFail_BadInputTypes_CountLeadingZeros;
+    const CompilerReturnCode CompileFail_BadInputTypes_CountTrailingZeros;
+    const CompilerReturnCode CompileFail_BadInputTypes_Div;
+    const CompilerReturnCode CompileFail_BadInputTypes_FMA;
+    const CompilerReturnCode CompileFail_BadInputTypes_FMS;
+    const CompilerReturnCode CompileFail_BadInputTypes_FNMA;
+    const CompilerReturnCode CompileFail_BadInputTypes_Floor;
+    const CompilerReturnCode CompileFail_BadInputTypes_Max;
+    const CompilerReturnCode CompileFail_BadInputTypes_Min;
     const CompilerReturnCode CompileFail_BadInputTypes_Mul;
+    const CompilerReturnCode CompileFail_BadInputTypes_MulHigh;
+    const CompilerReturnCode CompileFail_BadInputTypes_MulWithOverflow;
+    const CompilerReturnCode CompileFail_BadInputTypes_Not;
+    const CompilerReturnCode CompileFail_BadInputTypes_Or;
+    const CompilerReturnCode CompileFail_BadInputTypes_PopCount;
+    const CompilerReturnCode CompileFail_BadInputTypes_Rem;
+    const CompilerReturnCode CompileFail_BadInputTypes_RotateL;
+    const CompilerReturnCode CompileFail_BadInputTypes_RotateR;
+    const CompilerReturnCode CompileFail_BadInputTypes_ShiftL;
+    const CompilerReturnCode CompileFail_BadInputTypes_ShiftR;
+    const CompilerReturnCode CompileFail_BadInputTypes_Sqrt;
     const CompilerReturnCode CompileFail_BadInputTypes_Sub;
+    const CompilerReturnCode CompileFail_BadInputTypes_SubWithOverflow;
+    const CompilerReturnCode CompileFail_BadInputTypes_UnsignedDiv;
+    const CompilerReturnCode CompileFail_BadInputTypes_UnsignedMulHigh;
+    const CompilerReturnCode CompileFail_BadInputTypes_UnsignedRem;
+    const CompilerReturnCode CompileFail_BadInputTypes_UnsignedShiftR;
+    const CompilerReturnCode CompileFail_BadInputTypes_Xor;
+    const CompilerReturnCode CompileFail_BadInputTypes_EqualTo;
+    const CompilerReturnCode CompileFail_BadInputTypes_GreaterOrEqualTo;
+    const CompilerReturnCode CompileFail_BadInputTypes_GreaterThan;
+    const CompilerReturnCode CompileFail_BadInputTypes_LessOrEqualTo;
+    const CompilerReturnCode CompileFail_BadInputTypes_LessThan;
+    const CompilerReturnCode CompileFail_BadInputTypes_NotEqualTo;
+    const CompilerReturnCode CompileFail_BadInputTypes_Select;
+    const CompilerReturnCode CompileFail_BadInputTypes_UnsignedGreaterOrEqualTo;
+    const CompilerReturnCode CompileFail_BadInputTypes_UnsignedGreaterThan;
+    const CompilerReturnCode CompileFail_BadInputTypes_UnsignedLessOrEqualTo;
+    const CompilerReturnCode CompileFail_BadInputTypes_UnsignedLessThan;
     const CompilerReturnCode CompileFail_BadInputTypes_IfCmpEqual;
     const CompilerReturnCode CompileFail_BadInputTypes_IfCmpEqualZero;
     const CompilerReturnCode CompileFail_BadInputTypes_IfCmpGreaterThan;
@@ -179,6 +280,7 @@ public:
     const CompilerReturnCode CompileFail_BadInputTypes_IfCmpUnsignedLessThan;
     const CompilerReturnCode CompileFail_BadInputTypes_IfCmpUnsignedLessOrEqual;
     const CompilerReturnCode CompileFail_BadInputTypes_ForLoopUp;
+    const CompilerReturnCode CompileFail_BadInputTypes_Switch;
     const CompilerReturnCode CompileFail_BadInputArray_OffsetAt;
     const CompilerReturnCode CompileFail_MismatchedArgumentTypes_Call;
 
@@ -193,8 +295,69 @@ public:
     // Arithmetic operations
     Value * Add(LOCATION, Builder *b, Value *left, Value *right);
     Value * ConvertTo(LOCATION, Builder *b, const Type *type, Value *value);
+    Value * Div(LOCATION, Builder *b, Value *left, Value *right);
     Value * Mul(LOCATION, Builder *b, Value *left, Value *right);
+    Value * MulHigh(LOCATION, Builder *b, Value *left, Value *right);
+    Value * Rem(LOCATION, Builder *b, Value *left, Value *right);
     Value * Sub(LOCATION, Builder *b, Value *left, Value *right);
+    Value * UnsignedDiv(LOCATION, Builder *b, Value *left, Value *right);
+    Value * UnsignedMulHigh(LOCATION, Builder *b, Value *left, Value *right);
+    Value * UnsignedRem(LOCATION, Builder *b, Value *left, Value *right);
+
+    // Overflow checked arithmetic on integer types: if the signed result overflows, control transfers to
+    // overflowTarget instead of continuing with the next operation
+    Value * AddWithOverflow(LOCATION, Builder *b, Builder *overflowTarget, Value *left, Value *right);
+    Value * MulWithOverflow(LOCATION, Builder *b, Builder *overflowTarget, Value *left, Value *right);
+    Value * SubWithOverflow(LOCATION, Builder *b, Builder *overflowTarget, Value *left, Value *right);
+
+    // Bitwise operations on integer types
+    Value * And(LOCATION, Builder *b, Value *left, Value *right);
+    Value * Not(LOCATION, Builder *b, Value *value);
+    Value * Or(LOCATION, Builder *b, Value *left, Value *right);
+    Value * Xor(LOCATION, Builder *b, Value *left, Value *right);
+
+    // Shifts and rotates: amount must be Int32 and is taken modulo the number of bits in value
+    Value * RotateL(LOCATION, Builder *b, Value *value, Value *amount);
+    Value * RotateR(LOCATION, Builder *b, Value *value, Value *amount);
+    Value * ShiftL(LOCATION, Builder *b, Value *value, Value *amount);
+    Value * ShiftR(LOCATION, Builder *b, Value *value, Value *amount);
+    Value * UnsignedShiftR(LOCATION, Builder *b, Value *value, Value *amount);
+
+    // Bit counting operations on integer types, all of which produce an Int32
+    Value * CountLeadingZeros(LOCATION, Builder *b, Value *value);
+    Value * CountTrailingZeros(LOCATION, Builder *b, Value *value);
+    Value * PopCount(LOCATION, Builder *b, Value *value);
+
+    // Fused multiply operations: all three operands must have the same type; the product is only left
+    // unrounded on backends with a fused instruction, and is rounded before the add or subtract otherwise
+    Value * FMA(LOCATION, Builder *b, Value *left, Value *right, Value *addend);          // left * right + addend
+    Value * FMS(LOCATION, Builder *b, Value *left, Value *right, Value *subtrahend);      // left * right - subtrahend
+    Value * FNMA(LOCATION, Builder *b, Value *left, Value *right, Value *minuend);        // minuend - left * right
+
+    // Compare operations: left and right must have the same type, and the result is an Int32 that is 1 if true and 0 if false
+    Value * EqualTo(LOCATION, Builder *b, Value *left, Value *right);
+    Value * GreaterOrEqualTo(LOCATION, Builder *b, Value *left, Value *right);
+    Value * GreaterThan(LOCATION, Builder *b, Value *left, Value *right);
+    Value * LessOrEqualTo(LOCATION, Builder *b, Value *left, Value *right);
+    Value * LessThan(LOCATION, Builder *b, Value *left, Value *right);
+    Value * NotEqualTo(LOCATION, Builder *b, Value *left, Value *right);
+    Value * UnsignedGreaterOrEqualTo(LOCATION, Builder *b, Value *left, Value *right);
+    Value * UnsignedGreaterThan(LOCATION, Builder *b, Value *left, Value *right);
+    Value * UnsignedLessOrEqualTo(LOCATION, Builder *b, Value *left, Value *right);
+    Value * UnsignedLessThan(LOCATION, Builder *b, Value *left, Value *right);
+
+    // condition (an Int32) != 0 ? trueValue : falseValue, computed without branching
+    Value * Select(LOCATION, Builder *b, Value *condition, Value *trueValue, Value *falseValue);
+
+    // Math operations: Ceil, CopySign, Floor and Sqrt operate on Float32 or Float64 values, while Abs,
+    // Max and Min also operate on integer values. Max and Min return left if the values are unordered
+    Value * Abs(LOCATION, Builder *b, Value *value);
+    Value * Ceil(LOCATION, Builder *b, Value *value);
+    Value * CopySign(LOCATION, Builder *b, Value *magnitude, Value *sign);
+    Value * Floor(LOCATION, Builder *b, Value *value);
+    Value * Max(LOCATION, Builder *b, Value *left, Value *right);
+    Value * Min(LOCATION, Builder *b, Value *left, Value *right);
+    Value * Sqrt(LOCATION, Builder *b, Value *value);
 
     // Control operations
     Value *Call(LOCATION, Builder *b, FunctionSymbol *funcSym, ...);
@@ -215,6 +378,8 @@ public:
     void IfCmpUnsignedGreaterThan(LOCATION, Builder *b, Builder *target, Value *left, Value *right);
     void Return(LOCATION, Builder *b);
     void Return(LOCATION, Builder *b, Value *v);
+    // selector and every case value must be Int32, and case values must be distinct
+    void Switch(LOCATION, Builder *b, Value *selector, Builder *defaultTarget, int32_t numCases, Literal **caseValues, Builder **caseTargets);
 
     // Memory operations
     Value * Load(LOCATION, Builder *b, Symbol *sym);
@@ -265,6 +430,10 @@ protected:
     StrategyID _jb1cgStrategyID;
     std::vector<BaseExtensionChecker *> _checkers;
 
+    AliasSymbol *_anyMemory;
+    std::map<const Type *,AliasSymbol *> _typeAliasClasses;
+    std::map<const FieldType *,AliasSymbol *> _fieldAliasClasses;
+
     static const SemanticVersion version;
 };
 
@@ -279,22 +448,42 @@ public:
     virtual bool validateCall(LOCATION, Builder *b, FunctionSymbol *target, std::va_list & args);
     //virtual bool validateCallWithArgArray(LOCATION, Builder *b, FunctionSymbol *target, int32_t numArgs, Value **args);
     virtual bool validateConvertTo(LOCATION, Builder *b, const Type *type, Value *value);
+    virtual bool validateDiv(LOCATION, Builder *b, Value *left, Value *right);
+    virtual bool validateFMA(LOCATION, Builder *b, Value *left, Value *right, Value *third, CompilerReturnCode failCode, std::string opCodeName);
     virtual bool validateMul(LOCATION, Builder *b, Value *left, Value *right);
     virtual bool validateSub(LOCATION, Builder *b, Value *left, Value *right);
+    virtual bool validateIntegerOp(LOCATION, Builder *b, Value *left, Value *right, CompilerReturnCode failCode, std::string opCodeName);
+    virtual bool validateIntegerUnaryOp(LOCATION, Builder *b, Value *value, CompilerReturnCode failCode, std::string opCodeName);
+    virtual bool validateShift(LOCATION, Builder *b, Value *value, Value *amount, CompilerReturnCode failCode, std::string opCodeName);
+    virtual bool validateMathOp(LOCATION, Builder *b, Value *left, Value *right, bool allowIntegers, CompilerReturnCode failCode, std::string opCodeName);
+    virtual bool validateMathUnaryOp(LOCATION, Builder *b, Value *value, bool allowIntegers, CompilerReturnCode failCode, std::string opCodeName);
+    virtual bool validateCompare(LOCATION, Builder *b, Value *left, Value *right, CompilerReturnCode failCode, std::string opCodeName);
+    virtual bool validateSelect(LOCATION, Builder *b, Value *condition, Value *trueValue, Value *falseValue);
     virtual bool validateIfCmp(LOCATION, Builder *b, Builder *target, Value *left, Value *right, CompilerReturnCode failCode, std::string opCodeName);
     virtual bool validateIfCmpZero(LOCATION, Builder *b, Builder *target, Value *value, CompilerReturnCode failCode, std::string opCodeName);
     virtual bool validateForLoopUp(LOCATION, Builder *b, LocalSymbol *loopVariable, Value *initial, Value *final, Value *bump);
+    virtual bool validateSwitch(LOCATION, Builder *b, Value *selector, Builder *defaultTarget, int32_t numCases, Literal **caseValues, Builder **caseTargets);
 
 protected:
     virtual void failValidateAdd(LOCATION, Builder *b, Value *left, Value *right);
     virtual void failValidateCall(LOCATION, Builder *b, FunctionSymbol *target, std::va_list & args);
     //virtual void failValidateCallWithArgArray(LOCATION, Builder *b, FunctionSymbol *target, int32_t numArgs, Value **args);
     virtual void failValidateConvertTo(LOCATION, Builder *b, const Type *type, Value *value);
+    virtual void failValidateDiv(LOCATION, Builder *b, Value *left, Value *right);
+    virtual void failValidateFMA(LOCATION, Builder *b, Value *left, Value *right, Value *third, CompilerReturnCode failCode, std::string opCodeName);
     virtual void failValidateMul(LOCATION, Builder *b, Value *left, Value *right);
     virtual void failValidateSub(LOCATION, Builder *b, Value *left, Value *right);
+    virtual void failValidateIntegerOp(LOCATION, Builder *b, Value *left, Value *right, CompilerReturnCode failCode, std::string opCodeName);
+    virtual void failValidateIntegerUnaryOp(LOCATION, Builder *b, Value *value, CompilerReturnCode failCode, std::string opCodeName);
+    virtual void failValidateShift(LOCATION, Builder *b, Value *value, Value *amount, CompilerReturnCode failCode, std::string opCodeName);
+    virtual void failValidateMathOp(LOCATION, Builder *b, Value *left, Value *right, bool allowIntegers, CompilerReturnCode failCode, std::string opCodeName);
+    virtual void failValidateMathUnaryOp(LOCATION, Builder *b, Value *value, bool allowIntegers, CompilerReturnCode failCode, std::string opCodeName);
+    virtual void failValidateCompare(LOCATION, Builder *b, Value *left, Value *right, CompilerReturnCode failCode, std::string opCodeName);
+    virtual void failValidateSelect(LOCATION, Builder *b, Value *condition, Value *trueValue, Value *falseValue);
     virtual void failValidateIfCmp(LOCATION, Builder *b, Builder *target, Value *left, Value *right, CompilerReturnCode failCode, std::string opCodeName);
     virtual void failValidateIfCmpZero(LOCATION, Builder *b, Builder *target, Value *value, CompilerReturnCode failCode, std::string opCodeName);
     virtual void failValidateForLoopUp(LOCATION, Builder *b, LocalSymbol *loopVariable, Value *initial, Value *final, Value *bump);
+    virtual void failValidateSwitch(LOCATION, Builder *b, Value *selector, Builder *defaultTarget, int32_t numCases, Literal **caseValues, Builder **caseTargets);
 
     BaseExtension *_base;
 };
@@ -29,13 +29,15 @@ namespace Base {
 SymbolKind LocalSymbol::SYMBOLKIND=Symbol::kindService.assignKind(KindService::AnyKind, "LocalSymbol");
 SymbolKind FieldSymbol::SYMBOLKIND=Symbol::kindService.assignKind(KindService::AnyKind, "FieldSymbol");
 SymbolKind FunctionSymbol::SYMBOLKIND=Symbol::kindService.assignKind(KindService::AnyKind, "FunctionSymbol");
+SymbolKind AliasSymbol::SYMBOLKIND=Symbol::kindService.assignKind(KindService::AnyKind, "AliasSymbol");
 SymbolKind ParameterSymbol::SYMBOLKIND=Symbol::kindService.assignKind(LocalSymbol::SYMBOLKIND, "ParameterSymbol");
 
-FunctionSymbol::FunctionSymbol(const FunctionType *type, std::string name, std::string fileName, std::string lineNumber, void *entryPoint)
+FunctionSymbol::FunctionSymbol(const FunctionType *type, std::string name, std::string fileName, std::string lineNumber, void *entryPoint, Function *function)
     : Symbol(SYMBOLKIND, name, type)
     , _fileName(fileName)
     , _lineNumber(lineNumber)
-    , _entryPoint(entryPoint) {
+    , _entryPoint(entryPoint)
+    , _function(function) {
 
 }
 
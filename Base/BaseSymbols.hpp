@@ -29,7 +29,9 @@ namespace OMR {
 namespace JitBuilder {
 namespace Base {
 
+class BaseExtension;
 class FieldType;
+class Function;
 class FunctionType;
 class StructType;
 
@@ -70,33 +72,74 @@ class FunctionSymbol : public Symbol {
     friend class Function;
 
 public:
-    FunctionSymbol(const FunctionType *type, std::string name, std::string fileName, std::string lineNumber, void *entryPoint);
+    FunctionSymbol(const FunctionType *type, std::string name, std::string fileName, std::string lineNumber, void *entryPoint, Function *function=NULL);
     const FunctionType *functionType() const;
     std::string fileName() const { return _fileName; }
     std::string lineNumber() const { return _lineNumber; }
     void *entryPoint() const { return _entryPoint; }
 
+    // the JB2 Function (and so its IL) this symbol calls, or NULL if it is only known by entryPoint
+    Function *function() const { return _function; }
+
     static SymbolKind SYMBOLKIND;
 protected:
     std::string _fileName;
     std::string _lineNumber;
     void *_entryPoint;
+    Function *_function;
+};
+
+// An AliasSymbol names a class of memory that operations reach through pointers or struct
+// values rather than by name: all memory accessed as one Type, one field of one StructType,
+// or (for operations like Call) any memory at all. Operations report the alias classes they
+// may read or write (see Operation::mayReadSymbol), and AliasAnalysis decides which classes
+// can overlap. AliasSymbols are created and owned by the BaseExtension.
+class AliasSymbol : public Symbol {
+    friend class BaseExtension;
+
+public:
+    // the Type of memory in this class, or NULL for a field class or any memory
+    const Type *accessType() const { return _accessType; }
+
+    // the field in this class, or NULL for a type class or any memory
+    const FieldType *fieldType() const { return _fieldType; }
+
+    bool isAnyMemory() const { return _accessType == NULL && _fieldType == NULL; }
+
+    static SymbolKind SYMBOLKIND;
+
+protected:
+    AliasSymbol(std::string name, const Type *type, const Type *accessType, const FieldType *fieldType)
+        : Symbol(SYMBOLKIND, name, type)
+        , _accessType(accessType)
+        , _fieldType(fieldType) {
+
+    }
+
+    const Type *_accessType;
+    const FieldType *_fieldType;
 };
 
 class ParameterSymbol : public LocalSymbol {
 public:
-    ParameterSymbol(std::string name, const Type * type, int index)
+    ParameterSymbol(std::string name, const Type * type, int index, bool noAlias=false)
         : LocalSymbol(SYMBOLKIND, name, type)
-        , _index(index) {
+        , _index(index)
+        , _noAlias(noAlias) {
 
     }
 
     int index() const { return _index; }
 
+    // true if this pointer parameter has restrict semantics: the memory it points into is not
+    // accessed through any pointer that is not derived from it while the function runs
+    bool isNoAlias() const { return _noAlias; }
+
     static SymbolKind SYMBOLKIND;
 
 protected:
     int _index;
+    bool _noAlias;
 };
 
 } // namespace Base
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "BaseExtension.hpp"
+#include "Builder.hpp"
+#include "ColdBuilderLayout.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "ControlFlowGraph.hpp"
+#include "Operation.hpp"
+#include "TextWriter.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+ColdBuilderLayout::ColdBuilderLayout(Compiler *compiler)
+    : Pass(compiler, std::string("ColdBuilderLayout"))
+    , _base(compiler->lookupExtension<BaseExtension>()) {
+
+}
+
+// a branch transfers control to a target Builder that is not bound to it
+bool
+ColdBuilderLayout::isBranch(Operation *op) const {
+    if (op->numBuilders() != 1 || op->builder(0) == NULL)
+        return false;
+    Builder *target = op->builder(0);
+    return !target->isBound() || target->boundToOperation() != op;
+}
+
+void
+ColdBuilderLayout::findLikelyEdges(Builder *b, std::set<ControlFlowEdge> & likelyEdges) {
+    OperationVector & ops = b->operations();
+    for (size_t i=0;i < ops.size();i++) {
+        Operation *op = ops[i];
+        bool rarelyTaken = false;
+        if (isBranch(op)) {
+            int8_t p = op->takenProbability();
+            if (p != Operation::UnknownProbability && p <= ColdProbability)
+                rarelyTaken = true;
+            else if (op->action() == _base->aGoto && i > 0 && isBranch(ops[i-1])) {
+                // the Goto is only reached when the branch before it is not taken
+                int8_t branchP = ops[i-1]->takenProbability();
+                if (branchP != Operation::UnknownProbability && branchP >= 100 - ColdProbability)
+                    rarelyTaken = true;
+            }
+        }
+
+        ControlFlowEdgeVector edges;
+        op->controlFlowEdges(edges);
+        for (auto it = edges.begin(); it != edges.end(); it++) {
+            ControlFlowEdge & e = *it;
+            if (rarelyTaken && e.first == b && e.second == op->builder(0))
+                continue;
+            likelyEdges.insert(e);
+        }
+    }
+}
+
+CompilerReturnCode
+ColdBuilderLayout::perform(Compilation *comp) {
+    setTraceEnabled(comp->config()->traceColdBuilderLayout());
+    TextWriter *log = comp->logger(traceEnabled());
+
+    ControlFlowGraph *cfg = comp->cfg();
+    const BuilderVector & rpo = cfg->reversePostOrder();
+
+    std::set<ControlFlowEdge> likelyEdges;
+    for (auto it = rpo.begin(); it != rpo.end(); it++)
+        findLikelyEdges(*it, likelyEdges);
+
+    std::set<Builder *> entries;
+    for (int32_t e=0;e < cfg->numEntries();e++)
+        entries.insert(cfg->entry(e));
+
+    // coldness flows forward, so visiting in reverse postorder only repeats for loops
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (auto it = rpo.begin(); it != rpo.end(); it++) {
+            Builder *b = *it;
+            if (b->isCold() || entries.find(b) != entries.end())
+                continue;
+
+            const BuilderVector & preds = cfg->predecessors(b);
+            bool cold = preds.size() > 0;
+            for (auto pIt = preds.begin(); cold && pIt != preds.end(); pIt++) {
+                Builder *pred = *pIt;
+                if (!pred->isCold() && likelyEdges.find(ControlFlowEdge(pred, b)) != likelyEdges.end())
+                    cold = false;
+            }
+
+            if (cold) {
+                if (log) log->indent() << "ColdBuilderLayout: " << b << " is cold" << log->endl();
+                b->setCold();
+                changed = true;
+            }
+        }
+    }
+
+    return _compiler->CompileSuccessful;
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#ifndef COLDBUILDERLAYOUT_INCL
+#define COLDBUILDERLAYOUT_INCL
+
+#include <set>
+#include "Pass.hpp"
+#include "typedefs.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class Compilation;
+class Compiler;
+class Operation;
+
+namespace Base {
+
+class BaseExtension;
+
+// ColdBuilderLayout finds the Builders that are expected to run rarely and marks them cold, so
+// that code generation lays them out after the rest of the function and hot code stays compact
+// (JB1CodeGenerator visits cold Builders last, see Visitor::start and Builder::setCold). A
+// Builder is cold if it was marked cold when the IL was built, or if it is not an entry and
+// control only reaches it from cold Builders or along rarely taken branches. A branch with a takenProbability() of at most ColdProbability rarely
+// reaches its target; one with a takenProbability() of at least 100 - ColdProbability rarely
+// reaches the target of a Goto that immediately follows it.
+class ColdBuilderLayout : public Pass {
+public:
+    ColdBuilderLayout(Compiler *compiler);
+
+    static const int8_t ColdProbability = 5;
+
+    virtual CompilerReturnCode perform(Compilation *comp);
+
+protected:
+    bool isBranch(Operation *op) const;
+    void findLikelyEdges(Builder *b, std::set<ControlFlowEdge> & likelyEdges);
+
+    BaseExtension *_base;
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(COLDBUILDERLAYOUT_INCL)
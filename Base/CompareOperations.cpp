@@ -0,0 +1,246 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "BaseExtension.hpp"
+#include "Builder.hpp"
+#include "CompareOperations.hpp"
+#include "JB1MethodBuilder.hpp"
+#include "Location.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "Value.hpp"
+
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+//
+// EqualTo
+//
+Op_EqualTo::Op_EqualTo(LOCATION, Extension *ext, Builder * parent, ActionID aEqualTo, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aEqualTo, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_EqualTo::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_EqualTo(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_EqualTo::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->EqualTo(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// GreaterOrEqualTo
+//
+Op_GreaterOrEqualTo::Op_GreaterOrEqualTo(LOCATION, Extension *ext, Builder * parent, ActionID aGreaterOrEqualTo, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aGreaterOrEqualTo, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_GreaterOrEqualTo::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_GreaterOrEqualTo(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_GreaterOrEqualTo::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->GreaterOrEqualTo(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// GreaterThan
+//
+Op_GreaterThan::Op_GreaterThan(LOCATION, Extension *ext, Builder * parent, ActionID aGreaterThan, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aGreaterThan, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_GreaterThan::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_GreaterThan(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_GreaterThan::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->GreaterThan(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// LessOrEqualTo
+//
+Op_LessOrEqualTo::Op_LessOrEqualTo(LOCATION, Extension *ext, Builder * parent, ActionID aLessOrEqualTo, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aLessOrEqualTo, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_LessOrEqualTo::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_LessOrEqualTo(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_LessOrEqualTo::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->LessOrEqualTo(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// LessThan
+//
+Op_LessThan::Op_LessThan(LOCATION, Extension *ext, Builder * parent, ActionID aLessThan, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aLessThan, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_LessThan::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_LessThan(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_LessThan::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->LessThan(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// NotEqualTo
+//
+Op_NotEqualTo::Op_NotEqualTo(LOCATION, Extension *ext, Builder * parent, ActionID aNotEqualTo, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aNotEqualTo, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_NotEqualTo::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_NotEqualTo(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_NotEqualTo::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->NotEqualTo(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// UnsignedGreaterOrEqualTo
+//
+Op_UnsignedGreaterOrEqualTo::Op_UnsignedGreaterOrEqualTo(LOCATION, Extension *ext, Builder * parent, ActionID aUnsignedGreaterOrEqualTo, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aUnsignedGreaterOrEqualTo, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_UnsignedGreaterOrEqualTo::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_UnsignedGreaterOrEqualTo(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_UnsignedGreaterOrEqualTo::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->UnsignedGreaterOrEqualTo(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// UnsignedGreaterThan
+//
+Op_UnsignedGreaterThan::Op_UnsignedGreaterThan(LOCATION, Extension *ext, Builder * parent, ActionID aUnsignedGreaterThan, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aUnsignedGreaterThan, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_UnsignedGreaterThan::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_UnsignedGreaterThan(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_UnsignedGreaterThan::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->UnsignedGreaterThan(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// UnsignedLessOrEqualTo
+//
+Op_UnsignedLessOrEqualTo::Op_UnsignedLessOrEqualTo(LOCATION, Extension *ext, Builder * parent, ActionID aUnsignedLessOrEqualTo, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aUnsignedLessOrEqualTo, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_UnsignedLessOrEqualTo::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_UnsignedLessOrEqualTo(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_UnsignedLessOrEqualTo::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->UnsignedLessOrEqualTo(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// UnsignedLessThan
+//
+Op_UnsignedLessThan::Op_UnsignedLessThan(LOCATION, Extension *ext, Builder * parent, ActionID aUnsignedLessThan, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aUnsignedLessThan, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_UnsignedLessThan::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_UnsignedLessThan(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+void
+Op_UnsignedLessThan::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->UnsignedLessThan(location(), this->parent(), this->_result, this->_left, this->_right);
+}
+
+
+//
+// Select
+//
+Op_Select::Op_Select(LOCATION, Extension *ext, Builder * parent, ActionID aSelect, Value *result, Value *condition, Value *trueValue, Value *falseValue)
+    : OperationR1V3(PASSLOC, aSelect, ext, parent, result, condition, trueValue, falseValue) {
+
+}
+
+Operation *
+Op_Select::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_Select(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1), cloner->operand(2));
+}
+
+void
+Op_Select::jbgen(JB1MethodBuilder *j1mb) const {
+    j1mb->Select(location(), this->parent(), this->_result, this->_first, this->_second, this->_third);
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef COMPAREOPERATIONS_INCL
+#define COMPAREOPERATIONS_INCL
+
+#include "Operation.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+// left == right: an Int32 that is 1 if true and 0 if false
+class Op_EqualTo : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_EqualTo(LOCATION, Extension *ext, Builder * parent, ActionID aEqualTo, Value *result, Value *left, Value *right);
+    };
+
+// left >= right: an Int32 that is 1 if true and 0 if false
+class Op_GreaterOrEqualTo : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_GreaterOrEqualTo(LOCATION, Extension *ext, Builder * parent, ActionID aGreaterOrEqualTo, Value *result, Value *left, Value *right);
+    };
+
+// left > right: an Int32 that is 1 if true and 0 if false
+class Op_GreaterThan : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_GreaterThan(LOCATION, Extension *ext, Builder * parent, ActionID aGreaterThan, Value *result, Value *left, Value *right);
+    };
+
+// left <= right: an Int32 that is 1 if true and 0 if false
+class Op_LessOrEqualTo : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_LessOrEqualTo(LOCATION, Extension *ext, Builder * parent, ActionID aLessOrEqualTo, Value *result, Value *left, Value *right);
+    };
+
+// left < right: an Int32 that is 1 if true and 0 if false
+class Op_LessThan : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_LessThan(LOCATION, Extension *ext, Builder * parent, ActionID aLessThan, Value *result, Value *left, Value *right);
+    };
+
+// left != right: an Int32 that is 1 if true and 0 if false
+class Op_NotEqualTo : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_NotEqualTo(LOCATION, Extension *ext, Builder * parent, ActionID aNotEqualTo, Value *result, Value *left, Value *right);
+    };
+
+// left >= right, comparing integers as unsigned values: an Int32 that is 1 if true and 0 if false
+class Op_UnsignedGreaterOrEqualTo : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_UnsignedGreaterOrEqualTo(LOCATION, Extension *ext, Builder * parent, ActionID aUnsignedGreaterOrEqualTo, Value *result, Value *left, Value *right);
+    };
+
+// left > right, comparing integers as unsigned values: an Int32 that is 1 if true and 0 if false
+class Op_UnsignedGreaterThan : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_UnsignedGreaterThan(LOCATION, Extension *ext, Builder * parent, ActionID aUnsignedGreaterThan, Value *result, Value *left, Value *right);
+    };
+
+// left <= right, comparing integers as unsigned values: an Int32 that is 1 if true and 0 if false
+class Op_UnsignedLessOrEqualTo : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_UnsignedLessOrEqualTo(LOCATION, Extension *ext, Builder * parent, ActionID aUnsignedLessOrEqualTo, Value *result, Value *left, Value *right);
+    };
+
+// left < right, comparing integers as unsigned values: an Int32 that is 1 if true and 0 if false
+class Op_UnsignedLessThan : public OperationR1V2 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_UnsignedLessThan(LOCATION, Extension *ext, Builder * parent, ActionID aUnsignedLessThan, Value *result, Value *left, Value *right);
+    };
+
+// condition != 0 ? trueValue : falseValue, without branching
+class Op_Select : public OperationR1V3 {
+    friend class BaseExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+protected:
+    Op_Select(LOCATION, Extension *ext, Builder * parent, ActionID aSelect, Value *result, Value *condition, Value *trueValue, Value *falseValue);
+    };
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // !defined(COMPAREOPERATIONS_INCL)
@@ -0,0 +1,216 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <math.h>
+#include "BaseExtension.hpp"
+#include "BaseTypes.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "ConstantFolding.hpp"
+#include "Literal.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "Value.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+ConstantFolding::ConstantFolding(Compiler *compiler)
+    : Transformer(compiler, std::string("ConstantFolding"))
+    , _base(compiler->lookupExtension<BaseExtension>()) {
+
+}
+
+void
+ConstantFolding::visitPreCompilation(Compilation * comp) {
+    setTraceEnabled(_comp->config()->traceConstantFolding());
+}
+
+bool
+ConstantFolding::isFoldable(ActionID a) const {
+    return a == _base->aAbs
+        || a == _base->aAnd
+        || a == _base->aCeil
+        || a == _base->aCopySign
+        || a == _base->aFloor
+        || a == _base->aMax
+        || a == _base->aMin
+        || a == _base->aOr
+        || a == _base->aXor
+        || a == _base->aNot
+        || a == _base->aShiftL
+        || a == _base->aShiftR
+        || a == _base->aUnsignedShiftR
+        || a == _base->aRotateL
+        || a == _base->aRotateR
+        || a == _base->aSqrt
+        || a == _base->aPopCount
+        || a == _base->aCountLeadingZeros
+        || a == _base->aCountTrailingZeros;
+}
+
+Literal *
+ConstantFolding::constantValue(Value *v) {
+    const Operation *def = v->definition();
+    if (def == NULL || def->action() != _base->aConst)
+        return NULL;
+    return def->literal();
+}
+
+Builder *
+ConstantFolding::transformOperation(Operation * op) {
+    if (!isFoldable(op->action()))
+        return NULL;
+
+    Literal *literals[2] = { NULL, NULL };
+    for (int32_t o=0;o < op->numOperands();o++) {
+        literals[o] = constantValue(op->operand(o));
+        if (literals[o] == NULL)
+            return NULL;
+    }
+
+    // replace op with a Const that defines the same result Value
+    Builder *scratch = _base->OrphanBuilder(LOC, op->parent());
+    const Type *type = op->operand(0)->type();
+    if (type == _base->Float32 || type == _base->Float64) {
+        double y = (literals[1] != NULL) ? literals[1]->getFloatingPoint() : 0.0;
+        double folded = foldFloatingPoint(op->action(), literals[0]->getFloatingPoint(), y);
+        if (type == _base->Float32)
+            _base->ConstFloat32(LOC, scratch, (float) folded);
+        else
+            _base->ConstFloat64(LOC, scratch, folded);
+    }
+    else {
+        uint64_t y = (literals[1] != NULL) ? (uint64_t) literals[1]->getInteger() : 0;
+        uint64_t folded = fold(op->action(), type->size(), (uint64_t) literals[0]->getInteger(), y);
+        constant(scratch, op->result()->type(), (int64_t) folded);
+    }
+    Operation *c = scratch->operations().back();
+
+    OperationCloner cloner(c);
+    cloner.changeResult(op->result());
+    Builder *b = _base->OrphanBuilder(LOC, op->parent());
+    b->appendClone(c, &cloner);
+    return b;
+}
+
+// the value of the low bits bits of x, as a signed integer
+static int64_t
+signExtend(uint64_t x, int32_t bits) {
+    if (bits < 64 && (x & ((uint64_t)1 << (bits - 1))) != 0)
+        x |= ~(uint64_t)0 << bits;
+    return (int64_t) x;
+}
+
+static int32_t
+popCount(uint64_t x) {
+    int32_t count = 0;
+    for (;x != 0;x &= x - 1)
+        count++;
+    return count;
+}
+
+// computes the result of operation a on bits-wide operands x and (for binary operations) y
+uint64_t
+ConstantFolding::fold(ActionID a, int32_t bits, uint64_t x, uint64_t y) {
+    uint64_t mask = (bits == 64) ? ~(uint64_t)0 : (((uint64_t)1 << bits) - 1);
+    x &= mask;
+    int32_t amount = (int32_t)(y & (bits - 1));
+
+    if (a == _base->aAnd)
+        return x & y;
+    if (a == _base->aOr)
+        return x | y;
+    if (a == _base->aXor)
+        return x ^ y;
+    if (a == _base->aNot)
+        return ~x;
+    if (a == _base->aShiftL)
+        return x << amount;
+    if (a == _base->aUnsignedShiftR)
+        return x >> amount;
+    if (a == _base->aShiftR) // sign extend x so copies of its sign bit are shifted in
+        return (uint64_t)(signExtend(x, bits) >> amount);
+    if (a == _base->aAbs)
+        return (signExtend(x, bits) < 0) ? (uint64_t)0 - x : x;
+    if (a == _base->aMax)
+        return (signExtend(y, bits) > signExtend(x, bits)) ? y : x;
+    if (a == _base->aMin)
+        return (signExtend(y, bits) < signExtend(x, bits)) ? y : x;
+    if (a == _base->aRotateL || a == _base->aRotateR) {
+        if (a == _base->aRotateR)
+            amount = (bits - amount) & (bits - 1);
+        if (amount == 0)
+            return x;
+        return (x << amount) | (x >> (bits - amount));
+    }
+    if (a == _base->aPopCount)
+        return popCount(x);
+    if (a == _base->aCountLeadingZeros) {
+        int32_t zeroes = bits;
+        for (;x != 0;x >>= 1)
+            zeroes--;
+        return zeroes;
+    }
+    assert(a == _base->aCountTrailingZeros);
+    return popCount(~x & (x - 1) & mask);
+}
+
+// computes the result of operation a on floating point operands x and (for binary operations) y;
+// Float32 operands are folded as doubles, which rounds each of these operations' result correctly
+double
+ConstantFolding::foldFloatingPoint(ActionID a, double x, double y) {
+    if (a == _base->aAbs)
+        return fabs(x);
+    if (a == _base->aCeil)
+        return ceil(x);
+    if (a == _base->aCopySign)
+        return copysign(x, y);
+    if (a == _base->aFloor)
+        return floor(x);
+    if (a == _base->aMax)
+        return (y > x) ? y : x;
+    if (a == _base->aMin)
+        return (y < x) ? y : x;
+    assert(a == _base->aSqrt);
+    return sqrt(x);
+}
+
+Value *
+ConstantFolding::constant(Builder *b, const Type *type, int64_t v) {
+    if (type == _base->Int8)
+        return _base->ConstInt8(LOC, b, (int8_t) v);
+    else if (type == _base->Int16)
+        return _base->ConstInt16(LOC, b, (int16_t) v);
+    else if (type == _base->Int32)
+        return _base->ConstInt32(LOC, b, (int32_t) v);
+    assert(type == _base->Int64);
+    return _base->ConstInt64(LOC, b, v);
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#ifndef CONSTANTFOLDING_INCL
+#define CONSTANTFOLDING_INCL
+
+#include <stdint.h>
+#include "Transformer.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class Compiler;
+class Literal;
+class Operation;
+class Type;
+class Value;
+
+namespace Base {
+
+class BaseExtension;
+
+// ConstantFolding replaces bitwise, shift, rotate, bit counting and math operations whose operands
+// are all produced by Const operations with a Const of the result, computed the same way the
+// operation would compute it at runtime (e.g. shift amounts are taken modulo the number of bits).
+class ConstantFolding : public Transformer {
+public:
+    ConstantFolding(Compiler *compiler);
+
+protected:
+    virtual void visitPreCompilation(Compilation * comp);
+    virtual Builder * transformOperation(Operation * op);
+
+    bool isFoldable(ActionID a) const;
+    Literal * constantValue(Value *v);
+    uint64_t fold(ActionID a, int32_t bits, uint64_t x, uint64_t y);
+    double foldFloatingPoint(ActionID a, double x, double y);
+    Value * constant(Builder *b, const Type *type, int64_t v);
+
+    BaseExtension *_base;
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(CONSTANTFOLDING_INCL)
+
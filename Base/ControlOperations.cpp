@@ -20,6 +20,10 @@
  *******************************************************************************/
 
 #include <stdint.h>
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <vector>
 #include "BaseExtension.hpp"
 #include "BaseSymbols.hpp"
 #include "BaseTypes.hpp"
@@ -57,6 +61,16 @@ Op_Call::Op_Call(LOCATION, Extension *ext, Builder * parent, ActionID aCall, Fun
 
 }
 
+Symbol *
+Op_Call::mayReadSymbol(int i) const {
+    return (i == 0) ? static_cast<BaseExtension *>(_ext)->AnyMemory() : NULL;
+}
+
+Symbol *
+Op_Call::mayWriteSymbol(int i) const {
+    return (i == 0) ? static_cast<BaseExtension *>(_ext)->AnyMemory() : NULL;
+}
+
 Operation *
 Op_Call::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
     return new Op_Call(PASSLOC, this->_ext, b, this->action(), cloner);
@@ -124,6 +138,24 @@ Op_ForLoopUp::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
     return new Op_ForLoopUp(PASSLOC, this->_ext, b, this->action(), &loopBuilder);
    }
 
+// the loop test runs in the parent before the first iteration and in loopContinue after each
+// iteration, and either enters the body or leaves the loop through loopBreak
+void
+Op_ForLoopUp::controlFlowEdges(ControlFlowEdgeVector & edges) const {
+    edges.push_back(ControlFlowEdge(parent(), _loopBody));
+    if (_loopBreak)
+        edges.push_back(ControlFlowEdge(parent(), _loopBreak));
+    if (_loopContinue) {
+        edges.push_back(ControlFlowEdge(_loopBody, _loopContinue));
+        edges.push_back(ControlFlowEdge(_loopContinue, _loopBody));
+        if (_loopBreak)
+            edges.push_back(ControlFlowEdge(_loopContinue, _loopBreak));
+    }
+    else {
+        edges.push_back(ControlFlowEdge(_loopBody, _loopBody));
+    }
+}
+
 void
 Op_ForLoopUp::write(TextWriter & w) const {
     w << name() << " " << this->_loopVariable << " : " << this->_initial << " to " << this->_final << " by " << this->_bump << " body " << this->_loopBody;
@@ -408,6 +440,95 @@ Op_Return::jbgen(JB1MethodBuilder *j1mb) const {
     j1mb->Return(location(), parent(), operand());
 }
 
+//
+// Switch
+//
+Op_Switch::Op_Switch(LOCATION, Extension *ext, Builder * parent, ActionID aSwitch, Value *selector, Builder *defaultTarget, int32_t numCases, Literal **caseValues, Builder **caseTargets)
+    : OperationR0V1(PASSLOC, aSwitch, ext, parent, selector)
+    , _caseValues(caseValues, caseValues + numCases) {
+
+    _targets.push_back(defaultTarget);
+    _targets.insert(_targets.end(), caseTargets, caseTargets + numCases);
+}
+
+Operation *
+Op_Switch::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    int32_t numCases = this->numCases();
+    std::vector<Literal *> caseValues(numCases);
+    std::vector<Builder *> caseTargets(numCases);
+    for (int32_t c=0;c < numCases;c++) {
+        caseValues[c] = cloner->literal(c);
+        caseTargets[c] = cloner->builder(c+1);
+    }
+    return new Op_Switch(PASSLOC, this->_ext, b, this->action(), cloner->operand(), cloner->builder(0), numCases, caseValues.data(), caseTargets.data());
+}
+
+void
+Op_Switch::write(TextWriter & w) const {
+    w << name() << " " << selector() << " default " << defaultTarget();
+    for (int32_t c=0;c < numCases();c++)
+        w << " " << caseValue(c) << " " << caseTarget(c);
+    w << w.endl();
+}
+
+Op_Switch::Dispatch
+Op_Switch::dispatch() const {
+    int32_t numCases = this->numCases();
+    if (numCases == 0)
+        return BinarySearch;
+
+    int64_t low = caseValue(0)->getInteger();
+    int64_t high = low;
+    std::set<Builder *> targets;
+    for (int32_t c=0;c < numCases;c++) {
+        int64_t v = caseValue(c)->getInteger();
+        if (v < low)
+            low = v;
+        if (v > high)
+            high = v;
+        targets.insert(caseTarget(c));
+    }
+    int64_t range = high - low + 1;
+
+    // a table pays off once there are a few cases and at least 40% of its entries are cases
+    if (numCases >= 4 && 2 * range <= 5 * numCases)
+        return JumpTable;
+
+    // one bit test per distinct target replaces a compare per case
+    if (numCases >= 3 && range <= 64 && targets.size() <= 3)
+        return BitTests;
+
+    return BinarySearch;
+}
+
+void
+Op_Switch::jbgen(JB1MethodBuilder *j1mb) const {
+    // cases are generated in increasing order of their values
+    std::vector<std::pair<int32_t,Builder *> > cases;
+    for (int32_t c=0;c < numCases();c++)
+        cases.push_back(std::make_pair(static_cast<int32_t>(caseValue(c)->getInteger()), caseTarget(c)));
+    std::sort(cases.begin(), cases.end());
+
+    std::vector<int32_t> values;
+    std::vector<Builder *> targets;
+    for (auto it = cases.begin(); it != cases.end(); it++) {
+        values.push_back(it->first);
+        targets.push_back(it->second);
+    }
+
+    switch (dispatch()) {
+        case JumpTable :
+            j1mb->Switch(location(), parent(), selector(), defaultTarget(), values, targets);
+            break;
+        case BitTests :
+            j1mb->SwitchWithBitTests(location(), parent(), selector(), defaultTarget(), values, targets);
+            break;
+        case BinarySearch :
+            j1mb->SwitchWithBinarySearch(location(), parent(), selector(), defaultTarget(), values, targets);
+            break;
+    }
+}
+
 
 #if 0
 // keep around and handy during migration
@@ -41,6 +41,12 @@ public:
     virtual void write(TextWriter &w) const;
     virtual void jbgen(JB1MethodBuilder *j1mb) const;
 
+    // the target may read and write any memory
+    virtual int32_t numMayReadSymbols() const { return 1; }
+    virtual Symbol * mayReadSymbol(int i=0) const;
+    virtual int32_t numMayWriteSymbols() const { return 1; }
+    virtual Symbol * mayWriteSymbol(int i=0) const;
+
 protected:
     Op_Call(LOCATION, Extension *ext, Builder * parent, ActionID aCall, Value *result, FunctionSymbol *target, std::va_list & args);
     Op_Call(LOCATION, Extension *ext, Builder * parent, ActionID aCall, FunctionSymbol *target, std::va_list & args);
@@ -251,6 +257,15 @@ public:
     virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
     virtual void write(TextWriter &w) const;
     virtual void jbgen(JB1MethodBuilder *j1mb) const;
+    virtual void controlFlowEdges(ControlFlowEdgeVector & edges) const;
+
+    LocalSymbol *loopVariable() const { return _loopVariable; }
+    Value *initialValue() const { return _initial; }
+    Value *finalValue() const { return _final; }
+    Value *bumpValue() const { return _bump; }
+    Builder *loopBody() const { return _loopBody; }
+    Builder *loopBreak() const { return _loopBreak; }
+    Builder *loopContinue() const { return _loopContinue; }
 
     virtual int32_t numSymbols() const { return 1; }
     virtual Symbol * symbol(int32_t i=0) const {
@@ -261,6 +276,12 @@ public:
         return SymbolIterator(_loopVariable);
     }
 
+    // the loop variable is set before the first iteration (it is also read and set by the test
+    // after each iteration, which happens in the loop's builders rather than at this operation)
+    virtual int32_t numWrittenSymbols() const { return 1; }
+    virtual Symbol * writtenSymbol(int i=0) const { return (i == 0) ? _loopVariable : NULL; }
+    virtual SymbolIterator WrittenSymbolsBegin() { return SymbolIterator(_loopVariable); }
+
     virtual int32_t numOperands() const { return 3; }
     virtual Value * operand(int32_t i=0) const {
         if (i == 0) return _initial;
@@ -334,6 +355,52 @@ protected:
     Value * _value;
     };
 
+// Switch transfers control to the target of the case whose value equals the selector, or to the
+// default target if no case value does. literal(c) is the value of case c and builder(c+1) is its
+// target; builder(0) is the default target
+class Op_Switch : public OperationR0V1 {
+    friend class BaseExtension;
+
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void write(TextWriter &w) const;
+    virtual void jbgen(JB1MethodBuilder *j1mb) const;
+
+    virtual LiteralIterator LiteralsBegin()       { return LiteralIterator(_caseValues); }
+    virtual int32_t numLiterals() const           { return _caseValues.size(); }
+    virtual Literal * literal(int i=0) const {
+        if (i < _caseValues.size()) return _caseValues[i];
+        return NULL;
+    }
+
+    virtual BuilderIterator BuildersBegin()       { return BuilderIterator(_targets); }
+    virtual int32_t numBuilders() const           { return _targets.size(); }
+    virtual Builder * builder(int i=0) const {
+        if (i < _targets.size()) return _targets[i];
+        return NULL;
+    }
+
+    Value *selector() const                       { return _value; }
+    Builder *defaultTarget() const                { return _targets[0]; }
+    int32_t numCases() const                      { return _caseValues.size(); }
+    Literal *caseValue(int32_t c) const           { return _caseValues[c]; }
+    Builder *caseTarget(int32_t c) const          { return _targets[c+1]; }
+
+    // how the selector should be dispatched, chosen from the density of the case values
+    enum Dispatch {
+        JumpTable,      // case values cover most of their range: index a table of targets
+        BitTests,       // few distinct targets over a range no wider than 64: test one mask per target
+        BinarySearch    // sparse case values: compare against the middle case value and search that half
+    };
+    Dispatch dispatch() const;
+
+protected:
+    Op_Switch(LOCATION, Extension *ext, Builder * parent, ActionID aSwitch, Value *selector, Builder *defaultTarget, int32_t numCases, Literal **caseValues, Builder **caseTargets);
+
+    std::vector<Literal *> _caseValues;
+    std::vector<Builder *> _targets;
+};
+
 #if 0
 // keep handy during migration
 
@@ -0,0 +1,258 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "BaseExtension.hpp"
+#include "BaseTypes.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "DivisionByConstant.hpp"
+#include "Literal.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "Value.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+DivisionByConstant::DivisionByConstant(Compiler *compiler)
+    : Transformer(compiler, std::string("DivisionByConstant"))
+    , _base(compiler->lookupExtension<BaseExtension>()) {
+
+}
+
+void
+DivisionByConstant::visitPreCompilation(Compilation * comp) {
+    setTraceEnabled(_comp->config()->traceDivisionByConstant());
+}
+
+Literal *
+DivisionByConstant::constantDivisor(Value *v) {
+    const Operation *def = v->definition();
+    if (def == NULL || def->action() != _base->aConst)
+        return NULL;
+    return def->literal();
+}
+
+static bool
+isPowerOfTwo(uint64_t v) {
+    return v != 0 && (v & (v - 1)) == 0;
+}
+
+static int32_t
+log2Floor(uint64_t v) {
+    int32_t l = -1;
+    while (v != 0) {
+        v >>= 1;
+        l++;
+    }
+    return l;
+}
+
+Builder *
+DivisionByConstant::transformOperation(Operation * op) {
+    ActionID a = op->action();
+    bool isUnsigned = (a == _base->aUnsignedDiv || a == _base->aUnsignedRem);
+    bool isRem = (a == _base->aRem || a == _base->aUnsignedRem);
+    if (!isUnsigned && !isRem && a != _base->aDiv)
+        return NULL;
+
+    // narrower integer types are left to the code generator
+    const Type *type = op->result()->type();
+    if (type != _base->Int32 && type != _base->Int64)
+        return NULL;
+
+    Literal *divisor = constantDivisor(op->operand(1));
+    if (divisor == NULL)
+        return NULL;
+
+    int32_t bits = type->size();
+    uint64_t mask = (bits == 64) ? ~(uint64_t)0 : (((uint64_t)1 << bits) - 1);
+    int64_t d = divisor->getInteger();
+    uint64_t ud = ((uint64_t) d) & mask;
+    if (ud == 0 || ud == 1 || (!isUnsigned && ud == mask))
+        return NULL;
+
+    Builder *scratch = _base->OrphanBuilder(LOC, op->parent());
+    Value *x = op->operand(0);
+    if (isUnsigned && isRem && isPowerOfTwo(ud)) {
+        _base->And(LOC, scratch, x, constant(scratch, type, ud - 1));
+    } else {
+        Value *q = isUnsigned ? unsignedQuotient(scratch, x, ud) : signedQuotient(scratch, x, d);
+        if (isRem)
+            _base->Sub(LOC, scratch, x, _base->Mul(LOC, scratch, q, constant(scratch, type, d)));
+    }
+
+    // the last operation computes the result: replace it with one that defines op's result Value
+    Operation *last = scratch->operations().back();
+    Builder *b = _base->OrphanBuilder(LOC, op->parent());
+    for (OperationIterator opIt = scratch->OperationsBegin(); opIt != scratch->OperationsEnd(); opIt++) {
+        Operation *o = *opIt;
+        if (o == last) {
+            OperationCloner cloner(o);
+            cloner.changeResult(op->result());
+            b->appendClone(o, &cloner);
+        } else {
+            b->appendClone(o);
+        }
+    }
+    return b;
+}
+
+Value *
+DivisionByConstant::signedQuotient(Builder *b, Value *x, int64_t d) {
+    const Type *type = x->type();
+    int32_t bits = type->size();
+    uint64_t ad = (d < 0) ? -(uint64_t)d : (uint64_t)d;
+    if (bits < 64)
+        ad &= ((uint64_t)1 << bits) - 1;
+
+    if (isPowerOfTwo(ad)) {
+        // shifting rounds toward negative infinity, so first add 2^k-1 to negative dividends
+        int32_t k = log2Floor(ad);
+        Value *sign = _base->ShiftR(LOC, b, x, shiftAmount(b, bits - 1));
+        Value *bias = _base->UnsignedShiftR(LOC, b, sign, shiftAmount(b, bits - k));
+        Value *q = _base->ShiftR(LOC, b, _base->Add(LOC, b, x, bias), shiftAmount(b, k));
+        if (d < 0)
+            q = _base->Sub(LOC, b, constant(b, type, 0), q);
+        return q;
+    }
+
+    int64_t multiplier;
+    int32_t shift;
+    signedMagic(d, bits, multiplier, shift);
+    Value *q = _base->MulHigh(LOC, b, x, constant(b, type, multiplier));
+    if (d > 0 && multiplier < 0)
+        q = _base->Add(LOC, b, q, x);
+    else if (d < 0 && multiplier > 0)
+        q = _base->Sub(LOC, b, q, x);
+    if (shift > 0)
+        q = _base->ShiftR(LOC, b, q, shiftAmount(b, shift));
+
+    // round toward zero by adding one to a negative quotient
+    return _base->Add(LOC, b, q, _base->UnsignedShiftR(LOC, b, q, shiftAmount(b, bits - 1)));
+}
+
+Value *
+DivisionByConstant::unsignedQuotient(Builder *b, Value *x, uint64_t d) {
+    const Type *type = x->type();
+    int32_t bits = type->size();
+    if (isPowerOfTwo(d))
+        return _base->UnsignedShiftR(LOC, b, x, shiftAmount(b, log2Floor(d)));
+
+    // q = (t + ((x - t) >> 1)) >> (l-1) where t is the high half of x * multiplier, which
+    // cannot overflow even though the multiplier may need bits+1 bits
+    int32_t shift;
+    uint64_t multiplier = unsignedMagic(d, bits, shift);
+    Value *t = _base->UnsignedMulHigh(LOC, b, x, constant(b, type, multiplier));
+    Value *half = _base->UnsignedShiftR(LOC, b, _base->Sub(LOC, b, x, t), shiftAmount(b, 1));
+    return _base->UnsignedShiftR(LOC, b, _base->Add(LOC, b, t, half), shiftAmount(b, shift));
+}
+
+// Computes the multiplier M and shift s such that x / d == (MulHigh(x, M) [+ or - x]) >> s
+// (before the final rounding adjustment) for every signed integer x with the given number of
+// bits; d must not be 0, 1, -1 or a power of two. This is magic() from Hacker's Delight 10-1,
+// computed in unsigned arithmetic modulo 2^bits.
+void
+DivisionByConstant::signedMagic(int64_t d, int32_t bits, int64_t & multiplier, int32_t & shift) {
+    uint64_t mask = (bits == 64) ? ~(uint64_t)0 : (((uint64_t)1 << bits) - 1);
+    uint64_t twoN1 = (uint64_t)1 << (bits - 1);
+    uint64_t ad = ((d < 0) ? -(uint64_t)d : (uint64_t)d) & mask;
+    uint64_t t = twoN1 + ((((uint64_t)d) & mask) >> (bits - 1));
+    uint64_t anc = t - 1 - t % ad;     // absolute value of nc
+    int32_t p = bits - 1;
+    uint64_t q1 = twoN1 / anc;         // 2^p / |nc|
+    uint64_t r1 = twoN1 - q1 * anc;    // 2^p % |nc|
+    uint64_t q2 = twoN1 / ad;          // 2^p / |d|
+    uint64_t r2 = twoN1 - q2 * ad;     // 2^p % |d|
+    uint64_t delta;
+    do {
+        p++;
+        q1 = (2 * q1) & mask;
+        r1 = (2 * r1) & mask;
+        if (r1 >= anc) {
+            q1++;
+            r1 -= anc;
+        }
+        q2 = (2 * q2) & mask;
+        r2 = (2 * r2) & mask;
+        if (r2 >= ad) {
+            q2++;
+            r2 -= ad;
+        }
+        delta = ad - r2;
+    } while (q1 < delta || (q1 == delta && r1 == 0));
+
+    uint64_t m = (q2 + 1) & mask;
+    if (d < 0)
+        m = (-m) & mask;
+
+    // sign extend the bits-wide multiplier
+    if (bits < 64 && (m & twoN1) != 0)
+        m |= ~mask;
+    multiplier = (int64_t) m;
+    shift = p - bits;
+}
+
+// Computes the multiplier m (which fits in bits bits) and the shift l-1 used by unsignedQuotient,
+// where l = ceil(log2(d)) and m = floor(2^bits * (2^l - d) / d) + 1; d must not be 0 or a power of two.
+uint64_t
+DivisionByConstant::unsignedMagic(uint64_t d, int32_t bits, int32_t & shift) {
+    uint64_t mask = (bits == 64) ? ~(uint64_t)0 : (((uint64_t)1 << bits) - 1);
+    int32_t l = log2Floor(d) + 1;
+    uint64_t r = (l == 64) ? (0 - d) : (((uint64_t)1 << l) - d); // < d
+
+    // long division of r * 2^bits by d, one bit at a time; r < d so r*2 - d fits even if r*2 does not
+    uint64_t q = 0;
+    for (int32_t i=0;i < bits;i++) {
+        bool carry = (r >> 63) != 0;
+        r <<= 1;
+        q <<= 1;
+        if (carry || r >= d) {
+            r -= d;
+            q |= 1;
+        }
+    }
+
+    shift = l - 1;
+    return (q + 1) & mask;
+}
+
+Value *
+DivisionByConstant::constant(Builder *b, const Type *type, int64_t v) {
+    if (type == _base->Int32)
+        return _base->ConstInt32(LOC, b, (int32_t) v);
+    assert(type == _base->Int64);
+    return _base->ConstInt64(LOC, b, v);
+}
+
+Value *
+DivisionByConstant::shiftAmount(Builder *b, int32_t amount) {
+    return _base->ConstInt32(LOC, b, amount);
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#ifndef DIVISIONBYCONSTANT_INCL
+#define DIVISIONBYCONSTANT_INCL
+
+#include <stdint.h>
+#include "Transformer.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class Compiler;
+class Literal;
+class Operation;
+class Type;
+class Value;
+
+namespace Base {
+
+class BaseExtension;
+
+// DivisionByConstant replaces Int32 and Int64 Div, Rem, UnsignedDiv and UnsignedRem operations
+// whose divisor is a Const with cheaper sequences: division by a power of two becomes shifts
+// (plus a rounding adjustment for signed values) or a mask, and any other divisor becomes a
+// multiplication by a "magic number" using MulHigh or UnsignedMulHigh followed by shifts (see
+// Hacker's Delight, chapter 10, and Granlund and Montgomery, "Division by Invariant Integers
+// using Multiplication"). A remainder is computed as x - q*d from the quotient q. Divisors of
+// 0, 1 and -1 are left alone.
+class DivisionByConstant : public Transformer {
+public:
+    DivisionByConstant(Compiler *compiler);
+
+protected:
+    virtual void visitPreCompilation(Compilation * comp);
+    virtual Builder * transformOperation(Operation * op);
+
+    Literal * constantDivisor(Value *v);
+    Value * signedQuotient(Builder *b, Value *x, int64_t d);
+    Value * unsignedQuotient(Builder *b, Value *x, uint64_t d);
+    void signedMagic(int64_t d, int32_t bits, int64_t & multiplier, int32_t & shift);
+    uint64_t unsignedMagic(uint64_t d, int32_t bits, int32_t & shift);
+    Value * constant(Builder *b, const Type *type, int64_t v);
+    Value * shiftAmount(Builder *b, int32_t amount);
+
+    BaseExtension *_base;
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(DIVISIONBYCONSTANT_INCL)
+
@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "BaseExtension.hpp"
+#include "BaseTypes.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "ControlFlowGraph.hpp"
+#include "EscapeAnalysis.hpp"
+#include "Literal.hpp"
+#include "Operation.hpp"
+#include "Value.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+bool
+EscapeAnalysis::isArray(Operation *create) const {
+    return create->action() == _base->aCreateLocalArray;
+}
+
+int64_t
+EscapeAnalysis::numElements(Operation *create) const {
+    return create->literal()->getInteger();
+}
+
+// true if two fields of structType share any bits (as the fields of a union do), in which case a
+// store to one field changes the others and they cannot each be held in their own LocalSymbol
+bool
+EscapeAnalysis::hasOverlappingFields(const StructType *structType) const {
+    for (auto it1 = structType->FieldsBegin(); it1 != structType->FieldsEnd(); it1++) {
+        const FieldType *f1 = it1->second;
+        for (auto it2 = structType->FieldsBegin(); it2 != it1; it2++) {
+            const FieldType *f2 = it2->second;
+            if (f1->offset() < f2->offset() + f2->type()->size() && f2->offset() < f1->offset() + f1->type()->size())
+                return true;
+        }
+    }
+    return false;
+}
+
+// true if op using address as its o'th operand keeps create's memory from escaping
+bool
+EscapeAnalysis::isAllowedUse(Operation *op, int32_t o, Operation *create, Value *address) {
+    ActionID a = op->action();
+    if (!isArray(create)) {
+        if (o != 0 || (a != _base->aLoadFieldAt && a != _base->aStoreFieldAt))
+            return false;
+        const FieldType *field = static_cast<const FieldType *>(op->type());
+        return !field->type()->isKind<StructType>();
+    }
+
+    if (o != 0)
+        return false;
+    if (a == _base->aLoadAt || a == _base->aStoreAt)
+        return true;
+    if (a != _base->aIndexAt)
+        return false;
+
+    const Operation *def = op->operand(1)->definition();
+    if (def == NULL || def->action() != _base->aConst)
+        return false;
+    int64_t index = _elements[address] + def->literal()->getInteger();
+    if (index < 0 || index >= numElements(create))
+        return false;
+    _aggregates[op->result()] = create;
+    _elements[op->result()] = index;
+    return true;
+}
+
+void
+EscapeAnalysis::analyze(Compilation *comp, int32_t maxElements) {
+    _maxElements = maxElements;
+    _aggregates.clear();
+    _elements.clear();
+    _escaped.clear();
+    _nonEscaping.clear();
+
+    // definitions dominate their uses, so each pointer is classified before it is used
+    std::vector<Operation *> candidates;
+    const BuilderVector & rpo = comp->cfg()->reversePostOrder();
+    for (auto it = rpo.begin(); it != rpo.end(); it++) {
+        Builder *b = *it;
+        for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+            Operation *op = *opIt;
+            for (int32_t o=0;o < op->numOperands();o++) {
+                Value *v = op->operand(o);
+                auto found = _aggregates.find(v);
+                if (found == _aggregates.end())
+                    continue;
+                Operation *create = found->second;
+                if (_escaped.find(create) == _escaped.end() && !isAllowedUse(op, o, create, v))
+                    _escaped.insert(create);
+            }
+
+            if (op->action() == _base->aCreateLocalStruct) {
+                if (!hasOverlappingFields(static_cast<const StructType *>(op->type()))) {
+                    candidates.push_back(op);
+                    _aggregates[op->result()] = op;
+                }
+            }
+            else if (op->action() == _base->aCreateLocalArray) {
+                const PointerType *pElementType = static_cast<const PointerType *>(op->type());
+                int64_t n = numElements(op);
+                if (n > 0 && n <= _maxElements && !pElementType->baseType()->isKind<StructType>()) {
+                    candidates.push_back(op);
+                    _aggregates[op->result()] = op;
+                    _elements[op->result()] = 0;
+                }
+            }
+        }
+    }
+
+    for (auto it = candidates.begin(); it != candidates.end(); it++) {
+        if (_escaped.find(*it) == _escaped.end())
+            _nonEscaping.push_back(*it);
+    }
+}
+
+bool
+EscapeAnalysis::escapes(Operation *create) const {
+    if (create->numResults() == 0 || _aggregates.find(create->result()) == _aggregates.end())
+        return true; // not a candidate
+    return _escaped.find(create) != _escaped.end();
+}
+
+Operation *
+EscapeAnalysis::aggregate(Value *address) const {
+    auto found = _aggregates.find(address);
+    if (found == _aggregates.end() || _escaped.find(found->second) != _escaped.end())
+        return NULL;
+    return found->second;
+}
+
+int64_t
+EscapeAnalysis::elementIndex(Value *address) const {
+    auto found = _elements.find(address);
+    if (found == _elements.end())
+        return 0;
+    return found->second;
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
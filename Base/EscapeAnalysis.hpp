@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+
+#ifndef ESCAPEANALYSIS_INCL
+#define ESCAPEANALYSIS_INCL
+
+#include <stdint.h>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace OMR {
+namespace JitBuilder {
+
+class Compilation;
+class Operation;
+class Value;
+
+namespace Base {
+
+class BaseExtension;
+class StructType;
+
+// EscapeAnalysis finds the local aggregates (CreateLocalStruct of a struct whose fields do not
+// overlap, so not a union, and CreateLocalArray with at most the maxElements given to analyze())
+// whose memory is only ever accessed directly: a struct's pointer may only be used as the struct
+// operand of LoadFieldAt and StoreFieldAt (of fields that are not structs), and an array's pointer may only be used as the address of LoadAt and StoreAt
+// or as the base of an IndexAt by a literal index within the array, whose result is used the same
+// way. Any other use (storing the pointer, passing it to a Call, comparing it, merging it, ...)
+// lets the memory escape. Memory that does not escape can only be reached through those accesses,
+// so each field or element can be held in its own LocalSymbol (see ScalarReplacement).
+class EscapeAnalysis {
+public:
+    EscapeAnalysis(BaseExtension *base)
+        : _base(base)
+        , _maxElements(0) {
+
+    }
+
+    void analyze(Compilation *comp, int32_t maxElements);
+
+    // the CreateLocalStruct or CreateLocalArray operations whose memory does not escape
+    const std::vector<Operation *> & nonEscaping() const { return _nonEscaping; }
+    bool escapes(Operation *create) const;
+
+    // for a pointer into non escaping memory: the operation that created the memory, or NULL,
+    // and (for arrays) the index of the element it points to
+    Operation *aggregate(Value *address) const;
+    int64_t elementIndex(Value *address) const;
+
+protected:
+    bool isArray(Operation *create) const;
+    int64_t numElements(Operation *create) const;
+    bool hasOverlappingFields(const StructType *structType) const;
+    bool isAllowedUse(Operation *op, int32_t o, Operation *create, Value *address);
+
+    BaseExtension *_base;
+    int32_t _maxElements;
+    std::map<Value *,Operation *> _aggregates;  // pointers into candidate aggregates
+    std::map<Value *,int64_t> _elements;        // element index of each array pointer
+    std::set<Operation *> _escaped;
+    std::vector<Operation *> _nonEscaping;
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(ESCAPEANALYSIS_INCL)
@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <vector>
+#include "BaseExtension.hpp"
+#include "BaseTypes.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "FMAContraction.hpp"
+#include "Function.hpp"
+#include "FunctionCompilation.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "Value.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+FMAContraction::FMAContraction(Compiler *compiler)
+    : Transformer(compiler, std::string("FMAContraction"))
+    , _base(compiler->lookupExtension<BaseExtension>()) {
+
+}
+
+void
+FMAContraction::visitPreCompilation(Compilation * comp) {
+    setTraceEnabled(_comp->config()->traceFMAContraction());
+
+    Function *func = static_cast<FunctionCompilation *>(comp)->func();
+    Function::FPContractionMode mode = func->fpContractionMode();
+    if (mode == Function::FPContractOff)
+        return;
+
+    // decide every contraction up front: a Mul appears before the Add or Sub that uses it,
+    // so whether it can be removed must be known before the Add or Sub is transformed
+    std::vector<Operation *> candidates;
+    for (BuilderIterator bIt = comp->buildersBegin(); bIt != comp->buildersEnd(); bIt++) {
+        Builder *b = *bIt;
+        for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+            Operation *op = *opIt;
+            for (int32_t o=0;o < op->numOperands();o++)
+                _numUses[op->operand(o)]++;
+            if (op->action() == _base->aMul)
+                _muls[op->result()] = op;
+            if (op->action() == _base->aAdd || op->action() == _base->aSub)
+                candidates.push_back(op);
+        }
+    }
+
+    std::map<Operation *,int32_t> numFused;
+    for (auto it = candidates.begin(); it != candidates.end(); it++) {
+        Operation *op = *it;
+        Operation *mul = fusableMul(op, op->operand(0));
+        if (mul == NULL)
+            mul = fusableMul(op, op->operand(1));
+        if (mul == NULL)
+            continue;
+        if (mode == Function::FPContractOn && _numUses[mul->result()] != 1)
+            continue; // the product would still be computed (and rounded) for its other uses
+        _contractions[op] = mul;
+        numFused[mul]++;
+    }
+
+    for (auto it = numFused.begin(); it != numFused.end(); it++) {
+        Operation *mul = it->first;
+        if (it->second == _numUses[mul->result()])
+            _deadMuls.insert(mul);
+    }
+}
+
+Operation *
+FMAContraction::fusableMul(Operation *op, Value *v) {
+    const Type *type = v->type();
+    if (type != _base->Float32 && type != _base->Float64)
+        return NULL;
+
+    auto found = _muls.find(v);
+    if (found == _muls.end() || v->definition() != found->second)
+        return NULL; // not a Mul, or v also has other definitions
+    Operation *mul = found->second;
+
+    // the Mul's operands must also be available where op is
+    if (mul->parent() != op->parent())
+        return NULL;
+
+    return mul;
+}
+
+Builder *
+FMAContraction::transformOperation(Operation * op) {
+    if (_deadMuls.find(op) != _deadMuls.end())
+        return _base->OrphanBuilder(LOC, op->parent()); // every use is fused, so remove it
+
+    auto found = _contractions.find(op);
+    if (found == _contractions.end())
+        return NULL;
+
+    Operation *mul = found->second;
+    if (mul->result() == op->operand(0))
+        return contract(op, mul, op->operand(1), true);
+    return contract(op, mul, op->operand(0), false);
+}
+
+Builder *
+FMAContraction::contract(Operation *op, Operation *mul, Value *other, bool mulIsLeft) {
+    // create the fused operation so that it defines the same result Value as op
+    Builder *scratch = _base->OrphanBuilder(LOC, op->parent());
+    Value *left = mul->operand(0);
+    Value *right = mul->operand(1);
+    if (op->action() == _base->aAdd)
+        _base->FMA(LOC, scratch, left, right, other);
+    else if (mulIsLeft)
+        _base->FMS(LOC, scratch, left, right, other);
+    else
+        _base->FNMA(LOC, scratch, left, right, other);
+    Operation *fused = scratch->operations().back();
+
+    OperationCloner cloner(fused);
+    cloner.changeResult(op->result());
+    Builder *b = _base->OrphanBuilder(LOC, op->parent());
+    b->appendClone(fused, &cloner);
+    return b;
+}
+
+void
+FMAContraction::visitPostCompilation(Compilation * comp) {
+    _numUses.clear();
+    _muls.clear();
+    _contractions.clear();
+    _deadMuls.clear();
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
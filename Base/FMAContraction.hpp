@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#ifndef FMACONTRACTION_INCL
+#define FMACONTRACTION_INCL
+
+#include <map>
+#include <set>
+#include "Transformer.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class Compiler;
+class Operation;
+class Value;
+
+namespace Base {
+
+class BaseExtension;
+
+// FMAContraction fuses a floating point Mul whose result is an operand of an Add or Sub into
+// an FMA, FMS or FNMA operation, as allowed by the Function's fpContractionMode(). Because
+// the fused operation may round once (see BaseExtension::FMA), contracting can change results,
+// so nothing is fused when the mode is FPContractOff. A Mul is removed once all of its uses
+// have been fused.
+class FMAContraction : public Transformer {
+public:
+    FMAContraction(Compiler *compiler);
+
+protected:
+    virtual void visitPreCompilation(Compilation * comp);
+    virtual Builder * transformOperation(Operation * op);
+    virtual void visitPostCompilation(Compilation * comp);
+
+    Operation * fusableMul(Operation *op, Value *v);
+    Builder * contract(Operation *op, Operation *mul, Value *other, bool mulIsLeft);
+
+    BaseExtension *_base;
+    std::map<Value *,int32_t> _numUses;
+    std::map<Value *,Operation *> _muls;
+    std::map<Operation *,Operation *> _contractions; // Add or Sub to the Mul fused into it
+    std::set<Operation *> _deadMuls;
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(FMACONTRACTION_INCL)
+
@@ -51,9 +51,13 @@ Function::Function(Compiler *compiler) // , int32_t numEntries)
     , _numEntryPoints(1)
     , _entryPoints(new Builder *[1])
     , _nativeEntryPoints(new void *[1])
-    , _debugEntryPoints(new void *[1]) {
+    , _debugEntryPoints(new void *[1])
+    , _allowReassociation(false)
+    , _fpContractionMode(FPContractOff)
+    , _profile(NULL) {
 
     _entryPoints[0] = Builder::create(_comp, _nativeContext); //, "Entry");
+    _nativeEntryPoints[0] = NULL;
     _ext->SourceLocation(LOC, _entryPoints[0], ""); // make sure everything has a location; by default BCIndex is 0
 }
 
@@ -67,13 +71,19 @@ Function::Function(Function *outerFunc) // , int32_t numEntries)
     , _numEntryPoints(1)
     , _entryPoints(new Builder *[1])
     , _nativeEntryPoints(new void *[1])
-    , _debugEntryPoints(new void *[1]) {
+    , _debugEntryPoints(new void *[1])
+    , _allowReassociation(outerFunc->_allowReassociation)
+    , _fpContractionMode(outerFunc->_fpContractionMode)
+    , _profile(NULL) {
 
     _entryPoints[0] = Builder::create(_comp, _nativeContext); //, "Entry");
+    _nativeEntryPoints[0] = NULL;
     _ext->SourceLocation(LOC, _entryPoints[0], ""); // make sure everything has a location; by default BCIndex is 0
 }
 
 Function::~Function() {
+    for (auto it = _outlinedFunctions.begin(); it != _outlinedFunctions.end(); it++)
+        delete *it;
     for (auto e=0;e < _numEntryPoints;e++)
         delete _entryPoints[e];
     delete[] _debugEntryPoints;
@@ -112,8 +122,8 @@ Function::DefineLine(std::string line) {
 }
 
 ParameterSymbol *
-Function::DefineParameter(std::string name, const Type * type) {
-    return this->_nativeContext->DefineParameter(name, type);
+Function::DefineParameter(std::string name, const Type * type, bool noAlias) {
+    return this->_nativeContext->DefineParameter(name, type, noAlias);
 }
 
 void
@@ -175,6 +185,21 @@ Function::DefineFunction(LOCATION,
     return internalDefineFunction(PASSLOC, name, fileName, lineNumber, entryPoint, returnType, numParms, copiedParmTypes);
 }
 
+FunctionSymbol *
+Function::DefineFunction(LOCATION, Function *callee) {
+    int32_t numParms = 0;
+    for (ParameterSymbolIterator pIt = callee->ParametersBegin(); pIt != callee->ParametersEnd(); pIt++)
+        numParms++;
+
+    const Type **parmTypes = new const Type*[numParms];
+    for (ParameterSymbolIterator pIt = callee->ParametersBegin(); pIt != callee->ParametersEnd(); pIt++) {
+        ParameterSymbol *parm = *pIt;
+        parmTypes[parm->index()] = parm->type();
+    }
+
+    return internalDefineFunction(PASSLOC, callee->name(), callee->fileName(), callee->lineNumber(), callee->nativeEntry<void *>(), callee->returnType(), numParms, parmTypes, callee);
+}
+
 void
 Function::DefineFunction(FunctionSymbol *function) {
     _functions.push_back(function);
@@ -189,10 +214,11 @@ Function::internalDefineFunction(LOCATION,
                                  void *entryPoint,
                                  const Type *returnType,
                                  int32_t numParms,
-                                 const Type **parmTypes) {
+                                 const Type **parmTypes,
+                                 Function *callee) {
 
     const FunctionType *type = _ext->DefineFunctionType(PASSLOC, _comp, returnType, numParms, parmTypes);
-    FunctionSymbol *sym = new FunctionSymbol(type, name, fileName, lineNumber, entryPoint);
+    FunctionSymbol *sym = new FunctionSymbol(type, name, fileName, lineNumber, entryPoint, callee);
     _functions.push_back(sym);
     return sym;
 }
@@ -393,7 +419,7 @@ Function::replaceTypes(TypeReplacer *repl) {
                     for (int i=0;i < parmTypeMapper->size();i++) {
                         std::string newName = baseName + parmTypeMapper->name();
                         const Type *newType = parmTypeMapper->next();
-                        ParameterSymbol *newSym = DefineParameter(newName, newType);
+                        ParameterSymbol *newSym = DefineParameter(newName, newType, parm->isNoAlias());
                         parmIndex++;
                         parmSymMapper->add(newSym);
                         repl->recordSymbolMapper(newSym, new SymbolMapper(newSym));
@@ -403,7 +429,7 @@ Function::replaceTypes(TypeReplacer *repl) {
             }
             else if (parmIndex > parm->index()) {
                 // no type change but recreate because parameter index needs to change due to early parameter expansion
-                ParameterSymbol *newSym = DefineParameter(parm->name(), parm->type());
+                ParameterSymbol *newSym = DefineParameter(parm->name(), parm->type(), parm->isNoAlias());
                 parmSymMapper->add(newSym);
                 parmIndex++;
             }
@@ -23,6 +23,7 @@
 #define FUNCTION_INCL
 
 #include <exception>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -46,11 +47,13 @@ class Operation;
 class Symbol;
 class TextWriter;
 class TypeDictionary;
+class Value;
 
 namespace Base {
 
 class Debugger;
 class FunctionCompilation;
+class FunctionProfile;
 class NativeCallableContext;
 
 class Function {
@@ -62,13 +65,47 @@ public:
     void DefineName(std::string name);
     void DefineFile(std::string file);
     void DefineLine(std::string line);
-    ParameterSymbol * DefineParameter(std::string name, const Type * type);
+    // noAlias gives a pointer parameter restrict semantics (see ParameterSymbol::isNoAlias())
+    ParameterSymbol * DefineParameter(std::string name, const Type * type, bool noAlias=false);
     void DefineReturnType(const Type * type);
     LocalSymbol * DefineLocal(std::string name, const Type * type);
+    void DefineLocal(LocalSymbol *local);
     FunctionSymbol * DefineFunction(LOCATION, std::string name, std::string fileName, std::string lineNumber, void *entryPoint, const Type *returnType, int32_t numParms, ...);
     FunctionSymbol * DefineFunction(LOCATION, std::string name, std::string fileName, std::string lineNumber, void *entryPoint, const Type *returnType, int32_t numParms, const Type **parmTypes);
+    // callee must already have been compiled; calls to the returned symbol can be inlined
+    FunctionSymbol * DefineFunction(LOCATION, Function *callee);
+    void DefineFunction(FunctionSymbol *function);
     const PointerType * PointerTo(LOCATION, const Type *baseType);
 
+    // when true, transformations may reassociate arithmetic (e.g. to vectorize a reduction),
+    // which can change the results of floating point computations
+    void AllowReassociation(bool allow=true) { _allowReassociation = allow; }
+    bool allowsReassociation() const { return _allowReassociation; }
+
+    // controls whether a floating point Mul feeding an Add or Sub may be fused into one operation
+    // that may round once (like C's FP_CONTRACT): Off never fuses, On fuses only when the product has
+    // no other use, and Fast fuses even when the product must also be computed separately
+    enum FPContractionMode {
+        FPContractOff,
+        FPContractOn,
+        FPContractFast
+    };
+    void SetFPContractionMode(FPContractionMode mode) { _fpContractionMode = mode; }
+    FPContractionMode fpContractionMode() const { return _fpContractionMode; }
+
+    // asserts that the memory pointer points into is not accessed through any pointer that is
+    // not derived from it (restrict semantics for a pointer Value rather than a parameter)
+    void AssumeNoAlias(Value *pointer) { _noAliasValues.insert(pointer); }
+    bool assumesNoAlias(Value *pointer) const { return _noAliasValues.find(pointer) != _noAliasValues.end(); }
+
+    // execution counts collected by ProfileInstrumentation in a compilation of an identically built
+    // Function, used by ProfileFeedback and other passes to optimize this compilation (not owned)
+    void SetProfile(FunctionProfile *profile) { _profile = profile; }
+    FunctionProfile *profile() const { return _profile; }
+
+    // Functions holding code moved out of this one (see Outliner), deleted along with it
+    void addOutlinedFunction(Function *outlined) { _outlinedFunctions.push_back(outlined); }
+
     std::string name() const { return _givenName; }
     std::string fileName() const { return _fileName; }
     std::string lineNumber() const { return _lineNumber; }
@@ -115,6 +152,9 @@ public:
 
     CompilerReturnCode Compile(TextWriter *logger=NULL, StrategyID strategy=NoStrategy);
 
+    // false until code has been generated for the entry point
+    bool hasNativeEntry(int i=0) const { return i < _numEntryPoints && _nativeEntryPoints[i] != NULL; }
+
     template<typename T>
     T nativeEntry(int i=0) const {
         assert(i < _numEntryPoints);
@@ -157,9 +197,7 @@ protected:
     Function(Function *outerFunction);
 
     void DefineParameter(ParameterSymbol *parm);
-    void DefineLocal(LocalSymbol *local);
-    void DefineFunction(FunctionSymbol *function);
-    FunctionSymbol * internalDefineFunction(LOCATION, std::string name, std::string fileName, std::string lineNumber, void *entryPoint, const Type *returnType, int32_t numParms, const Type **parmTypes);
+    FunctionSymbol * internalDefineFunction(LOCATION, std::string name, std::string fileName, std::string lineNumber, void *entryPoint, const Type *returnType, int32_t numParms, const Type **parmTypes, Function *callee=NULL);
     void addInitialBuildersToWorklist(BuilderWorklist & worklist);
 
     #if 0
@@ -187,6 +225,12 @@ protected:
     void                 ** _debugEntryPoints;
     Debugger              * _debuggerObject;
 
+    bool                    _allowReassociation;
+    FPContractionMode       _fpContractionMode;
+    std::set<Value *>       _noAliasValues;
+    FunctionProfile       * _profile;
+    std::vector<Function *> _outlinedFunctions;
+
     static FunctionSymbolIterator endFunctionIterator;
 };
 
@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <assert.h>
+#include "FunctionProfile.hpp"
+#include "Operation.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+void
+FunctionProfile::reset() {
+    delete[] _counters;
+    _counters = NULL;
+    _numCounters = 0;
+    _builderIndex.clear();
+    _branchIndex.clear();
+    _loopIndex.clear();
+}
+
+void
+FunctionProfile::addBuilder(BuilderID id) {
+    assert(_counters == NULL);
+    if (_builderIndex.find(id) == _builderIndex.end())
+        _builderIndex[id] = _numCounters++;
+}
+
+void
+FunctionProfile::addBranch(OperationID id) {
+    assert(_counters == NULL);
+    if (_branchIndex.find(id) == _branchIndex.end()) {
+        _branchIndex[id] = _numCounters;
+        _numCounters += 2;
+    }
+}
+
+void
+FunctionProfile::addLoop(OperationID id) {
+    assert(_counters == NULL);
+    if (_loopIndex.find(id) == _loopIndex.end())
+        _loopIndex[id] = _numCounters++;
+}
+
+void
+FunctionProfile::allocate() {
+    assert(_counters == NULL);
+    _counters = new int64_t[_numCounters > 0 ? _numCounters : 1]();
+}
+
+int64_t *
+FunctionProfile::counter(const std::map<uint64_t,size_t> & index, uint64_t id, size_t offset) const {
+    if (_counters == NULL)
+        return NULL;
+    auto found = index.find(id);
+    if (found == index.end())
+        return NULL;
+    return _counters + found->second + offset;
+}
+
+int64_t
+FunctionProfile::count(const std::map<uint64_t,size_t> & index, uint64_t id, size_t offset) const {
+    int64_t *c = counter(index, id, offset);
+    if (c == NULL)
+        return -1;
+    return *c;
+}
+
+int64_t *
+FunctionProfile::builderCounter(BuilderID id) const {
+    return counter(_builderIndex, id);
+}
+
+int64_t *
+FunctionProfile::branchCounter(OperationID id) const {
+    return counter(_branchIndex, id);
+}
+
+int64_t *
+FunctionProfile::branchNotTakenCounter(OperationID id) const {
+    return counter(_branchIndex, id, 1);
+}
+
+int64_t *
+FunctionProfile::loopCounter(OperationID id) const {
+    return counter(_loopIndex, id);
+}
+
+bool
+FunctionProfile::hasData() const {
+    if (_counters == NULL)
+        return false;
+    for (size_t c=0;c < _numCounters;c++)
+        if (_counters[c] != 0)
+            return true;
+    return false;
+}
+
+int64_t
+FunctionProfile::builderCount(BuilderID id) const {
+    return count(_builderIndex, id);
+}
+
+int64_t
+FunctionProfile::branchCount(OperationID id) const {
+    return count(_branchIndex, id);
+}
+
+int64_t
+FunctionProfile::takenCount(OperationID id) const {
+    int64_t executed = count(_branchIndex, id);
+    if (executed < 0)
+        return -1;
+    return executed - count(_branchIndex, id, 1);
+}
+
+int64_t
+FunctionProfile::loopEntries(OperationID id) const {
+    return count(_loopIndex, id);
+}
+
+int8_t
+FunctionProfile::takenProbability(OperationID id) const {
+    int64_t executed = branchCount(id);
+    if (executed <= 0)
+        return Operation::UnknownProbability;
+    int64_t taken = takenCount(id);
+    if (taken < 0) // counters updated by racing threads
+        taken = 0;
+    else if (taken > executed)
+        taken = executed;
+    return (int8_t) ((taken * 100 + executed / 2) / executed);
+}
+
+int64_t
+FunctionProfile::averageTripCount(OperationID loopID, BuilderID bodyID) const {
+    int64_t entries = loopEntries(loopID);
+    int64_t iterations = builderCount(bodyID);
+    if (entries <= 0 || iterations < 0)
+        return -1;
+    return (iterations + entries / 2) / entries;
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#ifndef FUNCTIONPROFILE_INCL
+#define FUNCTIONPROFILE_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+#include <map>
+#include "IDs.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+// FunctionProfile holds the execution counters that ProfileInstrumentation adds to a Function's
+// compiled code: how many times each Builder was entered, how many times each IfCmp operation
+// executed and fell through without branching, and how many times each ForLoopUp loop was
+// entered. Counters are identified by the BuilderIDs and OperationIDs of the IL as it was built,
+// so a profile collected from one compilation only describes another compilation of a Function
+// that builds identical IL (see Function::SetProfile() and ProfileFeedback). Counters are not
+// updated atomically, so counts collected from several threads are approximate.
+//
+// Counters are added to the profile first, then allocate() creates the storage they live in;
+// their addresses do not change until the profile is reset() or destroyed, which must not happen
+// while code that increments them may still run.
+class FunctionProfile {
+public:
+    FunctionProfile()
+        : _counters(NULL)
+        , _numCounters(0) {
+
+    }
+    ~FunctionProfile() { reset(); }
+
+    // discard every counter
+    void reset();
+
+    void addBuilder(BuilderID id);
+    void addBranch(OperationID id);
+    void addLoop(OperationID id);
+    void allocate();
+
+    // addresses of the counters (NULL for ones that were not added), valid after allocate()
+    int64_t *builderCounter(BuilderID id) const;
+    int64_t *branchCounter(OperationID id) const;
+    int64_t *branchNotTakenCounter(OperationID id) const;
+    int64_t *loopCounter(OperationID id) const;
+
+    // true if any counter is non zero, i.e. the instrumented code has run
+    bool hasData() const;
+
+    // the counts, or -1 if there is no counter for id
+    int64_t builderCount(BuilderID id) const;
+    int64_t branchCount(OperationID id) const;
+    int64_t takenCount(OperationID id) const;
+    int64_t loopEntries(OperationID id) const;
+
+    // percentage of a branch's executions that branched (see Operation::takenProbability()),
+    // or Operation::UnknownProbability if the branch was not profiled or never executed
+    int8_t takenProbability(OperationID id) const;
+
+    // average iterations per entry of the loop loopID whose body is bodyID, or -1 if unknown
+    int64_t averageTripCount(OperationID loopID, BuilderID bodyID) const;
+
+protected:
+    int64_t count(const std::map<uint64_t,size_t> & index, uint64_t id, size_t offset=0) const;
+    int64_t *counter(const std::map<uint64_t,size_t> & index, uint64_t id, size_t offset=0) const;
+
+    std::map<uint64_t,size_t> _builderIndex;
+    std::map<uint64_t,size_t> _branchIndex; // two counters: executed, then not taken
+    std::map<uint64_t,size_t> _loopIndex;
+    int64_t *_counters;
+    size_t _numCounters;
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(FUNCTIONPROFILE_INCL)
@@ -0,0 +1,291 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "BaseExtension.hpp"
+#include "BaseTypes.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "IfConversion.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "Symbol.hpp"
+#include "Value.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+// most operations an arm may contain besides its Store and Goto; they execute on both paths
+static const int32_t MaxSpeculatedOperations = 4;
+
+IfConversion::IfConversion(Compiler *compiler)
+    : Transformer(compiler, std::string("IfConversion"))
+    , _base(compiler->lookupExtension<BaseExtension>()) {
+
+}
+
+void
+IfConversion::visitPreCompilation(Compilation * comp) {
+    setTraceEnabled(_comp->config()->traceIfConversion());
+
+    for (BuilderIterator bIt = comp->buildersBegin(); bIt != comp->buildersEnd(); bIt++) {
+        Builder *b = *bIt;
+        for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+            Operation *op = *opIt;
+            for (int32_t i=0;i < op->numBuilders();i++)
+                _numReferences[op->builder(i)]++;
+        }
+    }
+
+    // decide every conversion up front: the Goto following the IfCmp is only redirected to the
+    // merge if the IfCmp is converted
+    for (BuilderIterator bIt = comp->buildersBegin(); bIt != comp->buildersEnd(); bIt++) {
+        Builder *b = *bIt;
+        OperationVector & ops = b->operations();
+        for (size_t i=0;i+1 < ops.size();i++) {
+            Operation *ifCmp = ops[i];
+            Operation *gotoOp = ops[i+1];
+            if (!isIfCmp(ifCmp->action()) || gotoOp->action() != _base->aGoto)
+                continue;
+
+            Builder *taken = ifCmp->builder(0);
+            Builder *notTaken = gotoOp->builder(0);
+            Builder *thenMerge = NULL;
+            Builder *elseMerge = NULL;
+            Operation *thenStore = armStore(taken, thenMerge);
+            Operation *elseStore = armStore(notTaken, elseMerge);
+
+            Diamond d;
+            if (thenStore != NULL && elseStore != NULL) {
+                if (thenMerge != elseMerge || thenStore->symbol() != elseStore->symbol())
+                    continue;
+                d._thenArm = taken;
+                d._elseArm = notTaken;
+                d._merge = thenMerge;
+                d._symbol = thenStore->symbol();
+            }
+            else if (thenStore != NULL && notTaken == thenMerge) {
+                d._thenArm = taken;
+                d._elseArm = NULL;
+                d._merge = thenMerge;
+                d._symbol = thenStore->symbol();
+            }
+            else if (elseStore != NULL && taken == elseMerge) {
+                d._thenArm = NULL;
+                d._elseArm = notTaken;
+                d._merge = elseMerge;
+                d._symbol = elseStore->symbol();
+            }
+            else
+                continue;
+
+            if (!isSelectable(d._symbol->type()))
+                continue;
+
+            _diamonds[ifCmp] = d;
+            if (notTaken != d._merge)
+                _redirects[gotoOp] = d._merge;
+        }
+    }
+}
+
+bool
+IfConversion::isIfCmp(ActionID a) const {
+    return a == _base->aIfCmpEqual
+        || a == _base->aIfCmpEqualZero
+        || a == _base->aIfCmpGreaterThan
+        || a == _base->aIfCmpGreaterOrEqual
+        || a == _base->aIfCmpLessThan
+        || a == _base->aIfCmpLessOrEqual
+        || a == _base->aIfCmpNotEqual
+        || a == _base->aIfCmpNotEqualZero
+        || a == _base->aIfCmpUnsignedGreaterThan
+        || a == _base->aIfCmpUnsignedGreaterOrEqual
+        || a == _base->aIfCmpUnsignedLessThan
+        || a == _base->aIfCmpUnsignedLessOrEqual;
+}
+
+// operations that are safe to execute even on the path that did not originally execute them
+bool
+IfConversion::isSpeculatable(ActionID a) const {
+    return a == _base->aConst
+        || a == _base->aLoad
+        || a == _base->aAdd
+        || a == _base->aSub
+        || a == _base->aMul
+        || a == _base->aAnd
+        || a == _base->aOr
+        || a == _base->aXor
+        || a == _base->aNot
+        || a == _base->aShiftL
+        || a == _base->aShiftR
+        || a == _base->aUnsignedShiftR
+        || a == _base->aConvertTo
+        || a == _base->aEqualTo
+        || a == _base->aNotEqualTo
+        || a == _base->aLessThan
+        || a == _base->aLessOrEqualTo
+        || a == _base->aGreaterThan
+        || a == _base->aGreaterOrEqualTo
+        || a == _base->aSelect;
+}
+
+bool
+IfConversion::isSelectable(const Type *type) const {
+    return type == _base->Int8
+        || type == _base->Int16
+        || type == _base->Int32
+        || type == _base->Int64
+        || type == _base->Float32
+        || type == _base->Float64
+        || type == _base->Address
+        || type->isKind<PointerType>();
+}
+
+// returns the Store if arm is only reached from one operation and contains speculatable operations
+// followed by a Store of a value of the symbol's type and a Goto (whose target is returned in merge)
+Operation *
+IfConversion::armStore(Builder *arm, Builder * & merge) {
+    if (arm->isBound() || _numReferences[arm] != 1)
+        return NULL;
+
+    OperationVector & ops = arm->operations();
+    int32_t numOps = ops.size();
+    if (numOps < 2 || numOps - 2 > MaxSpeculatedOperations)
+        return NULL;
+
+    for (int32_t i=0;i < numOps - 2;i++) {
+        if (!isSpeculatable(ops[i]->action()))
+            return NULL;
+    }
+
+    Operation *store = ops[numOps - 2];
+    Operation *gotoOp = ops[numOps - 1];
+    if (store->action() != _base->aStore || gotoOp->action() != _base->aGoto)
+        return NULL;
+    if (store->operand()->type() != store->symbol()->type())
+        return NULL;
+
+    merge = gotoOp->builder(0);
+    if (merge == arm)
+        return NULL;
+    return store;
+}
+
+Builder *
+IfConversion::transformOperation(Operation * op) {
+    auto redirect = _redirects.find(op);
+    if (redirect != _redirects.end()) {
+        Builder *b = _base->OrphanBuilder(LOC, op->parent());
+        _base->Goto(LOC, b, redirect->second);
+        return b;
+    }
+
+    auto found = _diamonds.find(op);
+    if (found == _diamonds.end())
+        return NULL;
+    Diamond & d = found->second;
+
+    Builder *b = _base->OrphanBuilder(LOC, op->parent());
+    Value *trueValue = speculate(b, d._thenArm, d._symbol);
+    Value *falseValue = speculate(b, d._elseArm, d._symbol);
+    Value *selected = _base->Select(LOC, b, condition(b, op), trueValue, falseValue);
+    _base->Store(LOC, b, d._symbol, selected);
+    return b;
+}
+
+void
+IfConversion::visitPostCompilation(Compilation * comp) {
+    _numReferences.clear();
+    _diamonds.clear();
+    _redirects.clear();
+}
+
+// appends to b the value of condition that causes ifCmp to branch, as an Int32 that is 1 or 0
+Value *
+IfConversion::condition(Builder *b, Operation *ifCmp) {
+    ActionID a = ifCmp->action();
+    Value *left = ifCmp->operand(0);
+    if (a == _base->aIfCmpEqualZero)
+        return _base->EqualTo(LOC, b, left, _base->Zero(LOC, b, left->type()));
+    if (a == _base->aIfCmpNotEqualZero)
+        return _base->NotEqualTo(LOC, b, left, _base->Zero(LOC, b, left->type()));
+
+    Value *right = ifCmp->operand(1);
+    if (a == _base->aIfCmpEqual)
+        return _base->EqualTo(LOC, b, left, right);
+    if (a == _base->aIfCmpNotEqual)
+        return _base->NotEqualTo(LOC, b, left, right);
+    if (a == _base->aIfCmpGreaterThan)
+        return _base->GreaterThan(LOC, b, left, right);
+    if (a == _base->aIfCmpGreaterOrEqual)
+        return _base->GreaterOrEqualTo(LOC, b, left, right);
+    if (a == _base->aIfCmpLessThan)
+        return _base->LessThan(LOC, b, left, right);
+    if (a == _base->aIfCmpLessOrEqual)
+        return _base->LessOrEqualTo(LOC, b, left, right);
+    if (a == _base->aIfCmpUnsignedGreaterThan)
+        return _base->UnsignedGreaterThan(LOC, b, left, right);
+    if (a == _base->aIfCmpUnsignedGreaterOrEqual)
+        return _base->UnsignedGreaterOrEqualTo(LOC, b, left, right);
+    if (a == _base->aIfCmpUnsignedLessThan)
+        return _base->UnsignedLessThan(LOC, b, left, right);
+    assert(a == _base->aIfCmpUnsignedLessOrEqual);
+    return _base->UnsignedLessOrEqualTo(LOC, b, left, right);
+}
+
+// appends to b copies of the operations arm computes before its Store, and returns the copy of
+// the stored value; without an arm, the symbol keeps its current value
+Value *
+IfConversion::speculate(Builder *b, Builder *arm, Symbol *symbol) {
+    if (arm == NULL)
+        return _base->Load(LOC, b, symbol);
+
+    // the copies define new Values, so the arm (which is no longer reachable) still defines its own
+    std::map<Value *,Value *> copies;
+    OperationVector & ops = arm->operations();
+    for (size_t i=0;i+2 < ops.size();i++) {
+        Operation *o = ops[i];
+        OperationCloner cloner(o);
+        for (int32_t v=0;v < o->numOperands();v++) {
+            auto copy = copies.find(o->operand(v));
+            if (copy != copies.end())
+                cloner.changeOperand(copy->second, v);
+        }
+        if (o->numResults() > 0)
+            cloner.createResult(b);
+        b->appendClone(o, &cloner);
+        if (o->numResults() > 0)
+            copies[o->result()] = cloner.result();
+    }
+
+    Value *stored = ops[ops.size() - 2]->operand();
+    auto copy = copies.find(stored);
+    if (copy != copies.end())
+        return copy->second;
+    return stored;
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef IFCONVERSION_INCL
+#define IFCONVERSION_INCL
+
+#include <stdint.h>
+#include <map>
+#include "Transformer.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class Compiler;
+class Operation;
+class Symbol;
+class Type;
+class Value;
+
+namespace Base {
+
+class BaseExtension;
+
+// IfConversion replaces an if-then-else diamond whose only effect is to choose the value stored
+// to a symbol with a Select, so that no branch is needed:
+//
+//      b:     IfCmpX(b, thenB, left, right)   thenB: Store(sym, v1)       elseB: Store(sym, v2)
+//             Goto(b, elseB)                         Goto(thenB, merge)          Goto(elseB, merge)
+//
+// becomes Store(sym, Select(X(left, right), v1, v2)) and Goto(b, merge). Either arm may be
+// missing (the IfCmp or the Goto branches directly to merge), in which case the symbol's current
+// value is selected on that path. Because both arms are then evaluated, an arm may only contain
+// a few operations that cannot fail and have no side effects before its Store, and it must not
+// be the target of any other operation.
+class IfConversion : public Transformer {
+public:
+    IfConversion(Compiler *compiler);
+
+protected:
+    virtual void visitPreCompilation(Compilation * comp);
+    virtual Builder * transformOperation(Operation * op);
+    virtual void visitPostCompilation(Compilation * comp);
+
+    struct Diamond {
+        Builder *_thenArm; // NULL if the IfCmp branches directly to _merge
+        Builder *_elseArm; // NULL if the Goto branches directly to _merge
+        Builder *_merge;
+        Symbol *_symbol;
+    };
+
+    bool isIfCmp(ActionID a) const;
+    bool isSpeculatable(ActionID a) const;
+    bool isSelectable(const Type *type) const;
+    Operation * armStore(Builder *arm, Builder * & merge);
+    Value * condition(Builder *b, Operation *ifCmp);
+    Value * speculate(Builder *b, Builder *arm, Symbol *symbol);
+
+    BaseExtension *_base;
+    std::map<Builder *,int32_t> _numReferences;
+    std::map<Operation *,Diamond> _diamonds;     // IfCmp to the diamond it begins
+    std::map<Operation *,Builder *> _redirects;  // Goto to the merge it now branches to
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(IFCONVERSION_INCL)
@@ -0,0 +1,310 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <string>
+#include "BaseExtension.hpp"
+#include "BaseSymbols.hpp"
+#include "BaseTypes.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "ControlOperations.hpp"
+#include "Function.hpp"
+#include "FunctionCompilation.hpp"
+#include "Inliner.hpp"
+#include "Literal.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "TypeDictionary.hpp"
+#include "Value.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+Inliner::Inliner(Compiler *compiler)
+    : Transformer(compiler, std::string("Inliner"))
+    , _base(compiler->lookupExtension<BaseExtension>())
+    , _budget(0) {
+
+}
+
+void
+Inliner::visitPreCompilation(Compilation * comp) {
+    setTraceEnabled(_comp->config()->traceInliner());
+    _budget = _comp->config()->inlineBudget();
+
+    _knownTypes.clear();
+    _mappedTypes.clear();
+    TypeDictionary *dict = _comp->dict();
+    for (TypeIterator typeIt = dict->TypesBegin(); typeIt != dict->TypesEnd(); typeIt++)
+        _knownTypes.insert(*typeIt);
+}
+
+bool
+Inliner::isKnownType(const Type *type) {
+    return type == NULL || _knownTypes.find(type) != _knownTypes.end();
+}
+
+// returns the caller's Type for a Type used by a callee: pointer Types are created per compilation,
+// so a callee's pointer Type maps to the caller's pointer to the same base Type. NULL if there is none
+const Type *
+Inliner::mapType(const Type *type) {
+    if (isKnownType(type))
+        return type;
+
+    auto found = _mappedTypes.find(type);
+    if (found != _mappedTypes.end())
+        return found->second;
+
+    if (!type->isKind<PointerType>())
+        return NULL;
+
+    const Type *baseType = mapType(static_cast<const PointerType *>(type)->baseType());
+    if (baseType == NULL)
+        return NULL;
+
+    const Type *pointerType = _base->PointerTo(LOC, static_cast<FunctionCompilation *>(_comp), baseType);
+    _mappedTypes[type] = pointerType;
+    return pointerType;
+}
+
+// returns the number of operations in b and the builders bound to its operations, or -1 if they cannot be inlined
+int32_t
+Inliner::calleeSize(Function *callee, Builder *b, std::set<Builder *> & builders, std::set<Symbol *> & writtenSymbols, bool & needsMerge) {
+    Function *caller = static_cast<FunctionCompilation *>(_comp)->func();
+    builders.insert(b);
+
+    int32_t size = 0;
+    for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        size++;
+
+        if (op->action() == _base->aReturn) {
+            if (b != callee->builderEntry() || op != b->operations().back())
+                needsMerge = true;
+        }
+
+        for (int32_t r=0;r < op->numResults();r++) {
+            if (mapType(op->result(r)->type()) == NULL)
+                return -1;
+        }
+        for (int32_t t=0;t < op->numTypes();t++) {
+            if (mapType(op->type(t)) == NULL)
+                return -1;
+        }
+        for (int32_t l=0;l < op->numLiterals();l++) {
+            if (!isKnownType(op->literal(l)->type()))
+                return -1;
+        }
+
+        for (int32_t s=0;s < op->numSymbols();s++) {
+            Symbol *sym = op->symbol(s);
+            if (sym->isKind<FunctionSymbol>()) {
+                // the caller will need to declare the function, so it must know all its Types
+                const FunctionType *type = sym->refine<FunctionSymbol>()->functionType();
+                if (!isKnownType(type->returnType()))
+                    return -1;
+                for (int32_t p=0;p < type->numParms();p++) {
+                    if (!isKnownType(type->parmTypes()[p]))
+                        return -1;
+                }
+                Symbol *existing = caller->getSymbol(sym->name());
+                if (existing != NULL && existing != sym)
+                    return -1;
+            }
+            else if (!sym->isKind<LocalSymbol>() || mapType(sym->type()) == NULL) {
+                return -1;
+            }
+            else if (op->action() != _base->aLoad) {
+                writtenSymbols.insert(sym);
+            }
+        }
+
+        // bound builders are copied along with their operation, any other target must be one of them
+        for (int32_t i=0;i < op->numBuilders();i++) {
+            Builder *inner = op->builder(i);
+            if (inner->isBound() && inner->boundToOperation() == op)
+                builders.insert(inner);
+            else if (builders.find(inner) == builders.end())
+                return -1;
+        }
+        for (int32_t i=0;i < op->numBuilders();i++) {
+            Builder *inner = op->builder(i);
+            if (inner->isBound() && inner->boundToOperation() == op) {
+                int32_t innerSize = calleeSize(callee, inner, builders, writtenSymbols, needsMerge);
+                if (innerSize < 0)
+                    return -1;
+                size += innerSize;
+            }
+        }
+    }
+    return size;
+}
+
+Builder *
+Inliner::transformOperation(Operation * op) {
+    if (op->action() != _base->aCall || op->parent()->isCold())
+        return NULL;
+
+    FunctionSymbol *target = op->symbol()->refine<FunctionSymbol>();
+    Function *callee = target->function();
+    if (callee == NULL || callee == static_cast<FunctionCompilation *>(_comp)->func())
+        return NULL;
+
+    Builder *entry = callee->builderEntry();
+    if (entry->numOperations() == 0) // IL not built yet
+        return NULL;
+
+    std::set<Builder *> builders;
+    std::set<Symbol *> writtenSymbols;
+    bool needsMerge = false;
+    int32_t size = calleeSize(callee, entry, builders, writtenSymbols, needsMerge);
+    if (size < 0 || size > _comp->config()->inlineMaxCalleeSize() || size > _budget)
+        return NULL;
+
+    _budget -= size;
+    return inlineCall(op, callee, writtenSymbols, needsMerge);
+}
+
+// appends copies of from's operations to to, including copies of the builders bound to them
+void
+Inliner::cloneBuilder(Builder *from, Builder *to, InlinedCall & ic) {
+    for (OperationIterator opIt = from->OperationsBegin(); opIt != from->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+
+        if (op->action() == _base->aReturn) {
+            if (ic._result != NULL && op->numOperands() > 0)
+                _base->MergeDef(LOC, to, ic._result, ic._values[op->operand(0)]);
+            if (ic._merge != NULL)
+                _base->Goto(LOC, to, ic._merge);
+            return; // anything after the Return cannot execute
+        }
+
+        if (op->action() == _base->aLoad) {
+            auto argument = ic._arguments.find(op->symbol());
+            if (argument != ic._arguments.end()) {
+                ic._values[op->result()] = argument->second;
+                continue;
+            }
+        }
+
+        OperationCloner cloner(op);
+        for (int32_t o=0;o < op->numOperands();o++) {
+            auto found = ic._values.find(op->operand(o));
+            if (found != ic._values.end())
+                cloner.changeOperand(found->second, o);
+        }
+        for (int32_t s=0;s < op->numSymbols();s++) {
+            auto found = ic._symbols.find(op->symbol(s));
+            if (found != ic._symbols.end())
+                cloner.changeSymbol(found->second, s);
+        }
+        for (int32_t i=0;i < op->numBuilders();i++) {
+            Builder *inner = op->builder(i);
+            if (inner->isBound() && inner->boundToOperation() == op)
+                cloner.changeBuilder(NULL, i); // the copy creates its own bound builder
+            else
+                cloner.changeBuilder(ic._builders[inner], i);
+        }
+        for (int32_t t=0;t < op->numTypes();t++)
+            cloner.changeType(mapType(op->type(t)), t);
+        for (int32_t r=0;r < op->numResults();r++) {
+            cloner.createResult(to, mapType(op->result(r)->type()), r);
+            ic._values[op->result(r)] = cloner.result(r);
+        }
+        Operation *copy = to->appendClone(op, &cloner);
+
+        for (int32_t i=0;i < op->numBuilders();i++) {
+            Builder *inner = op->builder(i);
+            if (inner->isBound() && inner->boundToOperation() == op)
+                ic._builders[inner] = copy->builder(i);
+        }
+        for (int32_t i=0;i < op->numBuilders();i++) {
+            Builder *inner = op->builder(i);
+            if (inner->isBound() && inner->boundToOperation() == op)
+                cloneBuilder(inner, copy->builder(i), ic);
+        }
+    }
+}
+
+Builder *
+Inliner::inlineCall(Operation *call, Function *callee, std::set<Symbol *> & writtenSymbols, bool needsMerge) {
+    Function *caller = static_cast<FunctionCompilation *>(_comp)->func();
+    Builder *b = _base->OrphanBuilder(LOC, call->parent());
+    std::string prefix = std::string("_inl").append(std::to_string(call->id())).append("_");
+
+    InlinedCall ic;
+    ic._result = NULL;
+    ic._merge = NULL;
+
+    for (ParameterSymbolIterator pIt = callee->ParametersBegin(); pIt != callee->ParametersEnd(); pIt++) {
+        ParameterSymbol *parm = *pIt;
+        Value *argument = call->operand(parm->index());
+        if (writtenSymbols.find(parm) != writtenSymbols.end()) {
+            LocalSymbol *local = caller->DefineLocal(prefix + parm->name(), mapType(parm->type()));
+            _base->Store(LOC, b, local, argument);
+            ic._symbols[parm] = local;
+        }
+        else {
+            ic._arguments[parm] = argument;
+        }
+    }
+    for (LocalSymbolIterator lIt = callee->LocalsBegin(); lIt != callee->LocalsEnd(); lIt++) {
+        LocalSymbol *local = *lIt;
+        ic._symbols[local] = caller->DefineLocal(prefix + local->name(), mapType(local->type()));
+    }
+    for (FunctionSymbolIterator fIt = callee->FunctionsBegin(); fIt != callee->FunctionsEnd(); fIt++) {
+        FunctionSymbol *function = *fIt;
+        if (caller->getSymbol(function->name()) == NULL)
+            caller->DefineFunction(function);
+    }
+
+    // the Call's result starts as zero so every Return can merge its value into it
+    if (call->numResults() > 0 && call->result()->type() != _base->NoType) {
+        ic._result = call->result();
+        Builder *scratch = _base->OrphanBuilder(LOC, b);
+        _base->Zero(LOC, scratch, ic._result->type());
+        Operation *zero = scratch->operations().back();
+        OperationCloner cloner(zero);
+        cloner.changeResult(ic._result);
+        b->appendClone(zero, &cloner);
+    }
+
+    Builder *body = b;
+    if (needsMerge) {
+        LocalSymbol *once = caller->DefineLocal(prefix + "once", _base->Int32);
+        Value *zero = _base->ConstInt32(LOC, b, 0);
+        Value *one = _base->ConstInt32(LOC, b, 1);
+        ForLoopBuilder *wrapper = _base->ForLoopUp(LOC, b, once, zero, one, one);
+        body = wrapper->loopBody();
+        ic._merge = wrapper->loopBreak();
+    }
+
+    cloneBuilder(callee->builderEntry(), body, ic);
+    return b;
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#ifndef INLINER_INCL
+#define INLINER_INCL
+
+#include <stdint.h>
+#include <map>
+#include <set>
+#include "Transformer.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class Compiler;
+class Operation;
+class Symbol;
+class Type;
+class Value;
+
+namespace Base {
+
+class BaseExtension;
+class Function;
+
+// Inliner replaces a Call to a FunctionSymbol that references a (compiled) JB2 Function with a
+// copy of that Function's IL. Parameters that the callee never stores to are replaced by the
+// argument Values; other parameters and the callee's locals become new locals of the caller.
+// A Return that does not end the callee's entry builder becomes a Goto to a merge builder: the
+// copied IL runs as the body of a ForLoopUp with one iteration, so its loopBreak is the merge
+// builder. Every Return merges its value into the Call's result with MergeDef.
+//
+// A callee is only inlined if it has at most Config::inlineMaxCalleeSize() operations and
+// the operations inlined so far into this compilation, plus its own, stay within
+// Config::inlineBudget(). Its IL may only refer to builders bound to its own operations
+// (i.e. the bodies, breaks and continues of loops) and to Types the caller also knows (a
+// callee's pointer Types are replaced by the caller's pointers to the same base Types).
+// Calls in cold Builders, including those a profile shows never ran (see ProfileFeedback),
+// are not inlined.
+class Inliner : public Transformer {
+public:
+    Inliner(Compiler *compiler);
+
+protected:
+    virtual void visitPreCompilation(Compilation * comp);
+    virtual Builder * transformOperation(Operation * op);
+
+    struct InlinedCall {
+        Value *_result;                              // the Call's result, or NULL if there isn't one
+        Builder *_merge;                             // where Returns go, NULL if only the final Return
+        std::map<Symbol *,Value *> _arguments;       // parameters the callee never stores to
+        std::map<Value *,Value *> _values;
+        std::map<Symbol *,Symbol *> _symbols;
+        std::map<Builder *,Builder *> _builders;
+    };
+
+    int32_t calleeSize(Function *callee, Builder *b, std::set<Builder *> & builders, std::set<Symbol *> & writtenSymbols, bool & needsMerge);
+    bool isKnownType(const Type *type);
+    const Type *mapType(const Type *type);
+    Builder * inlineCall(Operation *call, Function *callee, std::set<Symbol *> & writtenSymbols, bool needsMerge);
+    void cloneBuilder(Builder *from, Builder *to, InlinedCall & ic);
+
+    BaseExtension *_base;
+    int32_t _budget;                     // operations that can still be inlined into this compilation
+    std::set<const Type *> _knownTypes;  // Types in the caller's dictionary
+    std::map<const Type *,const Type *> _mappedTypes;
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(INLINER_INCL)
@@ -0,0 +1,310 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "BaseExtension.hpp"
+#include "BaseSymbols.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "ControlFlowGraph.hpp"
+#include "LocalForwarding.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "TextWriter.hpp"
+#include "Value.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+LocalForwarding::LocalForwarding(Compiler *compiler)
+    : Pass(compiler, std::string("LocalForwarding"))
+    , _base(compiler->lookupExtension<BaseExtension>())
+    , _comp(NULL) {
+
+}
+
+bool
+LocalForwarding::isForwardable(Operation *op) const {
+    if (op->action() != _base->aLoad && op->action() != _base->aStore)
+        return false;
+    return op->symbol()->isKind<LocalSymbol>();
+}
+
+// collects the symbols stored in b and the builders bound to its operations; returns true if any of
+// them can branch to another builder, after which control may not return to where b was entered
+bool
+LocalForwarding::scan(Builder *b, std::set<Symbol *> & stored) {
+    auto found = _storedIn.find(b);
+    if (found != _storedIn.end()) {
+        stored.insert(found->second.begin(), found->second.end());
+        return _branchesOut.find(b) != _branchesOut.end();
+    }
+
+    std::set<Symbol *> & storedInB = _storedIn[b];
+    bool branchesOut = false;
+    for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        if (op->action() == _base->aLoad)
+            continue;
+        for (int32_t s=0;s < op->numSymbols();s++)
+            storedInB.insert(op->symbol(s));
+        for (int32_t i=0;i < op->numBuilders();i++) {
+            Builder *inner = op->builder(i);
+            if (inner == NULL)
+                continue;
+            if (!inner->isBound())
+                branchesOut = true;
+            else if (scan(inner, storedInB))
+                branchesOut = true;
+        }
+    }
+
+    if (branchesOut)
+        _branchesOut.insert(b);
+    stored.insert(storedInB.begin(), storedInB.end());
+    return branchesOut;
+}
+
+void
+LocalForwarding::forward(Builder *b, Available & current, std::vector<Builder *> & worklist, TextWriter *log) {
+    _visited.insert(b);
+
+    // the last Store to each symbol that nothing has loaded since
+    std::map<Symbol *,Operation *> pending;
+    std::set<Operation *> dead;
+
+    // operations are appended back to b as they are rewritten
+    OperationVector original;
+    original.swap(b->operations());
+
+    for (OperationIterator opIt = original.begin(); opIt != original.end(); opIt++) {
+        Operation *op = *opIt;
+
+        if (op->action() == _base->aLoad && isForwardable(op)) {
+            Symbol *sym = op->symbol();
+            auto found = current.find(sym);
+            if (found != current.end()) {
+                _values[op->result()] = found->second;
+                if (log) {
+                    log->indent() << "Forwarded ";
+                    log->print(op);
+                }
+                continue;
+            }
+            b->operations().push_back(op);
+            current[sym] = op->result();
+            pending.erase(sym);
+            continue;
+        }
+
+        bool changed = false;
+        OperationCloner cloner(op);
+        for (int32_t o=0;o < op->numOperands();o++) {
+            auto found = _values.find(op->operand(o));
+            if (found != _values.end()) {
+                cloner.changeOperand(found->second, o);
+                changed = true;
+            }
+        }
+        Operation *kept = changed ? b->appendClone(op, &cloner) : op;
+        if (!changed)
+            b->operations().push_back(op);
+
+        if (kept->action() == _base->aStore && isForwardable(kept)) {
+            Symbol *sym = kept->symbol();
+            auto found = pending.find(sym);
+            if (found != pending.end())
+                dead.insert(found->second);
+            pending[sym] = kept;
+
+            Value *value = kept->operand();
+            if (value->definition() != NULL)
+                current[sym] = value;
+            else
+                current.erase(sym);
+            continue;
+        }
+
+        if (kept->action() == _base->aReturn) {
+            // locals do not outlive the function
+            for (auto it = pending.begin(); it != pending.end(); it++)
+                dead.insert(it->second);
+            pending.clear();
+            continue;
+        }
+
+        for (int32_t s=0;s < kept->numSymbols();s++) {
+            current.erase(kept->symbol(s));
+            pending.erase(kept->symbol(s));
+        }
+
+        if (kept->numBuilders() == 0)
+            continue;
+
+        // any of the builders may load a pending Store's symbol
+        pending.clear();
+
+        std::set<Symbol *> killed;
+        bool branchesOut = false;
+        for (int32_t i=0;i < kept->numBuilders();i++) {
+            Builder *inner = kept->builder(i);
+            if (inner != NULL && inner->isBound() && scan(inner, killed))
+                branchesOut = true;
+        }
+
+        Available atOperation = current;
+        if (branchesOut)
+            current.clear();
+        else {
+            for (auto it = killed.begin(); it != killed.end(); it++)
+                current.erase(*it);
+        }
+
+        for (int32_t i=0;i < kept->numBuilders();i++) {
+            Builder *inner = kept->builder(i);
+            if (inner == NULL || _visited.find(inner) != _visited.end())
+                continue;
+
+            if (inner->isBound()) {
+                Available inBuilder = current;
+                forward(inner, inBuilder, worklist, log);
+                continue;
+            }
+
+            // a branch target starts with what is known here only if this branch is the only way
+            // to reach it: the graph's predecessors also count other Builders falling through to it
+            if (_joins.find(inner) == _joins.end()) {
+                auto found = _entryState.find(inner);
+                const BuilderVector & preds = _comp->cfg()->predecessors(inner);
+                if (found != _entryState.end() || preds.size() != 1 || preds[0] != b) {
+                    _joins.insert(inner);
+                    _entryState.erase(inner);
+                }
+                else
+                    _entryState[inner] = atOperation;
+            }
+            worklist.push_back(inner);
+        }
+    }
+
+    if (dead.empty())
+        return;
+
+    OperationVector & ops = b->operations();
+    OperationVector live;
+    for (OperationIterator opIt = ops.begin(); opIt != ops.end(); opIt++) {
+        Operation *op = *opIt;
+        if (dead.find(op) != dead.end()) {
+            if (log) {
+                log->indent() << "Removed dead ";
+                log->print(op);
+            }
+            continue;
+        }
+        live.push_back(op);
+    }
+    ops.swap(live);
+}
+
+void
+LocalForwarding::forwardAll(std::vector<Builder *> & worklist, TextWriter *log) {
+    while (!worklist.empty()) {
+        Builder *b = worklist.back();
+        worklist.pop_back();
+        if (_visited.find(b) != _visited.end())
+            continue;
+
+        Available current;
+        auto found = _entryState.find(b);
+        if (found != _entryState.end())
+            current = found->second;
+        forward(b, current, worklist, log);
+    }
+}
+
+// removes every Store to a symbol that is no longer loaded anywhere
+void
+LocalForwarding::removeDeadStores(Compilation *comp, TextWriter *log) {
+    std::set<Symbol *> read;
+    for (BuilderIterator bIt = comp->buildersBegin(); bIt != comp->buildersEnd(); bIt++) {
+        Builder *b = *bIt;
+        for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+            Operation *op = *opIt;
+            if (op->action() == _base->aStore && isForwardable(op))
+                continue;
+            for (int32_t s=0;s < op->numSymbols();s++)
+                read.insert(op->symbol(s));
+        }
+    }
+
+    for (BuilderIterator bIt = comp->buildersBegin(); bIt != comp->buildersEnd(); bIt++) {
+        Builder *b = *bIt;
+        OperationVector & ops = b->operations();
+        OperationVector live;
+        for (OperationIterator opIt = ops.begin(); opIt != ops.end(); opIt++) {
+            Operation *op = *opIt;
+            if (op->action() == _base->aStore && isForwardable(op) && read.find(op->symbol()) == read.end()) {
+                if (log) {
+                    log->indent() << "Removed dead ";
+                    log->print(op);
+                }
+                continue;
+            }
+            live.push_back(op);
+        }
+        if (live.size() != ops.size())
+            ops.swap(live);
+    }
+}
+
+CompilerReturnCode
+LocalForwarding::perform(Compilation *comp) {
+    setTraceEnabled(comp->config()->traceLocalForwarding());
+    TextWriter *log = comp->logger(traceEnabled());
+
+    _comp = comp;
+    _visited.clear();
+    _storedIn.clear();
+    _branchesOut.clear();
+    _entryState.clear();
+    _joins.clear();
+    _values.clear();
+
+    // entries first so branch targets see what is known at their branches, then builders never reached
+    ControlFlowGraph *cfg = comp->cfg();
+    std::vector<Builder *> worklist;
+    for (int32_t e=cfg->numEntries()-1;e >= 0;e--)
+        worklist.push_back(cfg->entry(e));
+    forwardAll(worklist, log);
+    for (BuilderIterator bIt = comp->buildersBegin(); bIt != comp->buildersEnd(); bIt++)
+        worklist.push_back(*bIt);
+    forwardAll(worklist, log);
+
+    removeDeadStores(comp, log);
+
+    return _compiler->CompileSuccessful;
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef LOCALFORWARDING_INCL
+#define LOCALFORWARDING_INCL
+
+#include <map>
+#include <set>
+#include <vector>
+#include "Pass.hpp"
+#include "typedefs.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class Compilation;
+class Compiler;
+class Operation;
+class Symbol;
+class TextWriter;
+class Value;
+
+namespace Base {
+
+class BaseExtension;
+
+// LocalForwarding removes Loads of LocalSymbols (including parameters) whose value is already
+// known: a Load that follows a Store or another Load of the same symbol is replaced by the stored
+// or loaded Value. Builders are visited once, in program order: a Builder bound to an operation
+// starts with what is known at that operation, less the symbols stored anywhere in the operation's
+// bound Builders (so a loop body only sees symbols the loop does not change), and those symbols are
+// forgotten after the operation. A branch target whose only edge in the ControlFlowGraph is that
+// branch starts with what is known at the branch; every other Builder (including one that another
+// Builder falls through to, see Builder::controlFlowEdges()) starts with nothing known. Values with more than one
+// definition (see MergeDef) are never forwarded.
+//
+// Stores are then removed if they are dead: either a later Store in the same Builder overwrites the
+// symbol (or the function returns) before anything can load it, or the symbol is not loaded anywhere.
+// Unlike SSAConstruction, no new Values are merged where control flow joins, so this pass is cheap
+// and handles any control flow.
+class LocalForwarding : public Pass {
+public:
+    LocalForwarding(Compiler *compiler);
+
+    virtual CompilerReturnCode perform(Compilation *comp);
+
+protected:
+    typedef std::map<Symbol *,Value *> Available;
+
+    bool isForwardable(Operation *op) const;
+    bool scan(Builder *b, std::set<Symbol *> & stored);
+    void forward(Builder *b, Available & current, std::vector<Builder *> & worklist, TextWriter *log);
+    void forwardAll(std::vector<Builder *> & worklist, TextWriter *log);
+    void removeDeadStores(Compilation *comp, TextWriter *log);
+
+    BaseExtension *_base;
+    Compilation *_comp;
+    std::set<Builder *> _visited;
+    std::map<Builder *,std::set<Symbol *> > _storedIn; // symbols stored in each bound builder, including in builders nested in it
+    std::set<Builder *> _branchesOut;                  // bound builders (or builders nested in them) with branches to other builders
+    std::map<Builder *,Available> _entryState;         // known Values at the only branch to each builder
+    std::set<Builder *> _joins;                        // builders reached by more than one branch
+    std::map<Value *,Value *> _values;                 // removed Load results and the Values that replace them
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(LOCALFORWARDING_INCL)
@@ -0,0 +1,609 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include "AliasAnalysis.hpp"
+#include "BaseExtension.hpp"
+#include "BaseSymbols.hpp"
+#include "BaseTypes.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "ControlOperations.hpp"
+#include "Function.hpp"
+#include "FunctionCompilation.hpp"
+#include "Literal.hpp"
+#include "LoopNestOptimizer.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "Value.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+LoopNestOptimizer::LoopNestOptimizer(Compiler *compiler)
+    : Transformer(compiler, std::string("LoopNestOptimizer"))
+    , _base(compiler->lookupExtension<BaseExtension>())
+    , _nestParent(NULL) {
+
+}
+
+void
+LoopNestOptimizer::visitPreCompilation(Compilation * comp) {
+    setTraceEnabled(_comp->config()->traceLoopNestOptimizer());
+    _transformed.clear();
+}
+
+bool
+LoopNestOptimizer::isPrefixOperation(Operation *op) const {
+    ActionID a = op->action();
+    return a == _base->aConst || a == _base->aLoad || a == _base->aAdd || a == _base->aSub
+        || a == _base->aMul || a == _base->aConvertTo || a == _base->aIndexAt;
+}
+
+// collects the loops of the perfect nest starting at n._loops[0] and the operations in their bodies
+bool
+LoopNestOptimizer::collectNest(Nest & n) {
+    _definitions.clear();
+    _loopVariables.clear();
+    _nestParent = n._loops[0]->parent();
+
+    Op_ForLoopUp *loop = n._loops[0];
+    while (true) {
+        if (_loopVariables.find(loop->loopVariable()) != _loopVariables.end())
+            return false;
+        _loopVariables.insert(loop->loopVariable());
+
+        // bounds must not change from one iteration of the enclosing loops to the next
+        if (_definitions.find(loop->initialValue()) != _definitions.end()
+         || _definitions.find(loop->finalValue()) != _definitions.end()
+         || _definitions.find(loop->bumpValue()) != _definitions.end())
+            return false;
+
+        Literal *bump = literalValue(loop->bumpValue());
+        if (bump == NULL || bump->getInteger() != 1)
+            return false;
+
+        Builder *body = loop->loopBody();
+        if (!body->controlReachesEnd() || body->numOperations() == 0)
+            return false;
+
+        Operation *last = body->operations().back();
+        bool innermost = (last->action() != _base->aForLoopUp);
+        for (OperationIterator opIt = body->OperationsBegin(); opIt != body->OperationsEnd(); opIt++) {
+            Operation *op = *opIt;
+            if (op == last && !innermost)
+                continue;
+
+            if (!isPrefixOperation(op)) {
+                if (!innermost || (op->action() != _base->aLoadAt && op->action() != _base->aStoreAt))
+                    return false;
+            }
+
+            for (int32_t r=0;r < op->numResults();r++)
+                _definitions[op->result(r)] = op;
+        }
+
+        if (innermost)
+            break;
+
+        loop = static_cast<Op_ForLoopUp *>(last);
+        n._loops.push_back(loop);
+    }
+
+    return n._loops.size() >= 2;
+}
+
+// returns the Literal if v is produced by a Const operation in the nest or in the builder holding it, otherwise NULL
+Literal *
+LoopNestOptimizer::literalValue(Value *v) {
+    auto found = _definitions.find(v);
+    if (found != _definitions.end())
+        return (found->second->action() == _base->aConst) ? found->second->literal() : NULL;
+
+    for (OperationIterator opIt = _nestParent->OperationsBegin(); opIt != _nestParent->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        if (op->action() == _base->aConst && op->result() == v)
+            return op->literal();
+    }
+    return NULL;
+}
+
+Value *
+LoopNestOptimizer::constant(Builder *b, const Type *type, int64_t v) {
+    if (type == _base->Int8)
+        return _base->ConstInt8(LOC, b, (int8_t) v);
+    else if (type == _base->Int16)
+        return _base->ConstInt16(LOC, b, (int16_t) v);
+    else if (type == _base->Int32)
+        return _base->ConstInt32(LOC, b, (int32_t) v);
+    assert(type == _base->Int64);
+    return _base->ConstInt64(LOC, b, v);
+}
+
+// returns text that is the same for two Values only if they are computed the same way in the nest
+std::string
+LoopNestOptimizer::text(Value *v) {
+    auto found = _definitions.find(v);
+    if (found == _definitions.end())
+        return std::string("v").append(std::to_string(v->id()));
+
+    Operation *op = found->second;
+    if (op->action() == _base->aLoad)
+        return std::string("Load ").append(op->symbol()->name());
+    if (op->action() == _base->aConst) {
+        const Type *type = v->type();
+        if (type == _base->Int8 || type == _base->Int16 || type == _base->Int32 || type == _base->Int64)
+            return std::string("Const ").append(type->name()).append(" ").append(std::to_string(op->literal()->getInteger()));
+        return std::string("v").append(std::to_string(v->id()));
+    }
+
+    std::string s = op->name();
+    if (op->action() == _base->aConvertTo)
+        s.append(" ").append(op->type()->name());
+    s.append("(");
+    for (int32_t o=0;o < op->numOperands();o++) {
+        if (o > 0)
+            s.append(",");
+        s.append(text(op->operand(o)));
+    }
+    return s.append(")");
+}
+
+// computes into coefficients the multiplier of each loop variable in v; false if v is not a linear function of them
+bool
+LoopNestOptimizer::linear(Value *v, Coefficients & coefficients) {
+    auto found = _definitions.find(v);
+    if (found == _definitions.end())
+        return true;
+
+    Operation *op = found->second;
+    ActionID a = op->action();
+    if (a == _base->aConst)
+        return true;
+
+    if (a == _base->aLoad) {
+        if (_loopVariables.find(op->symbol()) != _loopVariables.end()) {
+            Coefficient one = { true, 1, NULL };
+            coefficients[op->symbol()] = one;
+        }
+        return true;
+    }
+
+    if (a == _base->aConvertTo)
+        return linear(op->operand(0), coefficients);
+
+    if (a == _base->aAdd || a == _base->aSub) {
+        Coefficients right;
+        if (!linear(op->operand(0), coefficients) || !linear(op->operand(1), right))
+            return false;
+
+        int64_t sign = (a == _base->aSub) ? -1 : 1;
+        for (auto it = right.begin(); it != right.end(); it++) {
+            Coefficient c = it->second;
+            c._value *= sign;
+            auto left = coefficients.find(it->first);
+            if (left == coefficients.end()) {
+                coefficients[it->first] = c;
+            }
+            else if (left->second._known && c._known) {
+                left->second._value += c._value;
+                if (left->second._value == 0)
+                    coefficients.erase(left);
+            }
+            else {
+                left->second._known = false;
+                left->second._factor = NULL;
+            }
+        }
+        return true;
+    }
+
+    if (a == _base->aMul) {
+        Coefficients left, right;
+        if (!linear(op->operand(0), left) || !linear(op->operand(1), right))
+            return false;
+        if (!left.empty() && !right.empty())
+            return false;
+
+        Value *factor = left.empty() ? op->operand(0) : op->operand(1);
+        Coefficients & scaled = left.empty() ? right : left;
+        Literal *literal = literalValue(factor);
+        for (auto it = scaled.begin(); it != scaled.end(); it++) {
+            Coefficient c = it->second;
+            if (literal != NULL)
+                c._value *= literal->getInteger();
+            else if (c._known) {
+                c._known = false;
+                c._factor = factor;
+            }
+            else
+                c._factor = NULL;
+            if (!c._known || c._value != 0)
+                coefficients[it->first] = c;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+// every LoadAt and StoreAt must use an IndexAt of an invariant base with a linear index
+bool
+LoopNestOptimizer::analyzeAccesses(Nest & n) {
+    for (auto it = n._loops.begin(); it != n._loops.end(); it++) {
+        Builder *body = (*it)->loopBody();
+        for (OperationIterator opIt = body->OperationsBegin(); opIt != body->OperationsEnd(); opIt++) {
+            Operation *op = *opIt;
+            if (op->action() != _base->aLoadAt && op->action() != _base->aStoreAt)
+                continue;
+
+            auto found = _definitions.find(op->operand(0));
+            if (found == _definitions.end() || found->second->action() != _base->aIndexAt)
+                return false;
+
+            Operation *indexAt = found->second;
+            Coefficients baseCoefficients;
+            if (!linear(indexAt->operand(0), baseCoefficients) || !baseCoefficients.empty())
+                return false;
+
+            Access access;
+            access._op = op;
+            access._isStore = (op->action() == _base->aStoreAt);
+            access._base = text(indexAt->operand(0));
+            access._baseValue = indexAt->operand(0);
+            access._index = text(indexAt->operand(1));
+            if (!linear(indexAt->operand(1), access._coefficients))
+                return false;
+            n._accesses.push_back(access);
+        }
+    }
+    return !n._accesses.empty();
+}
+
+bool
+LoopNestOptimizer::isLegal(Nest & n) {
+    AliasAnalysis aliases(_base, static_cast<FunctionCompilation *>(_comp)->func());
+    for (auto s = n._accesses.begin(); s != n._accesses.end(); s++) {
+        if (!s->_isStore)
+            continue;
+
+        for (auto a = n._accesses.begin(); a != n._accesses.end(); a++) {
+            if (a->_base == s->_base) {
+                if (a->_index != s->_index)
+                    return false;
+            }
+            else if (aliases.pointersMayAlias(s->_baseValue, a->_baseValue))
+                return false;
+        }
+
+        // the run time check needs every coefficient of the stored index
+        for (auto it = s->_coefficients.begin(); it != s->_coefficients.end(); it++) {
+            if (!it->second._known && it->second._factor == NULL)
+                return false;
+        }
+
+        int32_t missing = 0;
+        for (auto it = n._loops.begin(); it != n._loops.end(); it++) {
+            if (s->_coefficients.find((*it)->loopVariable()) == s->_coefficients.end())
+                missing++;
+        }
+        if (missing > 1)
+            return false;
+    }
+    return true;
+}
+
+// how many accesses would touch the same or the next element if loopVariable's loop were innermost,
+// less how many would jump by a stride only known at run time
+int32_t
+LoopNestOptimizer::score(Nest & n, Symbol *loopVariable) {
+    int32_t score = 0;
+    for (auto it = n._accesses.begin(); it != n._accesses.end(); it++) {
+        auto found = it->_coefficients.find(loopVariable);
+        if (found == it->_coefficients.end())
+            score++;
+        else if (!found->second._known)
+            score--;
+        else if (found->second._value == 1 || found->second._value == -1)
+            score++;
+    }
+    return score;
+}
+
+// the loop with the best score moves innermost, the other loops stay in the same order
+std::vector<int32_t>
+LoopNestOptimizer::chooseOrder(Nest & n) {
+    int32_t numLoops = n._loops.size();
+    int32_t best = numLoops-1;
+    int32_t bestScore = score(n, n._loops[best]->loopVariable());
+    for (int32_t l=numLoops-2;l >= 0;l--) {
+        int32_t s = score(n, n._loops[l]->loopVariable());
+        if (s > bestScore) {
+            best = l;
+            bestScore = s;
+        }
+    }
+
+    std::vector<int32_t> order;
+    for (int32_t l=0;l < numLoops;l++) {
+        if (l != best)
+            order.push_back(l);
+    }
+    order.push_back(best);
+    return order;
+}
+
+Builder *
+LoopNestOptimizer::transformOperation(Operation * op) {
+    if (op->action() != _base->aForLoopUp)
+        return NULL;
+
+    Op_ForLoopUp *outer = static_cast<Op_ForLoopUp *>(op);
+    if (_transformed.find(outer->loopBody()) != _transformed.end())
+        return NULL;
+
+    Nest n;
+    n._loops.push_back(outer);
+    if (!collectNest(n) || !analyzeAccesses(n) || !isLegal(n))
+        return NULL;
+
+    std::vector<int32_t> order = chooseOrder(n);
+    bool interchanged = false;
+    for (int32_t l=0;l < (int32_t)order.size();l++) {
+        if (order[l] != l)
+            interchanged = true;
+    }
+
+    Config *config = _comp->config();
+    std::vector<int32_t> tileSizes;
+    int32_t tileSize = config->loopTileSize();
+    if (tileSize >= 2) {
+        int32_t outerTileSize = config->loopOuterTileSize();
+        if (outerTileSize > tileSize && outerTileSize % tileSize == 0)
+            tileSizes.push_back(outerTileSize);
+        tileSizes.push_back(tileSize);
+    }
+
+    if (!interchanged && tileSizes.empty())
+        return NULL;
+
+    return transform(n, order, tileSizes);
+}
+
+// appends copies of the operations in loop's body, except a nested loop, to b
+void
+LoopNestOptimizer::clonePrefix(Builder *b, Op_ForLoopUp *loop, std::map<Value *,Value *> & clonedValues) {
+    Builder *body = loop->loopBody();
+    for (OperationIterator opIt = body->OperationsBegin(); opIt != body->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        if (op->action() == _base->aForLoopUp)
+            continue;
+
+        OperationCloner cloner(op);
+        for (int32_t o=0;o < op->numOperands();o++) {
+            auto found = clonedValues.find(op->operand(o));
+            if (found != clonedValues.end())
+                cloner.changeOperand(found->second, o);
+        }
+        for (int32_t r=0;r < op->numResults();r++) {
+            cloner.createResult(b, r);
+            clonedValues[op->result(r)] = cloner.result(r);
+        }
+        b->appendClone(op, &cloner);
+    }
+}
+
+// returns v computed in b: operations of the nest that v depends on are copied, in the same way as clonePrefix
+Value *
+LoopNestOptimizer::materialize(Builder *b, Value *v, std::map<Value *,Value *> & clonedValues) {
+    auto cloned = clonedValues.find(v);
+    if (cloned != clonedValues.end())
+        return cloned->second;
+
+    auto found = _definitions.find(v);
+    if (found == _definitions.end())
+        return v;
+
+    Operation *op = found->second;
+    OperationCloner cloner(op);
+    for (int32_t o=0;o < op->numOperands();o++)
+        cloner.changeOperand(materialize(b, op->operand(o), clonedValues), o);
+    for (int32_t r=0;r < op->numResults();r++) {
+        cloner.createResult(b, r);
+        clonedValues[op->result(r)] = cloner.result(r);
+    }
+    b->appendClone(op, &cloner);
+    return clonedValues[v];
+}
+
+Value *
+LoopNestOptimizer::toInt64(Builder *b, Value *v) {
+    if (v->type() == _base->Int64)
+        return v;
+    return _base->ConvertTo(LOC, b, _base->Int64, v);
+}
+
+// appends to b a check that each stored index maps distinct iterations of the loops it depends on to
+// distinct elements, branching to fail if it does not. With the loop variables ordered by increasing
+// coefficient (known ones first, as unknown ones may be large), each coefficient must be larger than the
+// largest difference the loop variables before it can make to the index. b is only reached if every loop
+// in the nest runs at least once
+void
+LoopNestOptimizer::checkDistinctElements(Builder *b, Builder *fail, Nest & n) {
+    std::map<Value *,Value *> clonedValues;
+    std::set<std::string> checked;
+    for (auto s = n._accesses.begin(); s != n._accesses.end(); s++) {
+        if (!s->_isStore || checked.find(s->_index) != checked.end())
+            continue;
+        checked.insert(s->_index);
+
+        std::vector<std::pair<int64_t,int32_t> > known;
+        std::vector<int32_t> unknown;
+        for (int32_t l=0;l < (int32_t)n._loops.size();l++) {
+            auto found = s->_coefficients.find(n._loops[l]->loopVariable());
+            if (found == s->_coefficients.end())
+                continue;
+            if (found->second._known)
+                known.push_back(std::make_pair(std::abs(found->second._value), l));
+            else
+                unknown.push_back(l);
+        }
+        std::sort(known.begin(), known.end());
+
+        std::vector<int32_t> loops;
+        for (auto it = known.begin(); it != known.end(); it++)
+            loops.push_back(it->second);
+        loops.insert(loops.end(), unknown.begin(), unknown.end());
+
+        Value *span = NULL;
+        for (int32_t k=0;k < (int32_t)loops.size();k++) {
+            Op_ForLoopUp *loop = n._loops[loops[k]];
+            Coefficient & c = s->_coefficients[loop->loopVariable()];
+            Value *size;
+            if (c._known)
+                size = _base->ConstInt64(LOC, b, std::abs(c._value));
+            else {
+                Value *factor = toInt64(b, materialize(b, c._factor, clonedValues));
+                size = _base->Abs(LOC, b, _base->Mul(LOC, b, _base->ConstInt64(LOC, b, c._value), factor));
+            }
+
+            if (span == NULL) {
+                if (!c._known)
+                    _base->IfCmpEqual(LOC, b, fail, size, _base->ConstInt64(LOC, b, 0));
+                span = _base->ConstInt64(LOC, b, 0);
+            }
+            else
+                _base->IfCmpLessOrEqual(LOC, b, fail, size, span);
+
+            if (k < (int32_t)loops.size() - 1) {
+                Value *trips = _base->Sub(LOC, b, toInt64(b, loop->finalValue()), toInt64(b, loop->initialValue()));
+                Value *last = _base->Sub(LOC, b, trips, _base->ConstInt64(LOC, b, 1));
+                span = _base->Add(LOC, b, span, _base->Mul(LOC, b, size, last));
+            }
+        }
+    }
+}
+
+Builder *
+LoopNestOptimizer::transform(Nest & n, std::vector<int32_t> & order, std::vector<int32_t> & tileSizes) {
+    Op_ForLoopUp *outer = n._loops[0];
+    Function *func = static_cast<FunctionCompilation *>(_comp)->func();
+    Builder *b = _base->OrphanBuilder(LOC, outer->parent());
+    std::string suffix = std::to_string(outer->id());
+    int32_t numLoops = n._loops.size();
+
+    // The new nest runs inside a loop with one iteration that is left early if any loop in the
+    // nest would not execute or a stored index may hit the same element twice, leaving guard at 0.
+    // In that case the original nest runs instead, so that the loop variables end up with the same
+    // values and the elements are updated in the same order as before.
+    LocalSymbol *guard = func->DefineLocal(std::string("_nest_guard").append(suffix), _base->Int32);
+    Value *zero = _base->ConstInt32(LOC, b, 0);
+    Value *one = _base->ConstInt32(LOC, b, 1);
+    ForLoopBuilder *guardLoop = _base->ForLoopUp(LOC, b, guard, zero, one, one);
+    Builder *g = guardLoop->loopBody();
+    for (int32_t l=0;l < numLoops;l++)
+        _base->IfCmpGreaterOrEqual(LOC, g, guardLoop->loopBreak(), n._loops[l]->initialValue(), n._loops[l]->finalValue());
+    checkDistinctElements(g, guardLoop->loopBreak(), n);
+
+    // tile loops: each level of tiles divides the tiles of the level above it
+    Builder *current = g;
+    std::vector<Value *> tileStarts(numLoops);
+    for (int32_t level=0;level < (int32_t)tileSizes.size();level++) {
+        for (int32_t p=0;p < numLoops;p++) {
+            Op_ForLoopUp *loop = n._loops[order[p]];
+            LocalSymbol *loopVariable = loop->loopVariable();
+            const Type *type = loopVariable->type();
+            std::string name = std::string("_tile").append(std::to_string(level)).append("_").append(loopVariable->name()).append(suffix);
+            LocalSymbol *tileVariable = func->DefineLocal(name, type);
+
+            Value *initial = loop->initialValue();
+            Value *final = loop->finalValue();
+            if (level > 0) {
+                initial = tileStarts[order[p]];
+                final = _base->Add(LOC, current, initial, constant(current, type, tileSizes[level-1]));
+            }
+            ForLoopBuilder *tileLoop = _base->ForLoopUp(LOC, current, tileVariable, initial, final, constant(current, type, tileSizes[level]));
+            Builder *body = tileLoop->loopBody();
+            tileStarts[order[p]] = _base->Load(LOC, body, tileVariable);
+            if (level > 0)
+                _base->IfCmpGreaterOrEqual(LOC, body, tileLoop->loopBreak(), tileStarts[order[p]], loop->finalValue());
+            current = body;
+        }
+    }
+
+    // point loops: the original loop variables, limited to one tile (if tiling) and to the original bounds.
+    // Each loop's body operations are copied into the innermost point loop that all of its enclosing
+    // (original) loops' variables are available in
+    std::vector<int32_t> placement(numLoops);
+    int32_t deepest = 0;
+    for (int32_t l=0;l < numLoops;l++) {
+        for (int32_t p=0;p < numLoops;p++) {
+            if (order[p] == l && p > deepest)
+                deepest = p;
+        }
+        placement[l] = deepest;
+    }
+
+    std::map<Value *,Value *> clonedValues;
+    for (int32_t p=0;p < numLoops;p++) {
+        Op_ForLoopUp *loop = n._loops[order[p]];
+        LocalSymbol *loopVariable = loop->loopVariable();
+        Value *initial = loop->initialValue();
+        Value *final = loop->finalValue();
+        if (!tileSizes.empty()) {
+            initial = tileStarts[order[p]];
+            final = _base->Add(LOC, current, initial, constant(current, loopVariable->type(), tileSizes.back()));
+        }
+        ForLoopBuilder *pointLoop = _base->ForLoopUp(LOC, current, loopVariable, initial, final, loop->bumpValue());
+        Builder *body = pointLoop->loopBody();
+        if (!tileSizes.empty())
+            _base->IfCmpGreaterOrEqual(LOC, body, pointLoop->loopBreak(), _base->Load(LOC, body, loopVariable), loop->finalValue());
+
+        for (int32_t l=0;l < numLoops;l++) {
+            if (placement[l] == p)
+                clonePrefix(body, n._loops[l], clonedValues);
+        }
+        current = body;
+    }
+
+    // every loop ran to completion, so each loop variable ends at its final value
+    for (int32_t l=0;l < numLoops;l++)
+        _base->Store(LOC, g, n._loops[l]->loopVariable(), n._loops[l]->finalValue());
+
+    // otherwise run the original nest (which reuses the original bodies)
+    ForLoopBuilder *fallbackLoop = _base->ForLoopUp(LOC, b, guard, _base->Load(LOC, b, guard), one, one);
+    OperationCloner cloner(outer);
+    fallbackLoop->loopBody()->appendClone(outer, &cloner);
+    for (int32_t l=0;l < numLoops;l++)
+        _transformed.insert(n._loops[l]->loopBody());
+
+    return b;
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#ifndef LOOPNESTOPTIMIZER_INCL
+#define LOOPNESTOPTIMIZER_INCL
+
+#include <stdint.h>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "Transformer.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class Compiler;
+class Literal;
+class Operation;
+class Symbol;
+class Type;
+class Value;
+
+namespace Base {
+
+class BaseExtension;
+class Op_ForLoopUp;
+
+// LoopNestOptimizer interchanges and tiles perfectly nested ForLoopUp loops. A nest is perfect
+// if every loop but the innermost has a body made only of pure address arithmetic (Const, Load,
+// Add, Sub, Mul, ConvertTo, IndexAt) followed by the next loop, and the innermost body is
+// straight line code that also does LoadAt and StoreAt through IndexAt(base, index). Every loop
+// must have a bump of 1 and bounds computed before the nest (i.e. the nest is rectangular).
+//
+// Each index is decomposed into a linear function of the loop variables. The loop whose
+// variable gives the most accesses a unit (or zero) stride is moved innermost, e.g. the i-j-k
+// matrix multiply C[i,j] += A[i,k] * B[k,j] becomes i-k-j. Then, if Config::loopTileSize() is at
+// least 2, every loop is split into a tile loop and a point loop that runs loopTileSize()
+// iterations (L1 blocking); Config::loopOuterTileSize(), if a multiple of loopTileSize(), adds a
+// second level of tile loops outside those (L2 blocking).
+//
+// Reordering is only done if every array that is stored is accessed with the same index
+// everywhere in the nest and that index depends on all but at most one of the loop variables,
+// which means each element is only ever updated in the order of that one loop. Accesses through
+// a different base than a stored array must be proven not to overlap it by AliasAnalysis (e.g.
+// both bases are loaded from noAlias parameters), otherwise the nest is left alone. That the
+// stored index maps distinct iterations of the other loops to distinct elements is checked at
+// run time: ordered by the size of their coefficients, each loop variable's coefficient must be
+// larger than the span of the index over the loops before it (e.g. A[i*N+j] requires N > n-1
+// for n iterations of j). If that does not hold, the original nest runs instead.
+class LoopNestOptimizer : public Transformer {
+public:
+    LoopNestOptimizer(Compiler *compiler);
+
+protected:
+    virtual void visitPreCompilation(Compilation * comp);
+    virtual Builder * transformOperation(Operation * op);
+
+    // multiplier of one loop variable in an index: _known is false if it is only known at run time,
+    // in which case it is _value * _factor, or cannot be computed if _factor is NULL
+    struct Coefficient {
+        bool _known;
+        int64_t _value;
+        Value *_factor;
+    };
+    typedef std::map<Symbol *,Coefficient> Coefficients; // loop variables that do not appear have no entry
+
+    struct Access {
+        Operation *_op;        // LoadAt or StoreAt
+        bool _isStore;
+        std::string _base;     // text of the IndexAt base
+        Value *_baseValue;     // the IndexAt base
+        std::string _index;    // text of the IndexAt index
+        Coefficients _coefficients;
+    };
+
+    struct Nest {
+        std::vector<Op_ForLoopUp *> _loops; // outermost first
+        std::vector<Access> _accesses;
+    };
+
+    bool collectNest(Nest & n);
+    bool isPrefixOperation(Operation *op) const;
+    bool analyzeAccesses(Nest & n);
+    bool isLegal(Nest & n);
+    int32_t score(Nest & n, Symbol *loopVariable);
+    std::vector<int32_t> chooseOrder(Nest & n);
+
+    bool linear(Value *v, Coefficients & coefficients);
+    std::string text(Value *v);
+    Literal *literalValue(Value *v);
+    Value *constant(Builder *b, const Type *type, int64_t v);
+
+    Builder * transform(Nest & n, std::vector<int32_t> & order, std::vector<int32_t> & tileSizes);
+    void clonePrefix(Builder *b, Op_ForLoopUp *loop, std::map<Value *,Value *> & clonedValues);
+    Value *materialize(Builder *b, Value *v, std::map<Value *,Value *> & clonedValues);
+    Value *toInt64(Builder *b, Value *v);
+    void checkDistinctElements(Builder *b, Builder *fail, Nest & n);
+
+    BaseExtension *_base;
+    Builder *_nestParent;                        // builder holding the outermost loop
+    std::map<Value *,Operation *> _definitions;  // operations in the bodies of the current nest
+    std::set<Symbol *> _loopVariables;
+    std::set<Builder *> _transformed;            // bodies of loops in nests already transformed
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(LOOPNESTOPTIMIZER_INCL)
@@ -0,0 +1,242 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+#include "BaseExtension.hpp"
+#include "BaseSymbols.hpp"
+#include "BaseTypes.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "ControlOperations.hpp"
+#include "Function.hpp"
+#include "FunctionCompilation.hpp"
+#include "FunctionProfile.hpp"
+#include "Literal.hpp"
+#include "LoopUnroller.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "Value.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+LoopUnroller::LoopUnroller(Compiler *compiler)
+    : Transformer(compiler, std::string("LoopUnroller"))
+    , _base(compiler->lookupExtension<BaseExtension>()) {
+
+}
+
+void
+LoopUnroller::visitPreCompilation(Compilation * comp) {
+    setTraceEnabled(_comp->config()->traceLoopUnroller());
+}
+
+// only straight line bodies that always reach their end and never write the loop variable
+bool
+LoopUnroller::canUnroll(Op_ForLoopUp *loop) {
+    Builder *body = loop->loopBody();
+    if (!body->controlReachesEnd() || body->numOperations() == 0)
+        return false;
+
+    for (OperationIterator opIt = body->OperationsBegin(); opIt != body->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        if (op->numBuilders() > 0)
+            return false;
+
+        if (op->action() != _base->aLoad) {
+            for (int32_t s=0;s < op->numSymbols();s++) {
+                if (op->symbol(s) == loop->loopVariable())
+                    return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// returns the Literal if v is produced by a Const operation in b, otherwise NULL
+Literal *
+LoopUnroller::literalValue(Builder *b, Value *v) {
+    for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        if (op->action() == _base->aConst && op->result() == v)
+            return op->literal();
+    }
+    return NULL;
+}
+
+Value *
+LoopUnroller::constant(Builder *b, const Type *type, int64_t v) {
+    if (type == _base->Int8)
+        return _base->ConstInt8(LOC, b, (int8_t) v);
+    else if (type == _base->Int16)
+        return _base->ConstInt16(LOC, b, (int16_t) v);
+    else if (type == _base->Int32)
+        return _base->ConstInt32(LOC, b, (int32_t) v);
+    assert(type == _base->Int64);
+    return _base->ConstInt64(LOC, b, v);
+}
+
+int64_t
+LoopUnroller::minValue(const Type *type) {
+    if (type == _base->Int8)
+        return std::numeric_limits<int8_t>::min();
+    else if (type == _base->Int16)
+        return std::numeric_limits<int16_t>::min();
+    else if (type == _base->Int32)
+        return std::numeric_limits<int32_t>::min();
+    assert(type == _base->Int64);
+    return std::numeric_limits<int64_t>::min();
+}
+
+// appends a copy of the loop body to b, where every Load of the loop variable is replaced by iterationValue
+void
+LoopUnroller::cloneBody(Builder *b, Op_ForLoopUp *loop, Value *iterationValue) {
+    std::map<Value *,Value *> clonedValues;
+    Builder *body = loop->loopBody();
+    for (OperationIterator opIt = body->OperationsBegin(); opIt != body->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        if (op->action() == _base->aLoad && op->symbol() == loop->loopVariable()) {
+            clonedValues[op->result()] = iterationValue;
+            continue;
+        }
+
+        OperationCloner cloner(op);
+        for (int32_t o=0;o < op->numOperands();o++) {
+            auto found = clonedValues.find(op->operand(o));
+            if (found != clonedValues.end())
+                cloner.changeOperand(found->second, o);
+        }
+        for (int32_t r=0;r < op->numResults();r++) {
+            cloner.createResult(b, r);
+            clonedValues[op->result(r)] = cloner.result(r);
+        }
+        b->appendClone(op, &cloner);
+    }
+}
+
+// average iterations per entry of loop in the Function's profile, or -1 if there is none
+int64_t
+LoopUnroller::profiledTripCount(Op_ForLoopUp *loop) {
+    FunctionProfile *profile = static_cast<FunctionCompilation *>(_comp)->func()->profile();
+    if (profile == NULL || !profile->hasData())
+        return -1;
+    int64_t entries = profile->loopEntries(loop->id());
+    if (entries <= 0)
+        return entries; // never entered (0) or not profiled (-1)
+    return profile->averageTripCount(loop->id(), loop->loopBody()->id());
+}
+
+Builder *
+LoopUnroller::transformOperation(Operation * op) {
+    if (op->action() != _base->aForLoopUp)
+        return NULL;
+
+    Op_ForLoopUp *loop = static_cast<Op_ForLoopUp *>(op);
+    if (loop->parent()->isCold() || !canUnroll(loop))
+        return NULL;
+
+    Config *config = _comp->config();
+    Literal *initialLiteral = literalValue(loop->parent(), loop->initialValue());
+    Literal *finalLiteral = literalValue(loop->parent(), loop->finalValue());
+    Literal *bumpLiteral = literalValue(loop->parent(), loop->bumpValue());
+    if (initialLiteral && finalLiteral && bumpLiteral) {
+        int64_t initial = initialLiteral->getInteger();
+        int64_t final = finalLiteral->getInteger();
+        int64_t bump = bumpLiteral->getInteger();
+        if (bump > 0) {
+            uint64_t tripCount = 0;
+            if (final > initial) {
+                uint64_t span = (uint64_t)final - (uint64_t)initial;
+                tripCount = span / bump + ((span % bump != 0) ? 1 : 0);
+            }
+            if (tripCount <= (uint64_t) config->loopFullUnrollLimit())
+                return fullyUnroll(loop, initial, bump, (int64_t) tripCount);
+        }
+    }
+
+    int32_t factor = config->loopUnrollFactor();
+    int64_t tripCount = profiledTripCount(loop);
+    if (tripCount >= 0) {
+        while (factor >= 2 && factor > tripCount)
+            factor /= 2;
+    }
+    if (factor >= 2)
+        return unroll(loop, factor);
+
+    return NULL;
+}
+
+Builder *
+LoopUnroller::fullyUnroll(Op_ForLoopUp *loop, int64_t initial, int64_t bump, int64_t tripCount) {
+    Builder *b = _base->OrphanBuilder(LOC, loop->parent());
+    LocalSymbol *loopVariable = loop->loopVariable();
+    const Type *type = loopVariable->type();
+    for (int64_t k=0;k < tripCount;k++)
+        cloneBody(b, loop, constant(b, type, initial + k*bump));
+
+    // leave the loop variable with the value it would have after the loop
+    _base->Store(LOC, b, loopVariable, constant(b, type, initial + tripCount*bump));
+    return b;
+}
+
+Builder *
+LoopUnroller::unroll(Op_ForLoopUp *loop, int32_t factor) {
+    Builder *b = _base->OrphanBuilder(LOC, loop->parent());
+    LocalSymbol *loopVariable = loop->loopVariable();
+
+    // multiples of bump: bumps[k] == k*bump
+    std::vector<Value *> bumps(factor+1);
+    bumps[1] = loop->bumpValue();
+    for (int32_t k=2;k <= factor;k++)
+        bumps[k] = _base->Add(LOC, b, bumps[k-1], loop->bumpValue());
+
+    // main loop runs while all factor iterations would have run in the original loop; if final is
+    // within (factor-1)*bump of the type's minimum value that subtraction would wrap, but then no
+    // iteration can be a first of factor iterations so the main loop is skipped
+    const Type *type = loopVariable->type();
+    Value *minimum = constant(b, type, minValue(type));
+    Value *wraps = _base->LessThan(LOC, b, loop->finalValue(), _base->Add(LOC, b, minimum, bumps[factor-1]));
+    Value *mainFinal = _base->Select(LOC, b, wraps, loop->initialValue(), _base->Sub(LOC, b, loop->finalValue(), bumps[factor-1]));
+    ForLoopBuilder *mainLoop = _base->ForLoopUp(LOC, b, loopVariable, loop->initialValue(), mainFinal, bumps[factor]);
+    Builder *mainBody = mainLoop->loopBody();
+    Value *i = _base->Load(LOC, mainBody, loopVariable);
+    cloneBody(mainBody, loop, i);
+    for (int32_t k=1;k < factor;k++)
+        cloneBody(mainBody, loop, _base->Add(LOC, mainBody, i, bumps[k]));
+
+    // the original loop runs any remaining iterations, starting from where the main loop stopped
+    OperationCloner cloner(loop);
+    cloner.changeOperand(_base->Load(LOC, b, loopVariable), 0);
+    b->appendClone(loop, &cloner);
+
+    return b;
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef LOOPUNROLLER_INCL
+#define LOOPUNROLLER_INCL
+
+#include <stdint.h>
+#include "Transformer.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class Compiler;
+class Literal;
+class Operation;
+class Type;
+class Value;
+
+namespace Base {
+
+class BaseExtension;
+class LocalSymbol;
+class Op_ForLoopUp;
+
+// LoopUnroller replicates the body of innermost ForLoopUp loops (bodies that contain no
+// nested builders). A loop whose initial, final and bump values are all literals and whose
+// trip count is at most Config::loopFullUnrollLimit() is replaced by that many copies of its
+// body. Any other loop is unrolled by Config::loopUnrollFactor(): a main loop executes
+// factor copies of the body per iteration and the original loop then runs the remaining
+// (fewer than factor) iterations. Loops in cold Builders are not unrolled, and if the Function
+// has a profile (see Function::SetProfile()) the factor is halved until it is no larger than
+// the loop's measured average trip count.
+class LoopUnroller : public Transformer {
+public:
+    LoopUnroller(Compiler *compiler);
+
+protected:
+    virtual void visitPreCompilation(Compilation * comp);
+    virtual Builder * transformOperation(Operation * op);
+
+    bool canUnroll(Op_ForLoopUp *loop);
+    int64_t profiledTripCount(Op_ForLoopUp *loop);
+    Literal *literalValue(Builder *b, Value *v);
+    Value *constant(Builder *b, const Type *type, int64_t v);
+    int64_t minValue(const Type *type);
+    void cloneBody(Builder *b, Op_ForLoopUp *loop, Value *iterationValue);
+
+    Builder * fullyUnroll(Op_ForLoopUp *loop, int64_t initial, int64_t bump, int64_t tripCount);
+    Builder * unroll(Op_ForLoopUp *loop, int32_t factor);
+
+    BaseExtension *_base;
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(LOOPUNROLLER_INCL)
@@ -82,12 +82,13 @@ Op_Store::jbgen(JB1MethodBuilder *j1mb) const {
 // LoadAt
 //
 Op_LoadAt::Op_LoadAt(LOCATION, Extension *ext, Builder * parent, ActionID aLoadAt, Value *result, Value *ptrValue)
-    : OperationR1V1(PASSLOC, aLoadAt, ext, parent, result, ptrValue) {
+    : OperationR1V1(PASSLOC, aLoadAt, ext, parent, result, ptrValue)
+    , _aliasClass(static_cast<BaseExtension *>(ext)->TypeAliasClass(result->type())) {
 }
 
 Operation *
 Op_LoadAt::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
-    return new Op_LoadAt(PASSLOC, this->_ext, b, this->action(), this->result(), this->operand());
+    return new Op_LoadAt(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand());
 }
 
 void
@@ -100,12 +101,13 @@ Op_LoadAt::jbgen(JB1MethodBuilder *j1mb) const {
 // StoreAt
 //
 Op_StoreAt::Op_StoreAt(LOCATION, Extension *ext, Builder * parent, ActionID aStoreAt, Value *ptrValue, Value *value)
-    : OperationR0V2(PASSLOC, aStoreAt, ext, parent, ptrValue, value) {
+    : OperationR0V2(PASSLOC, aStoreAt, ext, parent, ptrValue, value)
+    , _aliasClass(static_cast<BaseExtension *>(ext)->TypeAliasClass(value->type())) {
 }
 
 Operation *
 Op_StoreAt::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
-    return new Op_StoreAt(PASSLOC, this->_ext, b, this->action(), cloner->operand(0), this->operand(1));
+    return new Op_StoreAt(PASSLOC, this->_ext, b, this->action(), cloner->operand(0), cloner->operand(1));
 }
 
 void
@@ -118,7 +120,8 @@ Op_StoreAt::jbgen(JB1MethodBuilder *j1mb) const {
 // LoadField
 //
 Op_LoadField::Op_LoadField(LOCATION, Extension *ext, Builder * parent, ActionID aLoadField, Value *result, const FieldType *fieldType, Value *structValue)
-    : OperationR1V1T1(PASSLOC, aLoadField, ext, parent, result, fieldType, structValue) {
+    : OperationR1V1T1(PASSLOC, aLoadField, ext, parent, result, fieldType, structValue)
+    , _aliasClass(static_cast<BaseExtension *>(ext)->FieldAliasClass(fieldType)) {
 }
 
 Operation *
@@ -136,7 +139,8 @@ Op_LoadField::jbgen(JB1MethodBuilder *j1mb) const {
 // StoreField
 //
 Op_StoreField::Op_StoreField(LOCATION, Extension *ext, Builder * parent, ActionID aStoreField, const FieldType *fieldType, Value *structValue, Value *value)
-    : OperationR0T1V2(PASSLOC, aStoreField, ext, parent, fieldType, structValue, value) {
+    : OperationR0T1V2(PASSLOC, aStoreField, ext, parent, fieldType, structValue, value)
+    , _aliasClass(static_cast<BaseExtension *>(ext)->FieldAliasClass(fieldType)) {
 }
 
 Operation *
@@ -154,7 +158,8 @@ Op_StoreField::jbgen(JB1MethodBuilder *j1mb) const {
 // LoadFieldAt
 //
 Op_LoadFieldAt::Op_LoadFieldAt(LOCATION, Extension *ext, Builder * parent, ActionID aLoadFieldAt, Value *result, const FieldType *fieldType, Value *pStruct)
-    : OperationR1V1T1(PASSLOC, aLoadFieldAt, ext, parent, result, fieldType, pStruct) {
+    : OperationR1V1T1(PASSLOC, aLoadFieldAt, ext, parent, result, fieldType, pStruct)
+    , _aliasClass(static_cast<BaseExtension *>(ext)->FieldAliasClass(fieldType)) {
 }
 
 Operation *
@@ -174,7 +179,8 @@ Op_LoadFieldAt::jbgen(JB1MethodBuilder *j1mb) const {
 // StoreFieldAt
 //
 Op_StoreFieldAt::Op_StoreFieldAt(LOCATION, Extension *ext, Builder * parent, ActionID aStoreFieldAt, const FieldType *fieldType, Value *pStruct, Value *value)
-    : OperationR0T1V2(PASSLOC, aStoreFieldAt, ext, parent, fieldType, pStruct, value) {
+    : OperationR0T1V2(PASSLOC, aStoreFieldAt, ext, parent, fieldType, pStruct, value)
+    , _aliasClass(static_cast<BaseExtension *>(ext)->FieldAliasClass(fieldType)) {
 }
 
 Operation *
@@ -29,12 +29,18 @@ namespace OMR {
 namespace JitBuilder {
 namespace Base {
 
+class AliasSymbol;
+
 class Op_Load : public OperationR1S1 {
     friend class BaseExtension;
 public:
     virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
     virtual void jbgen(JB1MethodBuilder *j1mb) const;
 
+    virtual int32_t numReadSymbols() const { return 1; }
+    virtual Symbol * readSymbol(int i=0) const { return (i == 0) ? _symbol : NULL; }
+    virtual SymbolIterator ReadSymbolsBegin() { return SymbolIterator(_symbol); }
+
 protected:
     Op_Load(LOCATION, Extension *ext, Builder * parent, ActionID aLoad, Value *result, Symbol *s);
     };
@@ -45,6 +51,10 @@ public:
     virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
     virtual void jbgen(JB1MethodBuilder *j1mb) const;
 
+    virtual int32_t numWrittenSymbols() const { return 1; }
+    virtual Symbol * writtenSymbol(int i=0) const { return (i == 0) ? _symbol : NULL; }
+    virtual SymbolIterator WrittenSymbolsBegin() { return SymbolIterator(_symbol); }
+
 protected:
     Op_Store(LOCATION, Extension *ext, Builder * parent, ActionID aStore, Symbol *s, Value *value);
 };
@@ -55,8 +65,13 @@ public:
     virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
     virtual void jbgen(JB1MethodBuilder *j1mb) const;
 
+    virtual int32_t numMayReadSymbols() const { return 1; }
+    virtual Symbol * mayReadSymbol(int i=0) const { return (i == 0) ? _aliasClass : NULL; }
+
 protected:
     Op_LoadAt(LOCATION, Extension *ext, Builder * parent, ActionID aLoadAt, Value *result, Value *value);
+
+    AliasSymbol *_aliasClass;
 };
 
 class Op_StoreAt : public OperationR0V2 {
@@ -65,8 +80,13 @@ public:
     virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
     virtual void jbgen(JB1MethodBuilder *j1mb) const;
 
+    virtual int32_t numMayWriteSymbols() const { return 1; }
+    virtual Symbol * mayWriteSymbol(int i=0) const { return (i == 0) ? _aliasClass : NULL; }
+
 protected:
     Op_StoreAt(LOCATION, Extension *ext, Builder * parent, ActionID aStoreAt, Value *address, Value *value);
+
+    AliasSymbol *_aliasClass;
 };
 
 class Op_LoadField : public OperationR1V1T1 {
@@ -75,8 +95,13 @@ public:
     virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
     virtual void jbgen(JB1MethodBuilder *j1mb) const;
 
+    virtual int32_t numMayReadSymbols() const { return 1; }
+    virtual Symbol * mayReadSymbol(int i=0) const { return (i == 0) ? _aliasClass : NULL; }
+
 protected:
     Op_LoadField(LOCATION, Extension *ext, Builder * parent, ActionID aLoadField, Value *result, const FieldType *fieldType, Value *structValue);
+
+    AliasSymbol *_aliasClass;
 };
 
 class Op_StoreField : public OperationR0T1V2 {
@@ -85,8 +110,13 @@ public:
     virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
     virtual void jbgen(JB1MethodBuilder *j1mb) const;
 
+    virtual int32_t numMayWriteSymbols() const { return 1; }
+    virtual Symbol * mayWriteSymbol(int i=0) const { return (i == 0) ? _aliasClass : NULL; }
+
 protected:
     Op_StoreField(LOCATION, Extension *ext, Builder * parent, ActionID aStoreField, const FieldType *fieldType, Value *structValue, Value *value);
+
+    AliasSymbol *_aliasClass;
 };
 
 class Op_LoadFieldAt : public OperationR1V1T1 {
@@ -95,8 +125,13 @@ public:
     virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
     virtual void jbgen(JB1MethodBuilder *j1mb) const;
 
+    virtual int32_t numMayReadSymbols() const { return 1; }
+    virtual Symbol * mayReadSymbol(int i=0) const { return (i == 0) ? _aliasClass : NULL; }
+
 protected:
     Op_LoadFieldAt(LOCATION, Extension *ext, Builder * parent, ActionID aLoadFieldAt, Value *result, const FieldType *fieldType, Value *pStruct);
+
+    AliasSymbol *_aliasClass;
 };
 
 class Op_StoreFieldAt : public OperationR0T1V2 {
@@ -105,8 +140,13 @@ public:
     virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
     virtual void jbgen(JB1MethodBuilder *j1mb) const;
 
+    virtual int32_t numMayWriteSymbols() const { return 1; }
+    virtual Symbol * mayWriteSymbol(int i=0) const { return (i == 0) ? _aliasClass : NULL; }
+
 protected:
     Op_StoreFieldAt(LOCATION, Extension *ext, Builder * parent, ActionID aStoreFieldAt, const FieldType *fieldType, Value *pStruct, Value *value);
+
+    AliasSymbol *_aliasClass;
 };
 
 class Op_CreateLocalArray : public OperationR1L1T1 {
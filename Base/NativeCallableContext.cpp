@@ -36,8 +36,8 @@ LocalSymbolIterator NativeCallableContext::endLocalSymbolIterator;
 ParameterSymbolIterator NativeCallableContext::endParameterSymbolIterator;
 
 ParameterSymbol *
-NativeCallableContext::DefineParameter(std::string name, const Type * type) {
-    ParameterSymbol *parm = new ParameterSymbol(name, type, this->_parameters.size());
+NativeCallableContext::DefineParameter(std::string name, const Type * type, bool noAlias) {
+    ParameterSymbol *parm = new ParameterSymbol(name, type, this->_parameters.size(), noAlias);
     this->_parameters.push_back(parm);
     addSymbol(parm);
     return parm;
@@ -46,7 +46,7 @@ class NativeCallableContext : public Context {
     friend class Function;
 
 public:
-    ParameterSymbol * DefineParameter(std::string name, const Type * type);
+    ParameterSymbol * DefineParameter(std::string name, const Type * type, bool noAlias=false);
     LocalSymbol * DefineLocal(std::string name, const Type * type);
     void DefineReturnType(const Type * type) {
         _returnTypes.push_back(type);
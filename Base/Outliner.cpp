@@ -0,0 +1,449 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <algorithm>
+#include <assert.h>
+#include <map>
+#include <string>
+#include "BaseExtension.hpp"
+#include "BaseSymbols.hpp"
+#include "BaseTypes.hpp"
+#include "Builder.hpp"
+#include "ColdBuilderLayout.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "ControlFlowGraph.hpp"
+#include "Function.hpp"
+#include "FunctionCompilation.hpp"
+#include "FunctionProfile.hpp"
+#include "Literal.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "Outliner.hpp"
+#include "TextWriter.hpp"
+#include "TypeDictionary.hpp"
+#include "Value.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+// the Function a region is copied into: its IL is built from the region's operations
+class OutlinedFunction : public Function {
+public:
+    OutlinedFunction(Compiler *compiler, Outliner *outliner, Outliner::Region *region)
+        : Function(compiler)
+        , _outliner(outliner)
+        , _region(region) {
+
+    }
+
+    virtual bool buildIL() {
+        return _outliner->buildOutlinedIL(this);
+    }
+
+    Outliner *_outliner;
+    Outliner::Region *_region;
+    std::map<Value *,Value *> _values;
+    std::map<Symbol *,Symbol *> _symbols;
+    std::map<Builder *,Builder *> _builders;
+    std::map<const Type *,const Type *> _mappedTypes;
+};
+
+Outliner::Outliner(Compiler *compiler, StrategyID outlinedStrategy)
+    : Pass(compiler, std::string("Outliner"))
+    , _base(compiler->lookupExtension<BaseExtension>())
+    , _outlinedStrategy(outlinedStrategy) {
+
+}
+
+bool
+Outliner::isKnownType(const Type *type) const {
+    return type == NULL || _knownTypes.find(type) != _knownTypes.end();
+}
+
+// true if an outlined Function can refer to type: pointer Types are created per compilation,
+// so pointers to known Types are recreated in the outlined Function
+bool
+Outliner::isMappable(const Type *type) const {
+    if (isKnownType(type))
+        return true;
+    if (!type->isKind<PointerType>())
+        return false;
+    return isMappable(static_cast<const PointerType *>(type)->baseType());
+}
+
+const Type *
+Outliner::mapType(Function *outlined, const Type *type) {
+    if (isKnownType(type))
+        return type;
+
+    OutlinedFunction *of = static_cast<OutlinedFunction *>(outlined);
+    auto found = of->_mappedTypes.find(type);
+    if (found != of->_mappedTypes.end())
+        return found->second;
+
+    assert(type->isKind<PointerType>());
+    const Type *baseType = mapType(outlined, static_cast<const PointerType *>(type)->baseType());
+    const Type *pointerType = outlined->PointerTo(LOC, baseType);
+    of->_mappedTypes[type] = pointerType;
+    return pointerType;
+}
+
+bool
+Outliner::isCandidate(Function *func, Builder *b) {
+    if (b->isBound() || b->numOperations() == 0)
+        return false;
+    if (b->isCold())
+        return true;
+
+    FunctionProfile *profile = func->profile();
+    if (profile == NULL || !profile->hasData())
+        return false;
+    int64_t count = profile->builderCount(b->id());
+    int64_t entries = profile->builderCount(func->builderEntry()->id());
+    return count >= 0 && entries > 0 && count * 100 <= entries * ColdBuilderLayout::ColdProbability;
+}
+
+// adds b's operations to the size of r and collects the Values they define and use and the Symbols
+// they reference; returns false if an outlined Function could not contain one of them
+bool
+Outliner::addOperations(Builder *b, Region & r, std::set<Value *> & defined, std::vector<Value *> & used) {
+    for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        r._size++;
+
+        for (int32_t res=0;res < op->numResults();res++) {
+            if (!isMappable(op->result(res)->type()))
+                return false;
+            defined.insert(op->result(res));
+        }
+        for (int32_t o=0;o < op->numOperands();o++)
+            used.push_back(op->operand(o));
+        for (int32_t t=0;t < op->numTypes();t++) {
+            if (!isMappable(op->type(t)))
+                return false;
+        }
+        for (int32_t l=0;l < op->numLiterals();l++) {
+            if (!isKnownType(op->literal(l)->type()))
+                return false;
+        }
+
+        for (int32_t s=0;s < op->numSymbols();s++) {
+            Symbol *sym = op->symbol(s);
+            if (sym->isKind<FunctionSymbol>()) {
+                // the outlined Function declares the same function, so it must know all its Types
+                FunctionSymbol *function = sym->refine<FunctionSymbol>();
+                const FunctionType *type = function->functionType();
+                if (!isKnownType(type->returnType()))
+                    return false;
+                for (int32_t p=0;p < type->numParms();p++) {
+                    if (!isKnownType(type->parmTypes()[p]))
+                        return false;
+                }
+                if (std::find(r._functions.begin(), r._functions.end(), function) == r._functions.end())
+                    r._functions.push_back(function);
+            }
+            else if (sym->isKind<LocalSymbol>() && isMappable(sym->type())) {
+                if (std::find(r._symbols.begin(), r._symbols.end(), sym) == r._symbols.end())
+                    r._symbols.push_back(sym);
+            }
+            else {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// the region headed by head is every Builder reachable from it; returns false if it cannot be outlined
+bool
+Outliner::findRegion(Compilation *comp, Builder *head, Region & r) {
+    ControlFlowGraph *cfg = comp->cfg();
+    r._head = head;
+    r._size = 0;
+
+    BuilderVector worklist;
+    worklist.push_back(head);
+    r._members.insert(head);
+    while (!worklist.empty()) {
+        Builder *b = worklist.back();
+        worklist.pop_back();
+        const BuilderVector & succs = cfg->successors(b);
+        for (auto it = succs.begin(); it != succs.end(); it++) {
+            if (r._members.find(*it) == r._members.end()) {
+                r._members.insert(*it);
+                worklist.push_back(*it);
+            }
+        }
+    }
+
+    // only the head may be reached from outside the region, and only from outside
+    for (auto it = r._members.begin(); it != r._members.end(); it++) {
+        Builder *b = *it;
+        const BuilderVector & preds = cfg->predecessors(b);
+        for (auto pIt = preds.begin(); pIt != preds.end(); pIt++) {
+            bool inRegion = r._members.find(*pIt) != r._members.end();
+            if (inRegion == (b == head))
+                return false;
+        }
+    }
+
+    std::set<Value *> defined;
+    std::vector<Value *> used;
+    const BuilderVector & rpo = cfg->reversePostOrder();
+    for (auto it = rpo.begin(); it != rpo.end(); it++) {
+        Builder *b = *it;
+        if (r._members.find(b) == r._members.end())
+            continue;
+
+        if (!b->isBound()) {
+            // control must not fall out of the end of the Builder
+            if (b->numOperations() == 0)
+                return false;
+            ActionID last = b->operations().back()->action();
+            if (last != _base->aReturn && last != _base->aGoto)
+                return false;
+            r._builders.push_back(b);
+        }
+
+        if (!addOperations(b, r, defined, used))
+            return false;
+    }
+
+    for (auto it = used.begin(); it != used.end(); it++) {
+        Value *v = *it;
+        if (defined.find(v) != defined.end())
+            continue;
+        if (!isMappable(v->type()))
+            return false;
+        if (std::find(r._liveIns.begin(), r._liveIns.end(), v) == r._liveIns.end())
+            r._liveIns.push_back(v);
+    }
+
+    return true;
+}
+
+// appends copies of from's operations to to, including copies of the builders bound to them
+void
+Outliner::cloneBuilder(Builder *from, Builder *to, OutlinedFunction *outlined) {
+    for (OperationIterator opIt = from->OperationsBegin(); opIt != from->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+
+        OperationCloner cloner(op);
+        for (int32_t o=0;o < op->numOperands();o++) {
+            auto found = outlined->_values.find(op->operand(o));
+            assert(found != outlined->_values.end());
+            cloner.changeOperand(found->second, o);
+        }
+        for (int32_t s=0;s < op->numSymbols();s++) {
+            auto found = outlined->_symbols.find(op->symbol(s));
+            if (found != outlined->_symbols.end())
+                cloner.changeSymbol(found->second, s);
+        }
+        for (int32_t i=0;i < op->numBuilders();i++) {
+            Builder *inner = op->builder(i);
+            if (inner->isBound() && inner->boundToOperation() == op)
+                cloner.changeBuilder(NULL, i); // the copy creates its own bound builder
+            else
+                cloner.changeBuilder(outlined->_builders[inner], i);
+        }
+        for (int32_t t=0;t < op->numTypes();t++)
+            cloner.changeType(mapType(outlined, op->type(t)), t);
+        for (int32_t r=0;r < op->numResults();r++) {
+            cloner.createResult(to, mapType(outlined, op->result(r)->type()), r);
+            outlined->_values[op->result(r)] = cloner.result(r);
+        }
+        Operation *copy = to->appendClone(op, &cloner);
+
+        for (int32_t i=0;i < op->numBuilders();i++) {
+            Builder *inner = op->builder(i);
+            if (inner->isBound() && inner->boundToOperation() == op)
+                cloneBuilder(inner, copy->builder(i), outlined);
+        }
+    }
+}
+
+bool
+Outliner::buildOutlinedIL(OutlinedFunction *outlined) {
+    Region & r = *outlined->_region;
+    Builder *entry = outlined->builderEntry();
+
+    for (auto it = r._symbols.begin(); it != r._symbols.end(); it++)
+        outlined->_symbols[*it] = outlined->getSymbol((*it)->name());
+    for (size_t v=0;v < r._liveIns.size();v++) {
+        Symbol *parm = outlined->getSymbol(std::string("_liveIn").append(std::to_string(v)));
+        outlined->_values[r._liveIns[v]] = _base->Load(LOC, entry, parm);
+    }
+
+    outlined->_builders[r._head] = entry;
+    for (auto it = r._builders.begin(); it != r._builders.end(); it++) {
+        if (*it != r._head)
+            outlined->_builders[*it] = _base->OrphanBuilder(LOC, entry);
+    }
+    for (auto it = r._builders.begin(); it != r._builders.end(); it++)
+        cloneBuilder(*it, outlined->_builders[*it], outlined);
+
+    return true;
+}
+
+// replaces r by a Call to a new Function holding a copy of it
+bool
+Outliner::outline(Compilation *comp, Region & r) {
+    TextWriter *log = comp->logger(traceEnabled());
+    Function *func = static_cast<FunctionCompilation *>(comp)->func();
+    std::string name = func->name() + std::string("_outlined") + std::to_string(r._head->id());
+    if (func->getSymbol(name) != NULL)
+        return false;
+
+    OutlinedFunction *outlined = new OutlinedFunction(_compiler, this, &r);
+    outlined->DefineName(name);
+    outlined->DefineFile(func->fileName());
+    outlined->DefineLine(func->lineNumber());
+    outlined->DefineReturnType(mapType(outlined, func->returnType()));
+
+    int32_t numParms = r._symbols.size() + r._liveIns.size();
+    const Type **parmTypes = new const Type*[numParms];
+    int32_t p = 0;
+    for (auto it = r._symbols.begin(); it != r._symbols.end(); it++) {
+        Symbol *sym = *it;
+        outlined->DefineParameter(sym->name(), mapType(outlined, sym->type()));
+        parmTypes[p++] = sym->type();
+    }
+    for (size_t v=0;v < r._liveIns.size();v++) {
+        const Type *type = r._liveIns[v]->type();
+        outlined->DefineParameter(std::string("_liveIn").append(std::to_string(v)), mapType(outlined, type));
+        parmTypes[p++] = type;
+    }
+    for (auto it = r._functions.begin(); it != r._functions.end(); it++) {
+        if (outlined->getSymbol((*it)->name()) == NULL)
+            outlined->DefineFunction(*it);
+    }
+
+    CompilerReturnCode rc = outlined->Compile(log, _outlinedStrategy);
+    outlined->_region = NULL;
+    if (rc != _compiler->CompileSuccessful || !outlined->hasNativeEntry()) {
+        // without native code there is nothing to call, so the region stays where it is
+        if (log) log->indent() << "Outliner: could not compile " << name << " to native code" << log->endl();
+        delete[] parmTypes;
+        delete outlined;
+        return false;
+    }
+
+    void *entryPoint = outlined->nativeEntry<void *>();
+    FunctionSymbol *target = func->DefineFunction(LOC, name, func->fileName(), func->lineNumber(), entryPoint, func->returnType(), numParms, parmTypes);
+    func->addOutlinedFunction(outlined);
+
+    // nothing outside the region uses its Values, so its operations can simply be dropped
+    Builder *head = r._head;
+    head->operations().clear();
+    Value **args = new Value *[numParms];
+    p = 0;
+    for (auto it = r._symbols.begin(); it != r._symbols.end(); it++)
+        args[p++] = _base->Load(LOC, head, *it);
+    for (auto it = r._liveIns.begin(); it != r._liveIns.end(); it++)
+        args[p++] = *it;
+    Value *result = _base->CallWithArgArray(LOC, head, target, numParms, args);
+    if (func->returnType() == _base->NoType)
+        _base->Return(LOC, head);
+    else
+        _base->Return(LOC, head, result);
+    delete[] args;
+
+    if (log) log->indent() << "Outliner: " << head << " (" << r._size << " operations) outlined to " << name << log->endl();
+    return true;
+}
+
+static bool
+largerRegion(const std::pair<int32_t,size_t> & r1, const std::pair<int32_t,size_t> & r2) {
+    return r1.first > r2.first || (r1.first == r2.first && r1.second < r2.second);
+}
+
+CompilerReturnCode
+Outliner::perform(Compilation *comp) {
+    setTraceEnabled(comp->config()->traceOutliner());
+    TextWriter *log = comp->logger(traceEnabled());
+
+    Function *func = static_cast<FunctionCompilation *>(comp)->func();
+    ControlFlowGraph *cfg = comp->cfg();
+    const BuilderVector & rpo = cfg->reversePostOrder();
+
+    int32_t size = 0;
+    for (auto it = rpo.begin(); it != rpo.end(); it++)
+        size += (*it)->numOperations();
+    int32_t maxSize = comp->config()->outlineMaxFunctionSize();
+    if (size <= maxSize)
+        return _compiler->CompileSuccessful;
+
+    _knownTypes.clear();
+    TypeDictionary *dict = _compiler->dict();
+    for (TypeIterator typeIt = dict->TypesBegin(); typeIt != dict->TypesEnd(); typeIt++)
+        _knownTypes.insert(*typeIt);
+    if (!isMappable(func->returnType()))
+        return _compiler->CompileSuccessful;
+
+    std::set<Builder *> entries;
+    for (int32_t e=0;e < cfg->numEntries();e++)
+        entries.insert(cfg->entry(e));
+
+    std::vector<Region> regions;
+    for (auto it = rpo.begin(); it != rpo.end(); it++) {
+        Builder *b = *it;
+        if (entries.find(b) != entries.end() || !isCandidate(func, b))
+            continue;
+        Region r;
+        if (findRegion(comp, b, r) && r._size >= MinRegionSize)
+            regions.push_back(r);
+    }
+
+    // largest regions first, in reverse postorder when sizes are equal
+    std::vector<std::pair<int32_t,size_t> > order;
+    for (size_t i=0;i < regions.size();i++)
+        order.push_back(std::make_pair(regions[i]._size, i));
+    std::sort(order.begin(), order.end(), largerRegion);
+
+    std::set<Builder *> outlined;
+    for (auto it = order.begin(); it != order.end() && size > maxSize; it++) {
+        Region & r = regions[it->second];
+        bool overlaps = false;
+        for (auto mIt = r._members.begin(); mIt != r._members.end(); mIt++) {
+            if (outlined.find(*mIt) != outlined.end())
+                overlaps = true;
+        }
+        if (overlaps || !outline(comp, r))
+            continue;
+
+        outlined.insert(r._members.begin(), r._members.end());
+        size -= r._size - r._head->numOperations();
+    }
+
+    if (!outlined.empty())
+        comp->invalidateCFG();
+    if (log) log->indent() << "Outliner: function now has " << size << " operations" << log->endl();
+
+    return _compiler->CompileSuccessful;
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+
+#ifndef OUTLINER_INCL
+#define OUTLINER_INCL
+
+#include <stdint.h>
+#include <set>
+#include <vector>
+#include "IDs.hpp"
+#include "Pass.hpp"
+#include "typedefs.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class Compilation;
+class Compiler;
+class Symbol;
+class Type;
+class Value;
+
+namespace Base {
+
+class BaseExtension;
+class Function;
+class FunctionSymbol;
+class OutlinedFunction;
+
+// Outliner keeps large Functions compact by moving cold code into separate Functions. If a
+// Function has more than Config::outlineMaxFunctionSize() operations, single entry regions of
+// cold Builders are outlined, largest first, until it fits (or there are none left). A Builder
+// heads a region if it is not bound to an operation, is not an entry, and is cold (see
+// Builder::isCold(), ColdBuilderLayout and ProfileFeedback) or its Function's profile shows it
+// ran for at most ColdBuilderLayout::ColdProbability percent of the Function's entries. The
+// region is every Builder reachable from its head; it can only be outlined if nothing else
+// reaches those Builders, so it must end in Returns, and each Builder that is not bound ends
+// with a Return or a Goto.
+//
+// The region is copied into a new Function compiled with the Strategy given to the Outliner
+// (NoStrategy generates code with the Base extension's default strategy) and the head is then
+// replaced by a Call to that Function's native entry point that returns its result. If that
+// Strategy does not generate native code, the region is left where it is. Every LocalSymbol or
+// ParameterSymbol the region uses, and every Value it uses but does not define, becomes a
+// parameter of the outlined Function. Regions that use Types other than the Compiler's own
+// Types and pointers to them, or Symbols other than locals, parameters and functions, are not
+// outlined. Outlined Functions are deleted along with the Function they were outlined from.
+class Outliner : public Pass {
+    friend class OutlinedFunction;
+
+public:
+    Outliner(Compiler *compiler, StrategyID outlinedStrategy=NoStrategy);
+
+    static const int32_t MinRegionSize = 4; // smaller regions are not worth a Call
+
+    virtual CompilerReturnCode perform(Compilation *comp);
+
+protected:
+    struct Region {
+        Builder *_head;
+        std::vector<Builder *> _builders;      // Builders not bound to an operation, in reverse postorder
+        std::set<Builder *> _members;          // all Builders in the region, including bound ones
+        std::vector<Symbol *> _symbols;        // LocalSymbols and ParameterSymbols passed as arguments
+        std::vector<Value *> _liveIns;         // Values passed as arguments
+        std::vector<FunctionSymbol *> _functions;
+        int32_t _size;
+    };
+
+    bool isCandidate(Function *func, Builder *b);
+    bool findRegion(Compilation *comp, Builder *head, Region & r);
+    bool addOperations(Builder *b, Region & r, std::set<Value *> & defined, std::vector<Value *> & used);
+    bool isKnownType(const Type *type) const;
+    bool isMappable(const Type *type) const;
+    const Type *mapType(Function *outlined, const Type *type);
+    bool outline(Compilation *comp, Region & r);
+    bool buildOutlinedIL(OutlinedFunction *outlined);
+    void cloneBuilder(Builder *from, Builder *to, OutlinedFunction *outlined);
+
+    BaseExtension *_base;
+    StrategyID _outlinedStrategy;
+    std::set<const Type *> _knownTypes;  // Types in the Compiler's dictionary
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(OUTLINER_INCL)
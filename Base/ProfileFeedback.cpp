@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <set>
+#include "BaseExtension.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "ControlFlowGraph.hpp"
+#include "Function.hpp"
+#include "FunctionCompilation.hpp"
+#include "FunctionProfile.hpp"
+#include "Operation.hpp"
+#include "ProfileFeedback.hpp"
+#include "TextWriter.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+ProfileFeedback::ProfileFeedback(Compiler *compiler)
+    : Pass(compiler, std::string("ProfileFeedback"))
+    , _base(compiler->lookupExtension<BaseExtension>()) {
+
+}
+
+bool
+ProfileFeedback::isIfCmp(ActionID a) const {
+    return a == _base->aIfCmpEqual
+        || a == _base->aIfCmpEqualZero
+        || a == _base->aIfCmpGreaterThan
+        || a == _base->aIfCmpGreaterOrEqual
+        || a == _base->aIfCmpLessThan
+        || a == _base->aIfCmpLessOrEqual
+        || a == _base->aIfCmpNotEqual
+        || a == _base->aIfCmpNotEqualZero
+        || a == _base->aIfCmpUnsignedGreaterThan
+        || a == _base->aIfCmpUnsignedGreaterOrEqual
+        || a == _base->aIfCmpUnsignedLessThan
+        || a == _base->aIfCmpUnsignedLessOrEqual;
+}
+
+CompilerReturnCode
+ProfileFeedback::perform(Compilation *comp) {
+    setTraceEnabled(comp->config()->traceProfileFeedback());
+    TextWriter *log = comp->logger(traceEnabled());
+
+    FunctionProfile *profile = static_cast<FunctionCompilation *>(comp)->func()->profile();
+    if (profile == NULL || !profile->hasData()) {
+        if (log) log->indent() << "ProfileFeedback: no profile data" << log->endl();
+        return _compiler->CompileSuccessful;
+    }
+
+    ControlFlowGraph *cfg = comp->cfg();
+    std::set<Builder *> entries;
+    for (int32_t e=0;e < cfg->numEntries();e++)
+        entries.insert(cfg->entry(e));
+
+    const BuilderVector & rpo = cfg->reversePostOrder();
+    for (auto it = rpo.begin(); it != rpo.end(); it++) {
+        Builder *b = *it;
+        if (profile->builderCount(b->id()) == 0 && entries.find(b) == entries.end()) {
+            if (log) log->indent() << "ProfileFeedback: " << b << " never ran, is cold" << log->endl();
+            b->setCold();
+        }
+
+        for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+            Operation *op = *opIt;
+            if (!isIfCmp(op->action()))
+                continue;
+            int8_t p = profile->takenProbability(op->id());
+            if (p != Operation::UnknownProbability) {
+                if (log) log->indent() << "ProfileFeedback: operation " << op->id() << " taken " << (int32_t) p << "%" << log->endl();
+                op->setTakenProbability(p);
+            }
+        }
+    }
+
+    return _compiler->CompileSuccessful;
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
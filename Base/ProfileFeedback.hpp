@@ -0,0 +1,64 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+
+#ifndef PROFILEFEEDBACK_INCL
+#define PROFILEFEEDBACK_INCL
+
+#include "Pass.hpp"
+#include "typedefs.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Compilation;
+class Compiler;
+
+namespace Base {
+
+class BaseExtension;
+
+// ProfileFeedback applies the counts in a Function's profile (see Function::SetProfile() and
+// ProfileInstrumentation) to the IL: each profiled IfCmp operation gets the takenProbability()
+// that was measured, and every Builder that was never entered is marked cold, so that
+// ColdBuilderLayout and code generation move it out of the way. The counts are found by
+// BuilderID and OperationID, so this pass must run before any pass that changes the IL, and the
+// profile must come from a Function that builds identical IL. Passes that run later can also
+// use the profile directly (e.g. LoopUnroller picks unroll factors from measured trip counts).
+// Nothing changes if the Function has no profile or the profiled code never ran.
+class ProfileFeedback : public Pass {
+public:
+    ProfileFeedback(Compiler *compiler);
+
+    virtual CompilerReturnCode perform(Compilation *comp);
+
+protected:
+    bool isIfCmp(ActionID a) const;
+
+    BaseExtension *_base;
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(PROFILEFEEDBACK_INCL)
@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "BaseExtension.hpp"
+#include "BaseTypes.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "ControlFlowGraph.hpp"
+#include "ControlOperations.hpp"
+#include "Function.hpp"
+#include "FunctionCompilation.hpp"
+#include "FunctionProfile.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "ProfileInstrumentation.hpp"
+#include "TextWriter.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+ProfileInstrumentation::ProfileInstrumentation(Compiler *compiler)
+    : Pass(compiler, std::string("ProfileInstrumentation"))
+    , _base(compiler->lookupExtension<BaseExtension>()) {
+
+}
+
+bool
+ProfileInstrumentation::isIfCmp(ActionID a) const {
+    return a == _base->aIfCmpEqual
+        || a == _base->aIfCmpEqualZero
+        || a == _base->aIfCmpGreaterThan
+        || a == _base->aIfCmpGreaterOrEqual
+        || a == _base->aIfCmpLessThan
+        || a == _base->aIfCmpLessOrEqual
+        || a == _base->aIfCmpNotEqual
+        || a == _base->aIfCmpNotEqualZero
+        || a == _base->aIfCmpUnsignedGreaterThan
+        || a == _base->aIfCmpUnsignedGreaterOrEqual
+        || a == _base->aIfCmpUnsignedLessThan
+        || a == _base->aIfCmpUnsignedLessOrEqual;
+}
+
+void
+ProfileInstrumentation::addCounters(Builder *b, FunctionProfile *profile) {
+    profile->addBuilder(b->id());
+    for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        if (isIfCmp(op->action()))
+            profile->addBranch(op->id());
+        else if (op->action() == _base->aForLoopUp)
+            profile->addLoop(op->id());
+    }
+}
+
+// appends to ops operations (parented by b) that add one to counter
+void
+ProfileInstrumentation::increment(Builder *b, Builder *scratch, const PointerType *counterType, int64_t *counter, OperationVector & ops) {
+    size_t first = scratch->operations().size();
+    Value *address = _base->ConstPointer(LOC, scratch, counterType, counter);
+    Value *count = _base->LoadAt(LOC, scratch, address);
+    _base->StoreAt(LOC, scratch, address, _base->Add(LOC, scratch, count, _base->ConstInt64(LOC, scratch, 1)));
+
+    OperationVector & scratchOps = scratch->operations();
+    for (size_t i=first;i < scratchOps.size();i++) {
+        OperationCloner cloner(scratchOps[i]);
+        ops.push_back(cloner.clone(b));
+    }
+}
+
+void
+ProfileInstrumentation::instrument(Builder *b, FunctionProfile *profile, const PointerType *counterType) {
+    Builder *scratch = _base->OrphanBuilder(LOC, b);
+    OperationVector ops;
+    increment(b, scratch, counterType, profile->builderCounter(b->id()), ops);
+
+    for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        if (isIfCmp(op->action())) {
+            increment(b, scratch, counterType, profile->branchCounter(op->id()), ops);
+            ops.push_back(op);
+            increment(b, scratch, counterType, profile->branchNotTakenCounter(op->id()), ops);
+        } else {
+            if (op->action() == _base->aForLoopUp)
+                increment(b, scratch, counterType, profile->loopCounter(op->id()), ops);
+            ops.push_back(op);
+        }
+    }
+
+    b->operations() = ops;
+}
+
+CompilerReturnCode
+ProfileInstrumentation::perform(Compilation *comp) {
+    setTraceEnabled(comp->config()->traceProfileInstrumentation());
+    TextWriter *log = comp->logger(traceEnabled());
+
+    FunctionCompilation *fc = static_cast<FunctionCompilation *>(comp);
+    FunctionProfile *profile = fc->func()->profile();
+    if (profile == NULL) {
+        if (log) log->indent() << "ProfileInstrumentation: function has no profile" << log->endl();
+        return _compiler->CompileSuccessful;
+    }
+
+    // the builders present now are the ones that get counters: builders created while adding
+    // the counting code below must not be counted
+    BuilderVector builders = comp->cfg()->reversePostOrder();
+
+    profile->reset();
+    for (auto it = builders.begin(); it != builders.end(); it++)
+        addCounters(*it, profile);
+    profile->allocate();
+
+    const PointerType *counterType = _base->PointerTo(LOC, fc, _base->Int64);
+    for (auto it = builders.begin(); it != builders.end(); it++) {
+        Builder *b = *it;
+        if (log) log->indent() << "ProfileInstrumentation: counting " << b << log->endl();
+        instrument(b, profile, counterType);
+    }
+
+    return _compiler->CompileSuccessful;
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
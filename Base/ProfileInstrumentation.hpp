@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+
+#ifndef PROFILEINSTRUMENTATION_INCL
+#define PROFILEINSTRUMENTATION_INCL
+
+#include <stdint.h>
+#include "Builder.hpp"
+#include "Pass.hpp"
+#include "typedefs.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Compilation;
+class Compiler;
+
+namespace Base {
+
+class BaseExtension;
+class FunctionProfile;
+class PointerType;
+
+// ProfileInstrumentation adds code to a Function that counts, in the FunctionProfile given to
+// Function::SetProfile(), how many times each Builder is entered, how many times each IfCmp
+// operation executes and falls through, and how many times each ForLoopUp loop is entered.
+// Counters are identified by BuilderID and OperationID, so this pass should run before any pass
+// that changes the IL, and the profile only describes Functions that build identical IL. Any
+// counters already in the profile are discarded. Functions without a profile are not changed.
+class ProfileInstrumentation : public Pass {
+public:
+    ProfileInstrumentation(Compiler *compiler);
+
+    virtual CompilerReturnCode perform(Compilation *comp);
+
+protected:
+    bool isIfCmp(ActionID a) const;
+    void addCounters(Builder *b, FunctionProfile *profile);
+    void instrument(Builder *b, FunctionProfile *profile, const PointerType *counterType);
+    void increment(Builder *b, Builder *scratch, const PointerType *counterType, int64_t *counter, OperationVector & ops);
+
+    BaseExtension *_base;
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(PROFILEINSTRUMENTATION_INCL)
@@ -0,0 +1,523 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <string>
+#include "BaseExtension.hpp"
+#include "BaseSymbols.hpp"
+#include "BaseTypes.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "ControlFlowGraph.hpp"
+#include "ControlOperations.hpp"
+#include "DominatorTree.hpp"
+#include "Function.hpp"
+#include "FunctionCompilation.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "SSAConstruction.hpp"
+#include "TextWriter.hpp"
+#include "Value.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+SSAConstruction::SSAConstruction(Compiler *compiler)
+    : Visitor(compiler, std::string("SSAConstruction"))
+    , _base(compiler->lookupExtension<BaseExtension>())
+    , _canPromote(false)
+    , _changedControlFlow(false)
+    , _prologue(NULL) {
+
+}
+
+bool
+SSAConstruction::isPromotable(const Type *type) const {
+    return type->isKind<NumericType>() || type->isKind<AddressType>();
+}
+
+void
+SSAConstruction::visitPreCompilation(Compilation * comp) {
+    setTraceEnabled(_comp->config()->traceSSAConstruction());
+
+    _changedControlFlow = false;
+    _promoted.clear();
+    _storedIn.clear();
+    _loopBodies.clear();
+    _merges.clear();
+    _mergedValues.clear();
+    _loopExits.clear();
+    _entryStates.clear();
+    _targets.clear();
+    _uses.clear();
+    _values.clear();
+    _joinValues.clear();
+    _initialValues.clear();
+    _prologue = NULL;
+
+    Function *func = static_cast<FunctionCompilation *>(_comp)->func();
+    for (LocalSymbolIterator lIt = func->LocalsBegin(); lIt != func->LocalsEnd(); lIt++) {
+        LocalSymbol *local = *lIt;
+        if (!local->isKind<ParameterSymbol>() && isPromotable(local->type()))
+            _promoted.insert(local);
+    }
+
+    ControlFlowGraph *cfg = _comp->cfg();
+    DominatorTree dominators(cfg);
+    std::map<Builder *,std::set<Symbol *> > stored;
+    _canPromote = scan(cfg, dominators, stored);
+    if (_canPromote)
+        placeMerges(cfg, dominators, stored);
+    else
+        _promoted.clear();
+
+    TextWriter *log = _comp->logger(traceEnabled());
+    if (log) {
+        for (auto it = _promoted.begin(); it != _promoted.end(); it++)
+            log->indent() << "Promoting " << (*it)->name() << log->endl();
+        for (auto it = _merges.begin(); it != _merges.end(); it++) {
+            for (auto sIt = it->second.begin(); sIt != it->second.end(); sIt++)
+                log->indent() << "Merging " << (*sIt)->name() << " at B" << it->first->id() << log->endl();
+        }
+    }
+}
+
+// collects the uses of every Value and the symbols each reachable builder defines (its Stores, and
+// everything stored by the loops it contains and, for a loop body, by the loop), and removes symbols
+// that cannot be promoted; returns false if the function's control flow cannot be handled
+bool
+SSAConstruction::scan(ControlFlowGraph *cfg, DominatorTree & dominators, std::map<Builder *,std::set<Symbol *> > & stored) {
+    Builder *entry = static_cast<FunctionCompilation *>(_comp)->func()->builderEntry();
+    if (cfg->numPredecessors(entry) > 0)
+        return false;
+
+    std::map<Builder *,std::set<Symbol *> > stores;
+    std::vector<ControlFlowEdge> exits;
+    const BuilderVector & rpo = cfg->reversePostOrder();
+    for (auto bIt = rpo.begin(); bIt != rpo.end(); bIt++) {
+        Builder *b = *bIt;
+        for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+            Operation *op = *opIt;
+            for (int32_t o=0;o < op->numOperands();o++)
+                _uses[op->operand(o)].insert(b);
+
+            if (op->action() == _base->aLoad)
+                continue;
+
+            if (op->action() == _base->aStore) {
+                stores[b].insert(op->symbol());
+                continue;
+            }
+
+            if (op->action() == _base->aForLoopUp) {
+                Op_ForLoopUp *loop = static_cast<Op_ForLoopUp *>(op);
+                _promoted.erase(loop->loopVariable());
+                stores[b].insert(loop->loopVariable());
+                if (loop->loopBreak()->numOperations() > 0 || loop->loopContinue()->numOperations() > 0)
+                    return false;
+                _storedIn[loop->loopBody()];
+                _loopBodies[loop->loopBreak()] = loop->loopBody();
+                _loopBodies[loop->loopContinue()] = loop->loopBody();
+                continue;
+            }
+
+            for (int32_t t=0;t < op->numBuilders();t++) {
+                Builder *target = op->builder(t);
+                if (target != NULL && target->isBound())
+                    exits.push_back(ControlFlowEdge(b, target));
+            }
+            for (int32_t s=0;s < op->numSymbols();s++)
+                _promoted.erase(op->symbol(s));
+        }
+
+        // control reaching the end of a branch target must go somewhere known
+        if (b != entry && !b->isBound() && !endsWithBranch(b)) {
+            ControlFlowEdgeVector edges;
+            b->controlFlowEdges(edges);
+            if (edges.empty())
+                return false;
+        }
+    }
+
+    // branches to bound builders can only leave a loop from inside it
+    for (auto it = exits.begin(); it != exits.end(); it++) {
+        auto found = _loopBodies.find(it->second);
+        if (found == _loopBodies.end() || !dominators.dominates(found->second, it->first))
+            return false;
+    }
+
+    // a loop stores every symbol stored in the builders its body dominates
+    for (auto lIt = _storedIn.begin(); lIt != _storedIn.end(); lIt++) {
+        for (auto bIt = rpo.begin(); bIt != rpo.end(); bIt++) {
+            if (dominators.dominates(lIt->first, *bIt)) {
+                std::set<Symbol *> & s = stores[*bIt];
+                lIt->second.insert(s.begin(), s.end());
+            }
+        }
+    }
+
+    for (auto bIt = rpo.begin(); bIt != rpo.end(); bIt++) {
+        Builder *b = *bIt;
+        std::set<Symbol *> & defs = stored[b];
+        std::set<Symbol *> & s = stores[b];
+        defs.insert(s.begin(), s.end());
+        for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+            if ((*opIt)->action() == _base->aForLoopUp) {
+                std::set<Symbol *> & inLoop = _storedIn[static_cast<Op_ForLoopUp *>(*opIt)->loopBody()];
+                defs.insert(inLoop.begin(), inLoop.end());
+            }
+        }
+        auto loop = _storedIn.find(b);
+        if (loop != _storedIn.end())
+            defs.insert(loop->second.begin(), loop->second.end());
+    }
+    return true;
+}
+
+// finds the branch targets where each promoted symbol needs a merged Value: the iterated dominance
+// frontier of the builders that define it. Since a builder can branch out more than once, with Stores
+// in between, a join is also merged if one of its predecessors defines the symbol, and every builder
+// a defining builder branches to counts as defining it. Loop bodies, loopBreak and loopContinue are
+// merged with the loop's Values instead (see rename()).
+void
+SSAConstruction::placeMerges(ControlFlowGraph *cfg, DominatorTree & dominators, std::map<Builder *,std::set<Symbol *> > & stored) {
+    Builder *entry = static_cast<FunctionCompilation *>(_comp)->func()->builderEntry();
+    const BuilderVector & rpo = cfg->reversePostOrder();
+
+    std::map<Builder *,std::set<Builder *> > frontiers;
+    for (auto bIt = rpo.begin(); bIt != rpo.end(); bIt++) {
+        Builder *join = *bIt;
+        const BuilderVector & preds = cfg->predecessors(join);
+        if (preds.size() < 2)
+            continue;
+        Builder *idom = dominators.idom(join);
+        for (auto pIt = preds.begin(); pIt != preds.end(); pIt++) {
+            if (!dominators.isReachable(*pIt))
+                continue;
+            for (Builder *runner = *pIt; runner != NULL && runner != idom; runner = dominators.idom(runner))
+                frontiers[runner].insert(join);
+        }
+    }
+
+    for (auto symIt = _promoted.begin(); symIt != _promoted.end(); symIt++) {
+        Symbol *sym = *symIt;
+        std::set<Builder *> defining;
+        defining.insert(entry);
+        for (auto it = stored.begin(); it != stored.end(); it++) {
+            if (it->second.find(sym) == it->second.end())
+                continue;
+            defining.insert(it->first);
+            const BuilderVector & succs = cfg->successors(it->first);
+            defining.insert(succs.begin(), succs.end());
+        }
+
+        std::set<Builder *> merged;
+        for (auto bIt = rpo.begin(); bIt != rpo.end(); bIt++) {
+            Builder *join = *bIt;
+            const BuilderVector & preds = cfg->predecessors(join);
+            if (preds.size() < 2)
+                continue;
+            for (auto pIt = preds.begin(); pIt != preds.end(); pIt++) {
+                auto found = stored.find(*pIt);
+                if (found != stored.end() && found->second.find(sym) != found->second.end()) {
+                    merged.insert(join);
+                    break;
+                }
+            }
+        }
+
+        BuilderWorklist worklist(defining.begin(), defining.end());
+        worklist.insert(worklist.end(), merged.begin(), merged.end());
+        defining.insert(merged.begin(), merged.end());
+        while (!worklist.empty()) {
+            Builder *b = worklist.front();
+            worklist.pop_front();
+            std::set<Builder *> & frontier = frontiers[b];
+            for (auto fIt = frontier.begin(); fIt != frontier.end(); fIt++) {
+                merged.insert(*fIt);
+                if (defining.insert(*fIt).second)
+                    worklist.push_back(*fIt);
+            }
+        }
+
+        for (auto mIt = merged.begin(); mIt != merged.end(); mIt++) {
+            if (!(*mIt)->isBound())
+                _merges[*mIt].insert(sym);
+        }
+    }
+}
+
+void
+SSAConstruction::visitBuilder(Builder * b, std::vector<bool> & visited, BuilderWorklist & worklist) {
+    if (b->id() >= visited.size())
+        visited.resize(b->id()+1);
+    if (visited[b->id()])
+        return;
+
+    if (_promoted.empty()) {
+        visited[b->id()] = true;
+        return;
+    }
+
+    // the entry builder: rename every builder in program order, starting with no definitions, then
+    // each branch target with the definitions reaching it
+    _prologue = _base->OrphanBuilder(LOC, b);
+    Definitions current;
+    rename(b, current, visited);
+    while (!_targets.empty()) {
+        Builder *target = _targets.front();
+        _targets.pop_front();
+        Definitions state = _entryStates[target];
+        rename(target, state, visited);
+    }
+
+    // zero Values for symbols read before they are stored go at the start of the function
+    OperationVector prologue;
+    for (OperationIterator opIt = _prologue->OperationsBegin(); opIt != _prologue->OperationsEnd(); opIt++) {
+        OperationCloner cloner(*opIt);
+        prologue.push_back(cloner.clone(b));
+    }
+    b->operations().insert(b->operations().begin(), prologue.begin(), prologue.end());
+
+    if (_changedControlFlow)
+        _comp->invalidateCFG();
+}
+
+bool
+SSAConstruction::endsWithBranch(Builder *b) const {
+    if (b->numOperations() == 0)
+        return false;
+    Operation *last = b->operations().back();
+    return last->action() == _base->aGoto || last->action() == _base->aReturn;
+}
+
+bool
+SSAConstruction::isWithin(Builder *b, Builder *ancestor) const {
+    while (b != NULL) {
+        if (b == ancestor)
+            return true;
+        b = b->isBound() ? b->boundToOperation()->parent() : b->parent();
+    }
+    return false;
+}
+
+bool
+SSAConstruction::usedOutside(Value *v, Builder *b) {
+    std::set<Builder *> & users = _uses[v];
+    for (auto it = users.begin(); it != users.end(); it++) {
+        if (!isWithin(*it, b))
+            return true;
+    }
+    return false;
+}
+
+Value *
+SSAConstruction::currentValue(Symbol *sym, Definitions & current) {
+    auto found = current.find(sym);
+    if (found != current.end())
+        return found->second;
+
+    auto initial = _initialValues.find(sym);
+    if (initial != _initialValues.end())
+        return initial->second;
+
+    Value *zero = _base->Zero(LOC, _prologue, sym->type());
+    _initialValues[sym] = zero;
+    return zero;
+}
+
+Value *
+SSAConstruction::mergedValue(Builder *target, Symbol *sym) {
+    Definitions & values = _mergedValues[target];
+    auto found = values.find(sym);
+    if (found != values.end())
+        return found->second;
+
+    Value *merged = _base->Zero(LOC, _prologue, sym->type());
+    _joinValues.insert(merged);
+    values[sym] = merged;
+    return merged;
+}
+
+// merges the current definitions into the Values target expects on entry, in a new builder that then
+// branches to target if split is true (so they only happen on this edge), else at the end of b; the
+// first time target is entered, it is queued to be renamed with the definitions reaching it
+Builder *
+SSAConstruction::enterTarget(Builder *b, Builder *target, Definitions & current, bool split) {
+    Definitions expected;
+    auto exit = _loopExits.find(target);
+    if (exit != _loopExits.end()) {
+        expected = exit->second;
+    } else if (!target->isBound()) {
+        std::set<Symbol *> & merges = _merges[target];
+        for (auto it = merges.begin(); it != merges.end(); it++)
+            expected[*it] = mergedValue(target, *it);
+        if (_entryStates.find(target) == _entryStates.end()) {
+            Definitions state = current;
+            for (auto it = expected.begin(); it != expected.end(); it++)
+                state[it->first] = it->second;
+            _entryStates[target] = state;
+            _targets.push_back(target);
+        }
+    }
+
+    Builder *edge = b;
+    for (auto it = expected.begin(); it != expected.end(); it++) {
+        Value *value = currentValue(it->first, current);
+        if (value == it->second)
+            continue;
+        if (edge == b && split)
+            edge = _base->OrphanBuilder(LOC, b);
+        _base->MergeDef(LOC, edge, it->second, value);
+    }
+
+    if (edge == b)
+        return target;
+    _base->Goto(LOC, edge, target);
+    _changedControlFlow = true;
+    return edge;
+}
+
+void
+SSAConstruction::rename(Builder *b, Definitions & current, std::vector<bool> & visited) {
+    if (b->id() >= visited.size())
+        visited.resize(b->id()+1);
+    visited[b->id()] = true;
+
+    TextWriter *log = _comp->logger(traceEnabled());
+
+    // operations are appended back to b as they are renamed
+    OperationVector original;
+    original.swap(b->operations());
+
+    for (OperationIterator opIt = original.begin(); opIt != original.end(); opIt++) {
+        Operation *op = *opIt;
+
+        if (op->action() == _base->aLoad && _promoted.find(op->symbol()) != _promoted.end()) {
+            Value *value = currentValue(op->symbol(), current);
+            if (_joinValues.find(value) != _joinValues.end() && usedOutside(op->result(), b)) {
+                // a merged Value changes each time control reaches its join, so uses elsewhere need a copy
+                Value *copy = _base->Zero(LOC, b, value->type());
+                _base->MergeDef(LOC, b, copy, value);
+                value = copy;
+            }
+            _values[op->result()] = value;
+            if (log) {
+                log->indent() << "Removed ";
+                log->print(op);
+            }
+            continue;
+        }
+
+        if (op->action() == _base->aStore && _promoted.find(op->symbol()) != _promoted.end()) {
+            auto found = _values.find(op->operand());
+            current[op->symbol()] = (found != _values.end()) ? found->second : op->operand();
+            if (log) {
+                log->indent() << "Removed ";
+                log->print(op);
+            }
+            continue;
+        }
+
+        bool changed = false;
+        OperationCloner cloner(op);
+        for (int32_t o=0;o < op->numOperands();o++) {
+            auto found = _values.find(op->operand(o));
+            if (found != _values.end()) {
+                cloner.changeOperand(found->second, o);
+                changed = true;
+            }
+        }
+
+        if (op->action() == _base->aForLoopUp) {
+            Op_ForLoopUp *loop = static_cast<Op_ForLoopUp *>(op);
+            Definitions inLoop = current;
+            std::vector<Symbol *> merged;
+
+            // every symbol stored in the loop gets a Value defined before the loop
+            std::set<Symbol *> & storedInLoop = _storedIn[loop->loopBody()];
+            for (auto it = storedInLoop.begin(); it != storedInLoop.end(); it++) {
+                Symbol *sym = *it;
+                if (_promoted.find(sym) == _promoted.end())
+                    continue;
+                Value *loopValue = _base->Zero(LOC, b, sym->type());
+                _base->MergeDef(LOC, b, loopValue, currentValue(sym, current));
+                _joinValues.insert(loopValue);
+                inLoop[sym] = loopValue;
+                merged.push_back(sym);
+            }
+
+            // branches to loopBreak or loopContinue merge into the same Values
+            Definitions exitValues;
+            for (auto it = merged.begin(); it != merged.end(); it++)
+                exitValues[*it] = inLoop[*it];
+            _loopExits[loop->loopBreak()] = exitValues;
+            _loopExits[loop->loopContinue()] = exitValues;
+
+            Operation *renamedLoop = changed ? b->appendClone(op, &cloner) : op;
+            if (!changed)
+                b->operations().push_back(op);
+
+            Builder *body = static_cast<Op_ForLoopUp *>(renamedLoop)->loopBody();
+            Definitions atEnd = inLoop;
+            rename(body, atEnd, visited);
+
+            // ... and the definitions at the end of the body flow back to the start of the next iteration
+            bool reachesEnd = !endsWithBranch(body);
+            for (auto it = merged.begin(); it != merged.end(); it++) {
+                Symbol *sym = *it;
+                if (reachesEnd && atEnd[sym] != inLoop[sym])
+                    _base->MergeDef(LOC, body, inLoop[sym], atEnd[sym]);
+                current[sym] = inLoop[sym];
+            }
+            continue;
+        }
+
+        for (int32_t t=0;t < op->numBuilders();t++) {
+            Builder *target = op->builder(t);
+            if (target == NULL)
+                continue;
+            Builder *edge = enterTarget(b, target, current, true);
+            if (edge != target) {
+                cloner.changeBuilder(edge, t);
+                changed = true;
+            }
+        }
+
+        if (changed)
+            b->appendClone(op, &cloner);
+        else
+            b->operations().push_back(op);
+    }
+
+    // control reaching the end of b may continue in another builder
+    ControlFlowEdgeVector edges;
+    b->controlFlowEdges(edges);
+    for (auto it = edges.begin(); it != edges.end(); it++)
+        enterTarget(b, it->second, current, false);
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
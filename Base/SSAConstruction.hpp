@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef SSACONSTRUCTION_INCL
+#define SSACONSTRUCTION_INCL
+
+#include <map>
+#include <set>
+#include <vector>
+#include "Builder.hpp"
+#include "Visitor.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Compiler;
+class ControlFlowGraph;
+class DominatorTree;
+class Operation;
+class Symbol;
+class Type;
+class Value;
+
+namespace Base {
+
+class BaseExtension;
+
+// SSAConstruction (often called mem2reg) promotes LocalSymbols that are only accessed by Load
+// and Store into Values: a Load is replaced by the Value most recently stored to its symbol, and
+// the Store disappears. Where control flow joins, the definitions reaching the join are merged
+// into one Value with MergeDef. Joins are found from the ControlFlowGraph: a symbol needs a merged
+// Value at the iterated dominance frontier (computed from the DominatorTree) of the Builders that
+// store it. Builders are not basic blocks, as a branch can leave from the middle of one, so every
+// Builder a storing Builder branches to is also treated as storing the symbol.
+//
+// A ForLoopUp body is a join too (entered from before the loop and from the end of each iteration):
+// every promoted symbol stored in a Builder the body dominates gets a Value defined before the loop,
+// merged with the value at the end of the body and at every branch to loopContinue or loopBreak,
+// and used for the symbol inside and after the loop. A branch target that needs merged Values is
+// entered through a new Builder holding the MergeDefs, so they only run on that edge.
+//
+// Only Int*, Float* and Address (including pointer) locals are promoted, never parameters, loop
+// variables, or symbols any other operation refers to. Functions are left alone if control can
+// reach the end of a branch target with no known successor, or if a branch enters a loop body,
+// or a loop's loopBreak or loopContinue from outside the loop. The MergeDefs added for a join are
+// parallel copies: SSADestruction must run before JB1CodeGenerator.
+class SSAConstruction : public Visitor {
+public:
+    SSAConstruction(Compiler *compiler);
+
+protected:
+    typedef std::map<Symbol *,Value *> Definitions;
+
+    virtual void visitPreCompilation(Compilation * comp);
+    virtual void visitBuilder(Builder * b, std::vector<bool> & visited, BuilderWorklist & worklist);
+
+    bool scan(ControlFlowGraph *cfg, DominatorTree & dominators, std::map<Builder *,std::set<Symbol *> > & stored);
+    void placeMerges(ControlFlowGraph *cfg, DominatorTree & dominators, std::map<Builder *,std::set<Symbol *> > & stored);
+    bool isPromotable(const Type *type) const;
+    bool endsWithBranch(Builder *b) const;
+    bool isWithin(Builder *b, Builder *ancestor) const;
+    bool usedOutside(Value *v, Builder *b);
+    void rename(Builder *b, Definitions & current, std::vector<bool> & visited);
+    Builder * enterTarget(Builder *b, Builder *target, Definitions & current, bool split);
+    Value * currentValue(Symbol *sym, Definitions & current);
+    Value * mergedValue(Builder *target, Symbol *sym);
+
+    BaseExtension *_base;
+    bool _canPromote;
+    bool _changedControlFlow;
+    std::set<Symbol *> _promoted;
+    std::map<Builder *,std::set<Symbol *> > _storedIn;   // symbols stored in each loop body and the Builders it dominates
+    std::map<Builder *,Builder *> _loopBodies;           // loop body of each loopBreak and loopContinue
+    std::map<Builder *,std::set<Symbol *> > _merges;     // symbols that need a merged Value at each branch target
+    std::map<Builder *,Definitions> _mergedValues;       // ... and those Values
+    std::map<Builder *,Definitions> _loopExits;          // loop Values that branches to each loopBreak and loopContinue merge into
+    std::map<Builder *,Definitions> _entryStates;        // definitions reaching each branch target that has been entered
+    BuilderWorklist _targets;                            // branch targets still to be renamed
+    std::map<Value *,std::set<Builder *> > _uses;        // builders with operations that use each Value
+    std::map<Value *,Value *> _values;                   // Load results and the Values that replace them
+    std::set<Value *> _joinValues;                       // merged Values of loops and branch targets
+    std::map<Symbol *,Value *> _initialValues;           // zero Values for symbols read before any Store
+    Builder *_prologue;                                  // operations to prepend to the entry builder
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(SSACONSTRUCTION_INCL)
+
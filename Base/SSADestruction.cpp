@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <map>
+#include <set>
+#include <string>
+#include "BaseExtension.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "SSADestruction.hpp"
+#include "TextWriter.hpp"
+#include "Value.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+SSADestruction::SSADestruction(Compiler *compiler)
+    : Visitor(compiler, std::string("SSADestruction"))
+    , _base(compiler->lookupExtension<BaseExtension>()) {
+
+}
+
+void
+SSADestruction::visitPreCompilation(Compilation * comp) {
+    setTraceEnabled(_comp->config()->traceSSADestruction());
+}
+
+void
+SSADestruction::visitBuilderPreOps(Builder * b) {
+    TextWriter *log = _comp->logger(traceEnabled());
+
+    // operations are appended back to b, with copies inserted before groups that need them
+    OperationVector original;
+    original.swap(b->operations());
+
+    for (size_t o=0;o < original.size();) {
+        if (original[o]->action() != _base->aMergeDef) {
+            b->operations().push_back(original[o]);
+            o++;
+            continue;
+        }
+
+        size_t end = o;
+        while (end < original.size() && original[end]->action() == _base->aMergeDef)
+            end++;
+
+        // sources read after an earlier MergeDef in the group has overwritten them
+        std::set<Value *> written;
+        std::map<Value *,Value *> copies;
+        for (size_t m=o;m < end;m++) {
+            Value *source = original[m]->operand();
+            if (written.find(source) != written.end() && copies.find(source) == copies.end()) {
+                Value *copy = _base->Zero(LOC, b, source->type());
+                _base->MergeDef(LOC, b, copy, source);
+                copies[source] = copy;
+            }
+            written.insert(original[m]->result());
+        }
+
+        for (size_t m=o;m < end;m++) {
+            Operation *op = original[m];
+            auto found = copies.find(op->operand());
+            if (found != copies.end()) {
+                OperationCloner cloner(op);
+                cloner.changeOperand(found->second);
+                Operation *copy = b->appendClone(op, &cloner);
+                if (log) {
+                    log->indent() << "Replaced ";
+                    log->print(op);
+                    log->indent() << "    with ";
+                    log->print(copy);
+                }
+            }
+            else {
+                b->operations().push_back(op);
+            }
+        }
+        o = end;
+    }
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
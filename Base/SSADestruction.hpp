@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef SSADESTRUCTION_INCL
+#define SSADESTRUCTION_INCL
+
+#include "Visitor.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class Compiler;
+
+namespace Base {
+
+class BaseExtension;
+
+// SSADestruction prepares MergeDefs for code generators that implement them as a simple copy into
+// the existing definition (JB1 uses StoreOver). Consecutive MergeDefs, such as those SSAConstruction
+// adds at the end of a loop body, are parallel copies: each reads the Values as they were before
+// any of them. Copied one after another, a MergeDef could read a Value that an earlier MergeDef in
+// the group already overwrote (e.g. when two loop Values are swapped, or a loop Value is merged
+// into another one). Any such source is first copied into a new Value before the group.
+class SSADestruction : public Visitor {
+public:
+    SSADestruction(Compiler *compiler);
+
+protected:
+    virtual void visitPreCompilation(Compilation * comp);
+    virtual void visitBuilderPreOps(Builder * b);
+
+    BaseExtension *_base;
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(SSADESTRUCTION_INCL)
+
@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <string>
+#include "BaseExtension.hpp"
+#include "BaseSymbols.hpp"
+#include "BaseTypes.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "Function.hpp"
+#include "FunctionCompilation.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "ScalarReplacement.hpp"
+#include "TextWriter.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+ScalarReplacement::ScalarReplacement(Compiler *compiler)
+    : Transformer(compiler, std::string("ScalarReplacement"))
+    , _base(compiler->lookupExtension<BaseExtension>())
+    , _escapeAnalysis(_base) {
+
+}
+
+void
+ScalarReplacement::visitPreCompilation(Compilation * comp) {
+    setTraceEnabled(_comp->config()->traceScalarReplacement());
+    _fieldLocals.clear();
+    _elementLocals.clear();
+    _escapeAnalysis.analyze(comp, _comp->config()->scalarReplaceMaxElements());
+
+    TextWriter *log = _comp->logger(traceEnabled());
+    if (log) {
+        const std::vector<Operation *> & aggregates = _escapeAnalysis.nonEscaping();
+        for (auto it = aggregates.begin(); it != aggregates.end(); it++)
+            log->indent() << "ScalarReplacement: operation " << (*it)->id() << " does not escape" << log->endl();
+    }
+}
+
+LocalSymbol *
+ScalarReplacement::fieldLocal(Operation *create, const FieldType *field) {
+    std::pair<Operation *,const FieldType *> key(create, field);
+    auto found = _fieldLocals.find(key);
+    if (found != _fieldLocals.end())
+        return found->second;
+
+    Function *func = static_cast<FunctionCompilation *>(_comp)->func();
+    std::string name = std::string("_sr").append(std::to_string(create->id())).append("_").append(field->fieldName());
+    LocalSymbol *local = func->DefineLocal(name, field->type());
+    _fieldLocals[key] = local;
+    return local;
+}
+
+LocalSymbol *
+ScalarReplacement::elementLocal(Operation *create, int64_t index) {
+    std::pair<Operation *,int64_t> key(create, index);
+    auto found = _elementLocals.find(key);
+    if (found != _elementLocals.end())
+        return found->second;
+
+    Function *func = static_cast<FunctionCompilation *>(_comp)->func();
+    std::string name = std::string("_sr").append(std::to_string(create->id())).append("_").append(std::to_string(index));
+    const Type *elementType = static_cast<const PointerType *>(create->type())->baseType();
+    LocalSymbol *local = func->DefineLocal(name, elementType);
+    _elementLocals[key] = local;
+    return local;
+}
+
+// a Load of local that defines op's result Value
+Builder *
+ScalarReplacement::load(Operation *op, LocalSymbol *local) {
+    Builder *scratch = _base->OrphanBuilder(LOC, op->parent());
+    _base->Load(LOC, scratch, local);
+    Operation *l = scratch->operations().back();
+
+    OperationCloner cloner(l);
+    cloner.changeResult(op->result());
+    Builder *b = _base->OrphanBuilder(LOC, op->parent());
+    b->appendClone(l, &cloner);
+    return b;
+}
+
+Builder *
+ScalarReplacement::transformOperation(Operation * op) {
+    ActionID a = op->action();
+    if (a == _base->aCreateLocalStruct || a == _base->aCreateLocalArray) {
+        if (_escapeAnalysis.escapes(op))
+            return NULL;
+        return _base->OrphanBuilder(LOC, op->parent()); // the memory is no longer needed
+    }
+
+    if (a == _base->aIndexAt) {
+        if (_escapeAnalysis.aggregate(op->result()) == NULL)
+            return NULL;
+        return _base->OrphanBuilder(LOC, op->parent()); // every use is replaced
+    }
+
+    if (a != _base->aLoadAt && a != _base->aStoreAt && a != _base->aLoadFieldAt && a != _base->aStoreFieldAt)
+        return NULL;
+
+    Value *address = op->operand(0);
+    Operation *create = _escapeAnalysis.aggregate(address);
+    if (create == NULL)
+        return NULL;
+
+    LocalSymbol *local;
+    if (a == _base->aLoadFieldAt || a == _base->aStoreFieldAt)
+        local = fieldLocal(create, static_cast<const FieldType *>(op->type()));
+    else
+        local = elementLocal(create, _escapeAnalysis.elementIndex(address));
+
+    if (a == _base->aLoadAt || a == _base->aLoadFieldAt)
+        return load(op, local);
+
+    Builder *b = _base->OrphanBuilder(LOC, op->parent());
+    _base->Store(LOC, b, local, op->operand(1));
+    return b;
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+
+#ifndef SCALARREPLACEMENT_INCL
+#define SCALARREPLACEMENT_INCL
+
+#include <stdint.h>
+#include <map>
+#include <utility>
+#include "EscapeAnalysis.hpp"
+#include "Transformer.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class Compiler;
+class Operation;
+
+namespace Base {
+
+class BaseExtension;
+class FieldType;
+class LocalSymbol;
+
+// ScalarReplacement replaces local structs and small local arrays whose memory does not escape
+// (see EscapeAnalysis and Config::scalarReplaceMaxElements()) with one LocalSymbol per field or
+// element that is accessed. Structs with overlapping fields (unions) are never replaced. The CreateLocalStruct or CreateLocalArray and any IndexAt of the array
+// are removed, and each LoadFieldAt, StoreFieldAt, LoadAt and StoreAt of the memory becomes a Load
+// or Store of the corresponding LocalSymbol, so the values can be kept in registers rather than in
+// stack memory. Run SSAConstruction afterwards to turn the new LocalSymbols into Values.
+class ScalarReplacement : public Transformer {
+public:
+    ScalarReplacement(Compiler *compiler);
+
+protected:
+    virtual void visitPreCompilation(Compilation * comp);
+    virtual Builder * transformOperation(Operation * op);
+
+    LocalSymbol *fieldLocal(Operation *create, const FieldType *field);
+    LocalSymbol *elementLocal(Operation *create, int64_t index);
+    Builder *load(Operation *op, LocalSymbol *local);
+
+    BaseExtension *_base;
+    EscapeAnalysis _escapeAnalysis;
+    std::map<std::pair<Operation *,const FieldType *>,LocalSymbol *> _fieldLocals;
+    std::map<std::pair<Operation *,int64_t>,LocalSymbol *> _elementLocals;
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(SCALARREPLACEMENT_INCL)
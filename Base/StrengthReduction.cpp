@@ -0,0 +1,355 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string>
+#include "BaseExtension.hpp"
+#include "BaseSymbols.hpp"
+#include "BaseTypes.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "ControlOperations.hpp"
+#include "Function.hpp"
+#include "FunctionCompilation.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "StrengthReduction.hpp"
+#include "TextWriter.hpp"
+#include "Value.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Base {
+
+//
+// InductionVariableAnalysis
+//
+// The loop variable of a ForLoopUp takes the values initial, initial+bump, initial+2*bump, ...
+// so Load(loopVariable) is an induction Value with start initial and step bump, provided
+// nothing inside the loop stores to the loop variable. Values computed from induction Values
+// using Add, Sub and Mul by an invariant, and widening integer ConvertTo are also induction
+// Values. Values defined outside the loop, constants, and Loads of symbols that are not written
+// in the loop are invariant.
+//
+
+InductionVariableAnalysis::InductionVariableAnalysis(BaseExtension *base, Op_ForLoopUp *loop)
+    : _base(base)
+    , _loop(loop)
+    , _analyzable(true) {
+
+    Builder *body = loop->loopBody();
+    if (!body->controlReachesEnd()) {
+        // updates appended to the end of the body would not be executed on every iteration
+        _analyzable = false;
+        return;
+    }
+
+    _loopBuilders.insert(body);
+    collect(body);
+    if (!_analyzable)
+        return;
+
+    if (isWrittenInLoop(loop->loopVariable())) {
+        _analyzable = false;
+        return;
+    }
+
+    for (auto it = _loopBuilders.begin(); it != _loopBuilders.end(); it++) {
+        Builder *b = *it;
+        for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+            Operation *op = *opIt;
+            if (op->action() != _base->aIndexAt)
+                continue;
+            if (classify(op->operand(0)) == Invariant && classify(op->operand(1)) == Induction)
+                _candidates.push_back(op);
+        }
+    }
+}
+
+void
+InductionVariableAnalysis::collect(Builder *b) {
+    for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+
+        // be conservative: any symbol referenced by anything other than a Load may be written
+        if (op->action() != _base->aLoad) {
+            for (int32_t s=0;s < op->numSymbols();s++)
+                _writtenSymbols.insert(op->symbol(s));
+        }
+
+        for (int32_t r=0;r < op->numResults();r++)
+            _definitions[op->result(r)] = op;
+
+        for (BuilderIterator bIt = op->BuildersBegin(); bIt != op->BuildersEnd(); bIt++) {
+            Builder *inner = *bIt;
+            if (inner == NULL || inner == _loop->loopBreak())
+                continue;
+
+            // a continue skips the end of the loop body
+            if (inner == _loop->loopContinue()) {
+                _analyzable = false;
+                return;
+            }
+
+            if (isInLoop(inner))
+                continue;
+
+            // only follow builders nested inside the loop body (not branch targets elsewhere)
+            Builder *p = inner->parent();
+            while (p != NULL && !isInLoop(p))
+                p = p->parent();
+            if (p == NULL)
+                continue;
+
+            _loopBuilders.insert(inner);
+            collect(inner);
+            if (!_analyzable)
+                return;
+        }
+    }
+}
+
+bool
+InductionVariableAnalysis::isInteger(const Type *t) const {
+    return t == _base->Int8 || t == _base->Int16 || t == _base->Int32 || t == _base->Int64;
+}
+
+InductionVariableAnalysis::Kind
+InductionVariableAnalysis::classify(Value *v) {
+    auto found = _kinds.find(v);
+    if (found != _kinds.end())
+        return found->second;
+
+    Kind kind = NotAffine;
+    auto def = _definitions.find(v);
+    if (def == _definitions.end()) {
+        kind = Invariant;
+    } else {
+        Operation *op = def->second;
+        ActionID a = op->action();
+        if (a == _base->aConst) {
+            kind = Invariant;
+        } else if (a == _base->aLoad) {
+            Symbol *sym = op->symbol();
+            if (sym == _loop->loopVariable())
+                kind = Induction;
+            else if (!isWrittenInLoop(sym))
+                kind = Invariant;
+        } else if (a == _base->aAdd || a == _base->aSub || a == _base->aMul) {
+            Kind left = classify(op->operand(0));
+            Kind right = classify(op->operand(1));
+            if (left == Invariant && right == Invariant)
+                kind = Invariant;
+            else if (left != NotAffine && right != NotAffine && isInteger(v->type())) {
+                if (a == _base->aAdd)
+                    kind = Induction;
+                else if (a == _base->aSub && right == Invariant)
+                    kind = Induction;
+                else if (a == _base->aMul && (left == Invariant || right == Invariant))
+                    kind = Induction;
+            }
+        } else if (a == _base->aConvertTo) {
+            Value *source = op->operand(0);
+            Kind sourceKind = classify(source);
+            if (sourceKind == Invariant)
+                kind = Invariant;
+            else if (sourceKind == Induction
+                     && isInteger(source->type()) && isInteger(v->type())
+                     && v->type()->size() >= source->type()->size())
+                kind = Induction;
+        }
+    }
+
+    _kinds[v] = kind;
+    return kind;
+}
+
+void
+InductionVariableAnalysis::materialize(Builder *b, Value *v, Value * & start, Value * & step) {
+    auto found = _materialized.find(v);
+    if (found != _materialized.end()) {
+        start = found->second.first;
+        step = found->second.second;
+        return;
+    }
+
+    assert(classify(v) != NotAffine);
+    start = v;
+    step = NULL;
+
+    auto def = _definitions.find(v);
+    if (def != _definitions.end()) {
+        Operation *op = def->second;
+        if (classify(v) == Invariant) {
+            // recompute the Value before the loop
+            OperationCloner cloner(op);
+            for (int32_t o=0;o < op->numOperands();o++) {
+                Value *operandStart, *operandStep;
+                materialize(b, op->operand(o), operandStart, operandStep);
+                cloner.changeOperand(operandStart, o);
+            }
+            cloner.createResult(b);
+            b->appendClone(op, &cloner);
+            start = cloner.result();
+        } else if (op->action() == _base->aLoad) {
+            start = _loop->initialValue();
+            step = _loop->bumpValue();
+        } else if (op->action() == _base->aConvertTo) {
+            Value *sourceStart, *sourceStep;
+            materialize(b, op->operand(0), sourceStart, sourceStep);
+            start = _base->ConvertTo(LOC, b, v->type(), sourceStart);
+            step = _base->ConvertTo(LOC, b, v->type(), sourceStep);
+        } else {
+            Value *leftStart, *leftStep, *rightStart, *rightStep;
+            materialize(b, op->operand(0), leftStart, leftStep);
+            materialize(b, op->operand(1), rightStart, rightStep);
+            if (op->action() == _base->aAdd) {
+                start = _base->Add(LOC, b, leftStart, rightStart);
+                if (leftStep && rightStep)
+                    step = _base->Add(LOC, b, leftStep, rightStep);
+                else
+                    step = leftStep ? leftStep : rightStep;
+            } else if (op->action() == _base->aSub) {
+                start = _base->Sub(LOC, b, leftStart, rightStart);
+                step = leftStep;
+            } else {
+                assert(op->action() == _base->aMul);
+                start = _base->Mul(LOC, b, leftStart, rightStart);
+                if (leftStep)
+                    step = _base->Mul(LOC, b, leftStep, rightStart);
+                else
+                    step = _base->Mul(LOC, b, leftStart, rightStep);
+            }
+        }
+    }
+
+    _materialized[v] = std::make_pair(start, step);
+}
+
+
+//
+// StrengthReduction
+//
+
+StrengthReduction::StrengthReduction(Compiler *compiler)
+    : Transformer(compiler, std::string("StrengthReduction"))
+    , _base(compiler->lookupExtension<BaseExtension>()) {
+
+}
+
+void
+StrengthReduction::visitPreCompilation(Compilation * comp) {
+    setTraceEnabled(_comp->config()->traceStrengthReduction());
+}
+
+Builder *
+StrengthReduction::transformOperation(Operation * op) {
+    if (op->action() == _base->aForLoopUp)
+        return reduceLoop(static_cast<Op_ForLoopUp *>(op));
+
+    if (op->action() == _base->aIndexAt) {
+        auto found = _reducedAddresses.find(op);
+        if (found != _reducedAddresses.end() && applied(found->second))
+            return reduceAddress(op, found->second);
+    }
+
+    return NULL;
+}
+
+Builder *
+StrengthReduction::reduceLoop(Op_ForLoopUp *loop) {
+    InductionVariableAnalysis ivs(_base, loop);
+    if (!ivs.isAnalyzable() || ivs.candidates().empty())
+        return NULL;
+
+    Function *func = static_cast<FunctionCompilation *>(_comp)->func();
+    Builder *b = _base->OrphanBuilder(LOC, loop->parent());
+    for (auto it = ivs.candidates().begin(); it != ivs.candidates().end(); it++) {
+        Operation *indexAt = *it;
+        if (_reducedAddresses.find(indexAt) != _reducedAddresses.end())
+            continue;
+
+        Value *baseStart, *baseStep, *indexStart, *indexStep;
+        ivs.materialize(b, indexAt->operand(0), baseStart, baseStep);
+        ivs.materialize(b, indexAt->operand(1), indexStart, indexStep);
+
+        Value *address = indexAt->result();
+        std::string name = std::string("_sr_address").append(std::to_string(address->id()));
+        LocalSymbol *pointer = func->DefineLocal(name, address->type());
+        _base->Store(LOC, b, pointer, _base->IndexAt(LOC, b, baseStart, indexStart));
+
+        ReducedAddress *r = new ReducedAddress();
+        r->_pointer = pointer;
+        r->_step = indexStep;
+        r->_initialize = b->operations().back();
+        r->_loopParent = loop->parent();
+        _reducedAddresses[indexAt] = r;
+        _pointerUpdates[loop->loopBody()].push_back(r);
+    }
+
+    b->appendClone(loop);
+    return b;
+}
+
+Builder *
+StrengthReduction::reduceAddress(Operation *indexAt, ReducedAddress *r) {
+    // replace the IndexAt with a Load of the pointer that defines the same result Value,
+    // so all the uses of the address (e.g. LoadAt, StoreAt) remain valid
+    Builder *scratch = _base->OrphanBuilder(LOC, indexAt->parent());
+    _base->Load(LOC, scratch, r->_pointer);
+    Operation *load = scratch->operations().back();
+
+    OperationCloner cloner(load);
+    cloner.changeResult(indexAt->result());
+    Builder *b = _base->OrphanBuilder(LOC, indexAt->parent());
+    b->appendClone(load, &cloner);
+    return b;
+}
+
+void
+StrengthReduction::visitBuilderPostOps(Builder * b) {
+    auto found = _pointerUpdates.find(b);
+    if (found == _pointerUpdates.end())
+        return;
+
+    // b is the loop body: advance each pointer by its step at the end of the iteration
+    std::vector<ReducedAddress *> & updates = found->second;
+    for (auto it = updates.begin(); it != updates.end(); it++) {
+        ReducedAddress *r = *it;
+        if (applied(r)) {
+            Value *current = _base->Load(LOC, b, r->_pointer);
+            _base->Store(LOC, b, r->_pointer, _base->IndexAt(LOC, b, current, r->_step));
+        }
+    }
+}
+
+void
+StrengthReduction::visitPostCompilation(Compilation * comp) {
+    for (auto it = _reducedAddresses.begin(); it != _reducedAddresses.end(); it++)
+        delete it->second;
+    _reducedAddresses.clear();
+    _pointerUpdates.clear();
+}
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
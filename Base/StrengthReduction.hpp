@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef STRENGTHREDUCTION_INCL
+#define STRENGTHREDUCTION_INCL
+
+#include <map>
+#include <set>
+#include <vector>
+#include "Transformer.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class Compiler;
+class Operation;
+class Symbol;
+class Type;
+class Value;
+
+namespace Base {
+
+class BaseExtension;
+class LocalSymbol;
+class Op_ForLoopUp;
+
+// Describes how the Values computed inside one ForLoopUp loop change from iteration
+// to iteration. A Value is an induction Value if it is an affine function of the loop
+// variable, i.e. it can be computed as start + k*step on the k-th iteration (k from 0)
+// where start and step can both be computed before the loop begins.
+class InductionVariableAnalysis {
+public:
+    enum Kind {
+        NotAffine,
+        Invariant,
+        Induction
+    };
+
+    InductionVariableAnalysis(BaseExtension *base, Op_ForLoopUp *loop);
+
+    // true if the loop has a shape that the analysis understands
+    bool isAnalyzable() const { return _analyzable; }
+
+    bool isInLoop(Builder *b) const { return _loopBuilders.find(b) != _loopBuilders.end(); }
+    bool isDefinedInLoop(Value *v) const { return _definitions.find(v) != _definitions.end(); }
+    bool isWrittenInLoop(Symbol *sym) const { return _writtenSymbols.find(sym) != _writtenSymbols.end(); }
+
+    Kind classify(Value *v);
+
+    // all IndexAt operations in the loop whose base is invariant and whose index is an induction Value
+    std::vector<Operation *> & candidates() { return _candidates; }
+
+    // computes the start and step of v (which must not be NotAffine) into b, which must
+    // execute before the loop; step is NULL for an Invariant Value
+    void materialize(Builder *b, Value *v, Value * & start, Value * & step);
+
+protected:
+    void collect(Builder *b);
+    bool isInteger(const Type *t) const;
+
+    BaseExtension *_base;
+    Op_ForLoopUp *_loop;
+    bool _analyzable;
+
+    std::set<Builder *> _loopBuilders;
+    std::set<Symbol *> _writtenSymbols;
+    std::map<Value *,Operation *> _definitions;
+    std::map<Value *,Kind> _kinds;
+    std::map<Value *,std::pair<Value *,Value *> > _materialized;
+    std::vector<Operation *> _candidates;
+};
+
+// StrengthReduction replaces IndexAt operations inside ForLoopUp loops whose index is an
+// induction Value (e.g. IndexAt(base, Add(Mul(i, N), k))) with a pointer that is computed
+// once before the loop and then advanced by a constant stride at the end of every iteration.
+// Any LoadAt or StoreAt through the address then no longer depends on the per iteration multiply.
+class StrengthReduction : public Transformer {
+public:
+    StrengthReduction(Compiler *compiler);
+
+protected:
+    virtual void visitPreCompilation(Compilation * comp);
+    virtual Builder * transformOperation(Operation * op);
+    virtual void visitBuilderPostOps(Builder * b);
+    virtual void visitPostCompilation(Compilation * comp);
+
+    struct ReducedAddress {
+        LocalSymbol *_pointer;  // holds the address computed by the IndexAt in the current iteration
+        Value *_step;           // index stride per iteration, computed before the loop
+        Operation *_initialize; // stores the first iteration's address into _pointer before the loop
+        Builder *_loopParent;   // builder holding the loop
+    };
+
+    Builder * reduceLoop(Op_ForLoopUp *loop);
+    Builder * reduceAddress(Operation *indexAt, ReducedAddress *r);
+    bool applied(ReducedAddress *r) const { return r->_initialize->parent() == r->_loopParent; }
+
+    BaseExtension *_base;
+    std::map<Operation *,ReducedAddress *> _reducedAddresses;
+    std::map<Builder *,std::vector<ReducedAddress *> > _pointerUpdates;
+};
+
+} // namespace Base
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(STRENGTHREDUCTION_INCL)
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef BITVECTOR_INCL
+#define BITVECTOR_INCL
+
+#include <cassert>
+#include <stdint.h>
+#include <vector>
+
+namespace OMR {
+namespace JitBuilder {
+
+// A fixed size set of small integers (e.g. IDs) stored one bit each, for dataflow analyses
+class BitVector {
+public:
+    BitVector(size_t size=0)
+        : _size(size)
+        , _words((size + 63) / 64, 0) {
+    }
+
+    size_t size() const { return _size; }
+
+    bool test(size_t i) const {
+        return i < _size && (_words[i / 64] & bit(i)) != 0;
+    }
+    void set(size_t i) {
+        assert(i < _size);
+        _words[i / 64] |= bit(i);
+    }
+    void reset(size_t i) {
+        if (i < _size)
+            _words[i / 64] &= ~bit(i);
+    }
+    void clear() {
+        for (size_t w=0;w < _words.size();w++)
+            _words[w] = 0;
+    }
+
+    // adds every member of other (which must be the same size), returning true if this set changed
+    bool unionWith(const BitVector & other) {
+        assert(other._size == _size);
+        bool changed = false;
+        for (size_t w=0;w < _words.size();w++) {
+            uint64_t merged = _words[w] | other._words[w];
+            if (merged != _words[w]) {
+                _words[w] = merged;
+                changed = true;
+            }
+        }
+        return changed;
+    }
+
+    int32_t count() const {
+        int32_t n = 0;
+        for (size_t w=0;w < _words.size();w++) {
+            for (uint64_t word = _words[w]; word != 0; word &= word - 1)
+                n++;
+        }
+        return n;
+    }
+
+    bool operator==(const BitVector & other) const { return _size == other._size && _words == other._words; }
+    bool operator!=(const BitVector & other) const { return !(*this == other); }
+
+protected:
+    static uint64_t bit(size_t i) { return ((uint64_t)1) << (i % 64); }
+
+    size_t _size;
+    std::vector<uint64_t> _words;
+};
+
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(BITVECTOR_INCL)
+
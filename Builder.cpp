@@ -27,6 +27,7 @@
 #include "JB1MethodBuilder.hpp"
 #include "Location.hpp"
 #include "Operation.hpp"
+#include "OperationCloner.hpp"
 #include "TextWriter.hpp"
 #include "Value.hpp"
 
@@ -44,7 +45,9 @@ Builder::Builder(Compilation * comp, Context *context, std::string name)
     , _boundToOperation(NULL)
     , _isTarget(false)
     , _isBound(false)
-    , _controlReachesEnd(true) {
+    , _controlReachesEnd(true)
+    , _isCold(false) {
+    comp->registerBuilder(this);
 }
 
 Builder::Builder(Builder *parent, Context *context, std::string name)
@@ -58,7 +61,9 @@ Builder::Builder(Builder *parent, Context *context, std::string name)
     , _boundToOperation(NULL)
     , _isTarget(false)
     , _isBound(false)
-    , _controlReachesEnd(true) {
+    , _controlReachesEnd(true)
+    , _isCold(false) {
+    _comp->registerBuilder(this);
     parent->addChild(this);
 }
 
@@ -73,7 +78,9 @@ Builder::Builder(Builder *parent, Operation *boundToOp, std::string name)
     , _boundToOperation(boundToOp)
     , _isTarget(false)
     , _isBound(true)
-    , _controlReachesEnd(true) {
+    , _controlReachesEnd(true)
+    , _isCold(false) {
+    _comp->registerBuilder(this);
     parent->addChild(this);
 }
 
@@ -105,6 +112,19 @@ Builder::add(Operation *op) {
     return this;
 }
 
+Operation *
+Builder::appendClone(Operation *op) {
+    OperationCloner cloner(op);
+    return appendClone(op, &cloner);
+}
+
+Operation *
+Builder::appendClone(Operation *op, OperationCloner *cloner) {
+    Operation *clonedOp = cloner->clone(this);
+    add(clonedOp);
+    return clonedOp;
+}
+
 void
 Builder::jbgen(JB1MethodBuilder *j1mb) const {
     j1mb->createBuilder(this);
@@ -147,6 +167,9 @@ Builder::writeProperties(TextWriter & w) const {
         w.indent() << "[ controlReachesEnd ]" << w.endl();
     else
         w.indent() << "[ notControlReachesEnd ]" << w.endl();
+
+    if (isCold())
+        w.indent() << "[ cold ]" << w.endl();
 }
 
 void
@@ -28,6 +28,7 @@
 #include <vector>
 #include "IDs.hpp"
 #include "Iterator.hpp"
+#include "typedefs.hpp"
 
 namespace OMR {
 namespace JitBuilder { 
@@ -63,10 +64,10 @@ public:
     static Builder * create(Builder *parent, Context *context=NULL, std::string name="");
     static Builder * create(Compilation *comp, Context *context=NULL, std::string name="");
 
-    #if 0
     Operation * appendClone(Operation *op);
     Operation * appendClone(Operation *op, OperationCloner *cloner);
 
+    #if 0
     Operation * Append(OperationBuilder *opBuilder);
     Value * Append(OperationBuilder *opBuilder, Literal *l);
     Value * Append(OperationBuilder *opBuilder, Value *v);
@@ -119,6 +120,10 @@ public:
     bool controlReachesEnd() const                      { return _controlReachesEnd; }
     Builder * setControlReachesEnd(bool v=true)         { _controlReachesEnd = v; return this; }
 
+    // a cold Builder is expected to run rarely (e.g. an error path) and is laid out after hot code
+    bool isCold() const                                 { return _isCold; }
+    Builder * setCold(bool v=true)                      { _isCold = v; return this; }
+
     Location *location() const {
         return _currentLocation;
     }
@@ -135,6 +140,10 @@ public:
     virtual void writePrefix(TextWriter & w) const;
     virtual void writeSuffix(TextWriter & w) const;
 
+    // edges that leave the end of this Builder for somewhere other than where it returns to (e.g. a
+    // BytecodeBuilder's fall through Builder); edges created by operations come from Operation::controlFlowEdges()
+    virtual void controlFlowEdges(ControlFlowEdgeVector & edges) const { }
+
     virtual void jbgen(JB1MethodBuilder *j1mb) const;
     virtual void jbgenSuccessors(JB1MethodBuilder *j1mb) const;
 
@@ -160,6 +169,7 @@ public:
     bool                   _isTarget;
     bool                   _isBound;
     bool                   _controlReachesEnd;
+    bool                   _isCold;
     };
 
 } // namespace JitBuilder
@@ -24,6 +24,7 @@
 #include "Compiler.hpp"
 #include "Config.hpp"
 #include "Context.hpp"
+#include "ControlFlowGraph.hpp"
 #include "Literal.hpp"
 #include "LiteralDictionary.hpp"
 #include "SymbolDictionary.hpp"
@@ -55,6 +56,7 @@ Compilation::Compilation(Compiler *compiler, TypeDictionary *typeDict, Config *c
     , _nextSymbolDictionaryID(0)
     , _nextTransformationID(NoTransformation+1)
     , _nextValueID(NoValue+1)
+    , _cfg(NULL)
     , _ilBuilt(false) {
 
     if (_config == NULL) {
@@ -64,6 +66,8 @@ Compilation::Compilation(Compiler *compiler, TypeDictionary *typeDict, Config *c
 }
 
 Compilation::~Compilation() {
+    if (_cfg != NULL)
+        delete _cfg;
     if (_myConfig && _config != NULL)
         delete _config;
     delete _symbolDict;
@@ -71,6 +75,11 @@ Compilation::~Compilation() {
     delete _context;
 }
 
+void
+Compilation::registerBuilder(Builder *b) {
+    _builders.push_back(b);
+}
+
 void
 Compilation::addInitialBuildersToWorklist(BuilderWorklist & worklist) {
     for (auto it = _builders.begin();it != _builders.end(); it++) {
@@ -79,6 +88,23 @@ Compilation::addInitialBuildersToWorklist(BuilderWorklist & worklist) {
     }
 }
 
+ControlFlowGraph *
+Compilation::cfg() {
+    if (_cfg == NULL) {
+        _cfg = new ControlFlowGraph(this);
+        _cfg->build();
+    }
+    return _cfg;
+}
+
+void
+Compilation::invalidateCFG() {
+    if (_cfg != NULL) {
+        delete _cfg;
+        _cfg = NULL;
+    }
+}
+
 Literal *
 Compilation::registerLiteral(LOCATION, const Type *type, const LiteralBytes *value) {
     return _literalDict->registerLiteral(PASSLOC, type, value);
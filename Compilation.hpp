@@ -37,6 +37,7 @@ class Builder;
 class Compiler;
 class Config;
 class Context;
+class ControlFlowGraph;
 class CreateLocation;
 class JB1MethodBuilder;
 class Literal;
@@ -51,6 +52,7 @@ class Visitor;
 
 class Compilation {
     friend class Builder;
+    friend class ControlFlowGraph;
     friend class Literal;
     friend class LiteralDictionary;
     friend class Location;
@@ -90,6 +92,12 @@ class Compilation {
     BuilderIterator buildersBegin() { return BuilderIterator(_builders); }
     BuilderIterator buildersEnd() { return endBuilderIterator; }
 
+    // control flow graph over this compilation's Builders, built on first use and then maintained
+    // by Transformers; passes that change control flow any other way must invalidate it
+    ControlFlowGraph *cfg();
+    bool hasCFG() const { return _cfg != NULL; }
+    void invalidateCFG();
+
     virtual CompilerReturnCode compile(std::string strategy);
     void setLogger(TextWriter * logger) { _logger = logger; }
     TextWriter * logger(bool enabled=true) const { return enabled ? _logger : NULL; }
@@ -137,6 +145,7 @@ class Compilation {
     ValueID _nextValueID;
 
     BuilderVector _builders;
+    ControlFlowGraph *_cfg;
 
     bool _ilBuilt;
 
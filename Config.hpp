@@ -36,6 +36,32 @@ public:
         : _traceBuildIL(false)
         , _traceCodeGenerator(false)
         , _traceTypeReplacer(false)
+        , _traceStrengthReduction(false)
+        , _traceLoopUnroller(false)
+        , _traceVectorLowering(false)
+        , _traceLoopVectorizer(false)
+        , _traceLoopNestOptimizer(false)
+        , _traceInliner(false)
+        , _traceSSAConstruction(false)
+        , _traceSSADestruction(false)
+        , _traceFMAContraction(false)
+        , _traceDivisionByConstant(false)
+        , _traceConstantFolding(false)
+        , _traceIfConversion(false)
+        , _traceColdBuilderLayout(false)
+        , _traceProfileInstrumentation(false)
+        , _traceProfileFeedback(false)
+        , _traceOutliner(false)
+        , _traceScalarReplacement(false)
+        , _traceLocalForwarding(false)
+        , _loopUnrollFactor(4)
+        , _loopFullUnrollLimit(8)
+        , _loopTileSize(32)
+        , _loopOuterTileSize(0)
+        , _inlineMaxCalleeSize(40)
+        , _inlineBudget(400)
+        , _outlineMaxFunctionSize(1000)
+        , _scalarReplaceMaxElements(16)
         , _lastTransformationIndex(-1) // no limit
         , _logRegex("") {
     }
@@ -52,6 +78,110 @@ public:
     bool traceTypeReplacer() const                            { return _traceTypeReplacer; }
     Config * setTraceTypeReplacer(bool v=true)                { _traceTypeReplacer = v; return this; }
 
+    // when true, turn logging on when StrengthReduction runs
+    bool traceStrengthReduction() const                       { return _traceStrengthReduction; }
+    Config * setTraceStrengthReduction(bool v=true)           { _traceStrengthReduction = v; return this; }
+
+    // when true, turn logging on when LoopUnroller runs
+    bool traceLoopUnroller() const                            { return _traceLoopUnroller; }
+    Config * setTraceLoopUnroller(bool v=true)                { _traceLoopUnroller = v; return this; }
+
+    // when true, turn logging on when VectorLowering runs
+    bool traceVectorLowering() const                          { return _traceVectorLowering; }
+    Config * setTraceVectorLowering(bool v=true)              { _traceVectorLowering = v; return this; }
+
+    // when true, turn logging on when LoopVectorizer runs
+    bool traceLoopVectorizer() const                          { return _traceLoopVectorizer; }
+    Config * setTraceLoopVectorizer(bool v=true)              { _traceLoopVectorizer = v; return this; }
+
+    // when true, turn logging on when LoopNestOptimizer runs
+    bool traceLoopNestOptimizer() const                       { return _traceLoopNestOptimizer; }
+    Config * setTraceLoopNestOptimizer(bool v=true)           { _traceLoopNestOptimizer = v; return this; }
+
+    // when true, turn logging on when Inliner runs
+    bool traceInliner() const                                 { return _traceInliner; }
+    Config * setTraceInliner(bool v=true)                     { _traceInliner = v; return this; }
+
+    // when true, turn logging on when SSAConstruction runs
+    bool traceSSAConstruction() const                         { return _traceSSAConstruction; }
+    Config * setTraceSSAConstruction(bool v=true)             { _traceSSAConstruction = v; return this; }
+
+    // when true, turn logging on when SSADestruction runs
+    bool traceSSADestruction() const                          { return _traceSSADestruction; }
+    Config * setTraceSSADestruction(bool v=true)              { _traceSSADestruction = v; return this; }
+
+    // when true, turn logging on when FMAContraction runs
+    bool traceFMAContraction() const                          { return _traceFMAContraction; }
+    Config * setTraceFMAContraction(bool v=true)              { _traceFMAContraction = v; return this; }
+
+    // when true, turn logging on when DivisionByConstant runs
+    bool traceDivisionByConstant() const                      { return _traceDivisionByConstant; }
+    Config * setTraceDivisionByConstant(bool v=true)          { _traceDivisionByConstant = v; return this; }
+
+    // when true, turn logging on when ConstantFolding runs
+    bool traceConstantFolding() const                         { return _traceConstantFolding; }
+    Config * setTraceConstantFolding(bool v=true)             { _traceConstantFolding = v; return this; }
+
+    // when true, turn logging on when IfConversion runs
+    bool traceIfConversion() const                            { return _traceIfConversion; }
+    Config * setTraceIfConversion(bool v=true)                { _traceIfConversion = v; return this; }
+
+    // when true, turn logging on when ColdBuilderLayout runs
+    bool traceColdBuilderLayout() const                       { return _traceColdBuilderLayout; }
+    Config * setTraceColdBuilderLayout(bool v=true)           { _traceColdBuilderLayout = v; return this; }
+
+    // when true, turn logging on when ProfileInstrumentation runs
+    bool traceProfileInstrumentation() const                  { return _traceProfileInstrumentation; }
+    Config * setTraceProfileInstrumentation(bool v=true)      { _traceProfileInstrumentation = v; return this; }
+
+    // when true, turn logging on when ProfileFeedback runs
+    bool traceProfileFeedback() const                         { return _traceProfileFeedback; }
+    Config * setTraceProfileFeedback(bool v=true)             { _traceProfileFeedback = v; return this; }
+
+    // when true, turn logging on when Outliner runs
+    bool traceOutliner() const                                { return _traceOutliner; }
+    Config * setTraceOutliner(bool v=true)                    { _traceOutliner = v; return this; }
+
+    // when true, turn logging on when ScalarReplacement runs
+    bool traceScalarReplacement() const                       { return _traceScalarReplacement; }
+    Config * setTraceScalarReplacement(bool v=true)           { _traceScalarReplacement = v; return this; }
+
+    // when true, turn logging on when LocalForwarding runs
+    bool traceLocalForwarding() const                         { return _traceLocalForwarding; }
+    Config * setTraceLocalForwarding(bool v=true)             { _traceLocalForwarding = v; return this; }
+
+    // number of copies of a loop body LoopUnroller makes for each iteration of an unrolled loop (< 2 disables)
+    int32_t loopUnrollFactor() const                          { return _loopUnrollFactor; }
+    Config * setLoopUnrollFactor(int32_t factor)              { _loopUnrollFactor = factor; return this; }
+
+    // loops whose trip count is a literal no larger than this limit are completely unrolled by LoopUnroller
+    int32_t loopFullUnrollLimit() const                       { return _loopFullUnrollLimit; }
+    Config * setLoopFullUnrollLimit(int32_t limit)            { _loopFullUnrollLimit = limit; return this; }
+
+    // iterations of each loop in a tile made by LoopNestOptimizer, sized for the L1 cache (< 2 disables tiling)
+    int32_t loopTileSize() const                              { return _loopTileSize; }
+    Config * setLoopTileSize(int32_t size)                    { _loopTileSize = size; return this; }
+
+    // iterations of each loop in an outer (L2 cache) tile, must be a multiple of loopTileSize() (0 disables)
+    int32_t loopOuterTileSize() const                         { return _loopOuterTileSize; }
+    Config * setLoopOuterTileSize(int32_t size)               { _loopOuterTileSize = size; return this; }
+
+    // Inliner only inlines callees with at most this many operations
+    int32_t inlineMaxCalleeSize() const                       { return _inlineMaxCalleeSize; }
+    Config * setInlineMaxCalleeSize(int32_t size)             { _inlineMaxCalleeSize = size; return this; }
+
+    // total number of operations Inliner may copy into one compilation
+    int32_t inlineBudget() const                              { return _inlineBudget; }
+    Config * setInlineBudget(int32_t budget)                  { _inlineBudget = budget; return this; }
+
+    // Outliner moves cold code out of functions with more than this many operations
+    int32_t outlineMaxFunctionSize() const                    { return _outlineMaxFunctionSize; }
+    Config * setOutlineMaxFunctionSize(int32_t size)          { _outlineMaxFunctionSize = size; return this; }
+
+    // ScalarReplacement only replaces local arrays with at most this many elements
+    int32_t scalarReplaceMaxElements() const                  { return _scalarReplaceMaxElements; }
+    Config * setScalarReplaceMaxElements(int32_t n)           { _scalarReplaceMaxElements = n; return this; }
+
     // if >= 0, identifies the last transformation to apply
     bool limitLastTransformationIndex() const                 { return _lastTransformationIndex >= 0; }
     TransformationID lastTransformationIndex() const          { return _lastTransformationIndex; }
@@ -65,6 +195,33 @@ protected:
     bool _traceBuildIL;
     bool _traceCodeGenerator;
     bool _traceTypeReplacer;
+    bool _traceStrengthReduction;
+    bool _traceLoopUnroller;
+    bool _traceVectorLowering;
+    bool _traceLoopVectorizer;
+    bool _traceLoopNestOptimizer;
+    bool _traceInliner;
+    bool _traceSSAConstruction;
+    bool _traceSSADestruction;
+    bool _traceFMAContraction;
+    bool _traceDivisionByConstant;
+    bool _traceConstantFolding;
+    bool _traceIfConversion;
+    bool _traceColdBuilderLayout;
+    bool _traceProfileInstrumentation;
+    bool _traceProfileFeedback;
+    bool _traceOutliner;
+    bool _traceScalarReplacement;
+    bool _traceLocalForwarding;
+
+    int32_t _loopUnrollFactor;
+    int32_t _loopFullUnrollLimit;
+    int32_t _loopTileSize;
+    int32_t _loopOuterTileSize;
+    int32_t _inlineMaxCalleeSize;
+    int32_t _inlineBudget;
+    int32_t _outlineMaxFunctionSize;
+    int32_t _scalarReplaceMaxElements;
 
     TransformationID _lastTransformationIndex;
 
@@ -0,0 +1,257 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <algorithm>
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "ControlFlowGraph.hpp"
+#include "Operation.hpp"
+#include "TextWriter.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+BuilderVector ControlFlowGraph::noBuilders;
+
+ControlFlowGraph::ControlFlowGraph(Compilation *comp)
+    : _comp(comp)
+    , _rpoValid(false) {
+
+}
+
+void
+ControlFlowGraph::build() {
+    _entries.clear();
+    _builders.clear();
+    _predecessors.clear();
+    _successors.clear();
+    _rpoValid = false;
+    grow(_comp->maxBuilderID());
+
+    BuilderWorklist worklist;
+    _comp->addInitialBuildersToWorklist(worklist);
+    for (auto it = worklist.begin(); it != worklist.end(); it++) {
+        Builder *b = *it;
+        _entries.push_back(b);
+        addBuilder(b);
+    }
+}
+
+void
+ControlFlowGraph::grow(BuilderID id) {
+    if (id < _builders.size())
+        return;
+
+    // builders created since the graph was built
+    _builders.resize(id+1, NULL);
+    _predecessors.resize(id+1);
+    _successors.resize(id+1);
+}
+
+bool
+ControlFlowGraph::contains(Builder *b) const {
+    return b->id() < _builders.size() && _builders[b->id()] == b;
+}
+
+const BuilderVector &
+ControlFlowGraph::predecessors(Builder *b) const {
+    if (b->id() >= _predecessors.size())
+        return noBuilders;
+    return _predecessors[b->id()];
+}
+
+const BuilderVector &
+ControlFlowGraph::successors(Builder *b) const {
+    if (b->id() >= _successors.size())
+        return noBuilders;
+    return _successors[b->id()];
+}
+
+void
+ControlFlowGraph::addEdge(Builder *from, Builder *to) {
+    grow(std::max(from->id(), to->id()));
+    _successors[from->id()].push_back(to);
+    _predecessors[to->id()].push_back(from);
+    _rpoValid = false;
+}
+
+void
+ControlFlowGraph::removeEdge(Builder *from, Builder *to) {
+    if (from->id() >= _successors.size() || to->id() >= _predecessors.size())
+        return;
+
+    // only one copy of the edge is removed
+    BuilderVector & succs = _successors[from->id()];
+    auto s = std::find(succs.begin(), succs.end(), to);
+    if (s == succs.end())
+        return;
+    succs.erase(s);
+
+    BuilderVector & preds = _predecessors[to->id()];
+    auto p = std::find(preds.begin(), preds.end(), from);
+    if (p != preds.end())
+        preds.erase(p);
+    _rpoValid = false;
+}
+
+// adds b, the edges of its operations and its own edges (see Builder::controlFlowEdges()), along
+// with any Builders they lead to that are not yet in the graph
+void
+ControlFlowGraph::addBuilder(Builder *b) {
+    grow(b->id());
+    _builders[b->id()] = b;
+    for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++)
+        addOperation(*opIt);
+
+    ControlFlowEdgeVector edges;
+    b->controlFlowEdges(edges);
+    for (auto it = edges.begin(); it != edges.end(); it++) {
+        addEdge(it->first, it->second);
+        if (!contains(it->second))
+            addBuilder(it->second);
+    }
+}
+
+void
+ControlFlowGraph::addOperation(Operation *op) {
+    ControlFlowEdgeVector edges;
+    op->controlFlowEdges(edges);
+    for (auto it = edges.begin(); it != edges.end(); it++)
+        addEdge(it->first, it->second);
+
+    for (BuilderIterator bIt = op->BuildersBegin(); bIt != op->BuildersEnd(); bIt++) {
+        Builder *inner = *bIt;
+        if (inner != NULL && !contains(inner))
+            addBuilder(inner);
+    }
+}
+
+// removes the edges of b's operations and b itself; b's remaining predecessors keep their edges to it
+void
+ControlFlowGraph::removeBuilder(Builder *b) {
+    for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++)
+        removeOperation(*opIt);
+
+    ControlFlowEdgeVector edges;
+    b->controlFlowEdges(edges);
+    for (auto it = edges.begin(); it != edges.end(); it++)
+        removeEdge(it->first, it->second);
+
+    if (contains(b))
+        _builders[b->id()] = NULL;
+    _rpoValid = false;
+}
+
+void
+ControlFlowGraph::removeOperation(Operation *op) {
+    ControlFlowEdgeVector edges;
+    op->controlFlowEdges(edges);
+    for (auto it = edges.begin(); it != edges.end(); it++)
+        removeEdge(it->first, it->second);
+
+    // builders bound to op go with it, but targets may be reached from elsewhere
+    for (BuilderIterator bIt = op->BuildersBegin(); bIt != op->BuildersEnd(); bIt++) {
+        Builder *inner = *bIt;
+        if (inner != NULL && inner->isBound() && inner->boundToOperation() == op && contains(inner))
+            removeBuilder(inner);
+    }
+}
+
+void
+ControlFlowGraph::computeReversePostOrder() {
+    _rpo.clear();
+    _rpoNumbers.assign(_builders.size(), -1);
+
+    BuilderVector postOrder;
+    std::vector<bool> visited(_builders.size());
+    std::vector<std::pair<Builder *, size_t> > stack;
+    for (auto it = _entries.begin(); it != _entries.end(); it++) {
+        Builder *entry = *it;
+        if (visited[entry->id()])
+            continue;
+        visited[entry->id()] = true;
+        stack.push_back(std::make_pair(entry, 0));
+        while (!stack.empty()) {
+            Builder *b = stack.back().first;
+            const BuilderVector & succs = _successors[b->id()];
+            size_t s = stack.back().second++;
+            if (s < succs.size()) {
+                Builder *succ = succs[s];
+                if (!visited[succ->id()]) {
+                    visited[succ->id()] = true;
+                    stack.push_back(std::make_pair(succ, 0));
+                }
+            }
+            else {
+                postOrder.push_back(b);
+                stack.pop_back();
+            }
+        }
+    }
+
+    for (auto it = postOrder.rbegin(); it != postOrder.rend(); it++) {
+        Builder *b = *it;
+        _rpoNumbers[b->id()] = _rpo.size();
+        _rpo.push_back(b);
+    }
+    _rpoValid = true;
+}
+
+const BuilderVector &
+ControlFlowGraph::reversePostOrder() {
+    if (!_rpoValid)
+        computeReversePostOrder();
+    return _rpo;
+}
+
+int32_t
+ControlFlowGraph::rpoNumber(Builder *b) {
+    if (!_rpoValid)
+        computeReversePostOrder();
+    if (b->id() >= _rpoNumbers.size())
+        return -1;
+    return _rpoNumbers[b->id()];
+}
+
+void
+ControlFlowGraph::write(TextWriter & w) {
+    w.indent() << "[ ControlFlowGraph" << w.endl();
+    w.indentIn();
+    const BuilderVector & rpo = reversePostOrder();
+    for (auto it = rpo.begin(); it != rpo.end(); it++) {
+        Builder *b = *it;
+        w.indent() << "[ " << b << " rpo " << rpoNumber(b) << " preds";
+        const BuilderVector & preds = predecessors(b);
+        for (auto pIt = preds.begin(); pIt != preds.end(); pIt++)
+            w << " " << *pIt;
+        w << " succs";
+        const BuilderVector & succs = successors(b);
+        for (auto sIt = succs.begin(); sIt != succs.end(); sIt++)
+            w << " " << *sIt;
+        w << " ]" << w.endl();
+    }
+    w.indentOut();
+    w.indent() << "]" << w.endl();
+}
+
+} // namespace JitBuilder
+} // namespace OMR
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef CONTROLFLOWGRAPH_INCL
+#define CONTROLFLOWGRAPH_INCL
+
+#include <stdint.h>
+#include <vector>
+#include "IDs.hpp"
+#include "typedefs.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class Compilation;
+class Operation;
+class TextWriter;
+
+// ControlFlowGraph materializes the control flow edges between the Builders of a Compilation.
+// Each Builder is a node, and its operations run in order in that node. Edges come from the
+// operations themselves (see Operation::controlFlowEdges()): an operation can transfer control
+// from its parent to a target Builder (e.g. Goto) or into the Builders bound to it, and bound
+// Builders can transfer control among themselves (e.g. a loop body and its loopContinue).
+// Control that reaches the end of a bound Builder resumes in the parent after the bound
+// operation, which is the parent's own node, so there are no edges back into the parent.
+// A Builder can also say where control goes when it reaches its end (Builder::controlFlowEdges(),
+// e.g. a BytecodeBuilder's fall through Builder), which adds an edge from it to that Builder.
+//
+// Predecessors, successors and reverse postorder numbers are kept in dense arrays indexed by
+// BuilderID. Edges may appear more than once (e.g. two branches to the same target). The graph
+// can be kept up to date as operations are added and removed (Transformer does this for the
+// operations it replaces); reverse postorder is recomputed lazily after any change.
+class ControlFlowGraph {
+public:
+    ControlFlowGraph(Compilation *comp);
+
+    Compilation *comp() const { return _comp; }
+
+    // (re)computes the graph from the operations reachable from the Compilation's entry Builders
+    void build();
+
+    int32_t numEntries() const                    { return _entries.size(); }
+    Builder *entry(int32_t i=0) const             { return _entries[i]; }
+
+    // one more than the largest BuilderID the graph has seen
+    BuilderID size() const                        { return _builders.size(); }
+    bool contains(Builder *b) const;
+    Builder *builder(BuilderID id) const          { return (id < _builders.size()) ? _builders[id] : NULL; }
+
+    int32_t numPredecessors(Builder *b) const     { return predecessors(b).size(); }
+    const BuilderVector & predecessors(Builder *b) const;
+    int32_t numSuccessors(Builder *b) const       { return successors(b).size(); }
+    const BuilderVector & successors(Builder *b) const;
+
+    // Builders reachable from the entries in reverse postorder, and each Builder's index in it (-1 if unreachable)
+    const BuilderVector & reversePostOrder();
+    int32_t rpoNumber(Builder *b);
+
+    // incremental maintenance
+    void addEdge(Builder *from, Builder *to);
+    void removeEdge(Builder *from, Builder *to);
+    void addOperation(Operation *op);
+    void removeOperation(Operation *op);
+
+    void write(TextWriter & w);
+
+protected:
+    void grow(BuilderID id);
+    void addBuilder(Builder *b);
+    void removeBuilder(Builder *b);
+    void computeReversePostOrder();
+
+    Compilation *_comp;
+    BuilderVector _entries;
+    BuilderVector _builders;                    // NULL for BuilderIDs not in the graph
+    std::vector<BuilderVector> _predecessors;
+    std::vector<BuilderVector> _successors;
+    BuilderVector _rpo;
+    std::vector<int32_t> _rpoNumbers;
+    bool _rpoValid;
+
+    static BuilderVector noBuilders;
+};
+
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(CONTROLFLOWGRAPH_INCL)
+
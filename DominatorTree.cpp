@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "Builder.hpp"
+#include "ControlFlowGraph.hpp"
+#include "DominatorTree.hpp"
+#include "TextWriter.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+BuilderVector DominatorTree::noBuilders;
+
+DominatorTree::DominatorTree(ControlFlowGraph *cfg)
+    : _cfg(cfg) {
+    compute();
+}
+
+// walks two fingers up the partially built tree until they meet; index 0 is the implicit root
+// and every other index is one more than the Builder's reverse postorder number
+int32_t
+DominatorTree::intersect(std::vector<int32_t> & doms, int32_t finger1, int32_t finger2) {
+    while (finger1 != finger2) {
+        while (finger1 > finger2)
+            finger1 = doms[finger1];
+        while (finger2 > finger1)
+            finger2 = doms[finger2];
+    }
+    return finger1;
+}
+
+void
+DominatorTree::compute() {
+    const BuilderVector & rpo = _cfg->reversePostOrder();
+    BuilderID size = _cfg->size();
+    _idoms.assign(size, NULL);
+    _children.assign(size, BuilderVector());
+    _depths.assign(size, 0);
+    _preorder.assign(size, -1);
+    _postorder.assign(size, -1);
+    _roots.clear();
+
+    const int32_t undefined = -1;
+    std::vector<int32_t> doms(rpo.size()+1, undefined);
+    doms[0] = 0;
+    for (int32_t e=0;e < _cfg->numEntries();e++)
+        doms[_cfg->rpoNumber(_cfg->entry(e))+1] = 0;
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int32_t r=0;r < rpo.size();r++) {
+            Builder *b = rpo[r];
+            if (doms[r+1] == 0) // entries are only dominated by the root
+                continue;
+
+            int32_t newIdom = undefined;
+            const BuilderVector & preds = _cfg->predecessors(b);
+            for (auto it = preds.begin(); it != preds.end(); it++) {
+                int32_t p = _cfg->rpoNumber(*it);
+                if (p < 0 || doms[p+1] == undefined)
+                    continue; // unreachable or not processed yet
+                newIdom = (newIdom == undefined) ? p+1 : intersect(doms, p+1, newIdom);
+            }
+            if (doms[r+1] != newIdom) {
+                doms[r+1] = newIdom;
+                changed = true;
+            }
+        }
+    }
+
+    for (int32_t r=0;r < rpo.size();r++) {
+        Builder *b = rpo[r];
+        if (doms[r+1] == 0) {
+            _roots.push_back(b);
+            continue;
+        }
+        Builder *idom = rpo[doms[r+1]-1];
+        _idoms[b->id()] = idom;
+        _children[idom->id()].push_back(b);
+    }
+
+    int32_t next = 0;
+    for (auto it = _roots.begin(); it != _roots.end(); it++)
+        number(*it, next);
+}
+
+// numbers the subtree rooted at b in preorder and postorder, and records depths
+void
+DominatorTree::number(Builder *b, int32_t & next) {
+    std::vector<std::pair<Builder *, size_t> > stack;
+    _preorder[b->id()] = next++;
+    stack.push_back(std::make_pair(b, 0));
+    while (!stack.empty()) {
+        Builder *node = stack.back().first;
+        const BuilderVector & kids = _children[node->id()];
+        size_t k = stack.back().second++;
+        if (k < kids.size()) {
+            Builder *child = kids[k];
+            _depths[child->id()] = _depths[node->id()] + 1;
+            _preorder[child->id()] = next++;
+            stack.push_back(std::make_pair(child, 0));
+        }
+        else {
+            _postorder[node->id()] = next++;
+            stack.pop_back();
+        }
+    }
+}
+
+bool
+DominatorTree::isReachable(Builder *b) const {
+    return b->id() < _preorder.size() && _preorder[b->id()] >= 0;
+}
+
+Builder *
+DominatorTree::idom(Builder *b) const {
+    if (b->id() >= _idoms.size())
+        return NULL;
+    return _idoms[b->id()];
+}
+
+const BuilderVector &
+DominatorTree::children(Builder *b) const {
+    if (b->id() >= _children.size())
+        return noBuilders;
+    return _children[b->id()];
+}
+
+int32_t
+DominatorTree::depth(Builder *b) const {
+    if (b->id() >= _depths.size())
+        return 0;
+    return _depths[b->id()];
+}
+
+bool
+DominatorTree::dominates(Builder *a, Builder *b) const {
+    if (!isReachable(a) || !isReachable(b))
+        return false;
+    return _preorder[a->id()] <= _preorder[b->id()] && _postorder[b->id()] <= _postorder[a->id()];
+}
+
+void
+DominatorTree::write(TextWriter & w) const {
+    w.indent() << "[ DominatorTree" << w.endl();
+    w.indentIn();
+    const BuilderVector & rpo = _cfg->reversePostOrder();
+    for (auto it = rpo.begin(); it != rpo.end(); it++) {
+        Builder *b = *it;
+        w.indent() << "[ " << b << " depth " << depth(b) << " idom ";
+        if (idom(b) != NULL)
+            w << idom(b);
+        else
+            w << "root";
+        w << " ]" << w.endl();
+    }
+    w.indentOut();
+    w.indent() << "]" << w.endl();
+}
+
+} // namespace JitBuilder
+} // namespace OMR
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef DOMINATORTREE_INCL
+#define DOMINATORTREE_INCL
+
+#include <stdint.h>
+#include <vector>
+#include "typedefs.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class ControlFlowGraph;
+class TextWriter;
+
+// DominatorTree computes the immediate dominator of every Builder reachable in a ControlFlowGraph
+// using the iterative algorithm of Cooper, Harvey and Kennedy ("A Simple, Fast Dominance
+// Algorithm") over the graph's reverse postorder. A Compilation can have several entries, so they
+// all hang off an implicit root: entries (and any Builder only the root dominates) have no
+// immediate dominator, and neither do Builders that are not reachable. The tree is numbered in preorder and postorder so that dominates()
+// takes constant time. The tree is not updated if the graph changes: compute a new one.
+class DominatorTree {
+public:
+    DominatorTree(ControlFlowGraph *cfg);
+
+    ControlFlowGraph *cfg() const { return _cfg; }
+
+    bool isReachable(Builder *b) const;
+
+    // NULL for Builders only the implicit root dominates (e.g. entries) and unreachable Builders
+    Builder *idom(Builder *b) const;
+
+    // Builders whose immediate dominator is b
+    const BuilderVector & children(Builder *b) const;
+
+    // number of dominators of b other than b itself
+    int32_t depth(Builder *b) const;
+
+    // true if every path from an entry to b goes through a (so a dominates itself)
+    bool dominates(Builder *a, Builder *b) const;
+    bool strictlyDominates(Builder *a, Builder *b) const { return a != b && dominates(a, b); }
+
+    void write(TextWriter & w) const;
+
+protected:
+    void compute();
+    int32_t intersect(std::vector<int32_t> & doms, int32_t finger1, int32_t finger2);
+    void number(Builder *b, int32_t & next);
+
+    ControlFlowGraph *_cfg;
+    BuilderVector _roots;
+    BuilderVector _idoms;                   // indexed by BuilderID
+    std::vector<BuilderVector> _children;   // indexed by BuilderID
+    std::vector<int32_t> _depths;           // indexed by BuilderID
+    std::vector<int32_t> _preorder;         // indexed by BuilderID, -1 if unreachable
+    std::vector<int32_t> _postorder;        // indexed by BuilderID
+
+    static BuilderVector noBuilders;
+};
+
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(DOMINATORTREE_INCL)
+
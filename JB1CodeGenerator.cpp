@@ -44,6 +44,7 @@ JB1CodeGenerator::JB1CodeGenerator(Compiler *compiler)
     : Visitor(compiler, "jb1cg")
     , _j1mb(NULL) {
     setTraceEnabled(false);
+    _visitColdBuildersLast = true;
 }
 
 CompilerReturnCode
@@ -19,6 +19,7 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <math.h>
 #include "Builder.hpp"
 #include "Compilation.hpp"
 #include "Config.hpp"
@@ -32,6 +33,7 @@
 #include "TypeDictionary.hpp"
 #include "Value.hpp"
 
+#include "il/Block.hpp"
 #include "ilgen/BytecodeBuilder.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/IlType.hpp"
@@ -175,8 +177,10 @@ JB1MethodBuilder::registerBuilder(const Builder * b, TR::IlBuilder *omr_b) {
     if (_builders.find(b->id()) != _builders.end())
         return;
 
-    if (omr_b != NULL)
+    if (omr_b != NULL) {
         _builders[b->id()] = omr_b;
+        markCold(b, omr_b);
+    }
 
     b->jbgen(this);
 }
@@ -189,6 +193,7 @@ JB1MethodBuilder::registerBytecodeBuilder(const Builder * bcb, TR::BytecodeBuild
     if (omr_bcb != NULL) {
         _bytecodeBuilders[bcb->id()] = omr_bcb;
         _builders[bcb->id()] = static_cast<TR::IlBuilder *>(omr_bcb);
+        markCold(bcb, omr_bcb);
     }
 
     bcb->jbgen(this);
@@ -201,6 +206,7 @@ JB1MethodBuilder::createBuilder(const Builder * b) {
 
     TR::IlBuilder *omr_b = _mb->OrphanBuilder();
     _builders[b->id()] = omr_b;
+    markCold(b, omr_b);
 }
 
 void
@@ -213,6 +219,15 @@ JB1MethodBuilder::createBytecodeBuilder(const Builder * bcb, int32_t bcIndex, st
     omr_bcb->setVMState(vmState);
     _bytecodeBuilders[bcb->id()] = omr_bcb;
     _builders[bcb->id()] = static_cast<TR::IlBuilder *>(omr_bcb);
+    markCold(bcb, omr_bcb);
+}
+
+// OMR keeps cold blocks out of line when it orders blocks, and it also treats branches into them
+// as unlikely, so a cold Builder's entry block is marked cold
+void
+JB1MethodBuilder::markCold(const Builder *b, TR::IlBuilder *omr_b) {
+    if (b->isCold())
+        omr_b->getEntry()->setIsCold();
 }
 
 void
@@ -338,6 +353,23 @@ JB1MethodBuilder::ConstAddress(Location *loc, Builder *b, Value *result, const v
     registerValue(result, omr_b->ConstAddress(v));
 }
 
+void
+JB1MethodBuilder::Abs(Location *loc, Builder *b, Value *result, Value *value) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    const Type *type = value->type();
+    int32_t bits = type->size();
+    TR::IlValue *v = map(value);
+    if (map(type)->getPrimitiveType().isFloatingPoint()) {
+        TR::IlValue *magnitude = signBit(omr_b, type, omr_b->ConvertBitsTo(integerType(omr_b, bits), v), false);
+        registerValue(result, omr_b->ConvertBitsTo(map(type), magnitude));
+        return;
+    }
+    // (v ^ s) - s, where s has every bit set if v is negative
+    TR::IlValue *s = omr_b->ShiftR(v, omr_b->ConstInt32(bits - 1));
+    registerValue(result, omr_b->Sub(omr_b->Xor(v, s), s));
+}
+
 void
 JB1MethodBuilder::Add(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
     TR::IlBuilder *omr_b = map(b);
@@ -345,6 +377,31 @@ JB1MethodBuilder::Add(Location *loc, Builder *b, Value *result, Value *left, Val
     registerValue(result, omr_b->Add(map(left), map(right)));
 }
 
+void
+JB1MethodBuilder::AddWithOverflow(Location *loc, Builder *b, Value *result, Builder *overflowTarget, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    // JB1 appends an overflow handler in line where it is created, so each operation gets its own
+    // handler that branches to overflowTarget, which other operations may also branch to
+    TR::IlBuilder *handler = NULL;
+    registerValue(result, omr_b->AddWithOverflow(&handler, map(left), map(right)));
+    handler->Goto(map(overflowTarget));
+}
+
+void
+JB1MethodBuilder::And(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->And(map(left), map(right)));
+}
+
+void
+JB1MethodBuilder::Ceil(Location *loc, Builder *b, Value *result, Value *value) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, roundToIntegral(omr_b, value, true));
+}
+
 void
 JB1MethodBuilder::ConvertTo(Location *loc, Builder *b, Value *result, const Type *type, Value *value) {
     TR::IlBuilder *omr_b = map(b);
@@ -352,6 +409,100 @@ JB1MethodBuilder::ConvertTo(Location *loc, Builder *b, Value *result, const Type
     registerValue(result, omr_b->ConvertTo(map(type), map(value)));
 }
 
+void
+JB1MethodBuilder::CopySign(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    const Type *type = left->type();
+    TR::IlType *intType = integerType(omr_b, type->size());
+    TR::IlValue *magnitude = signBit(omr_b, type, omr_b->ConvertBitsTo(intType, map(left)), false);
+    TR::IlValue *sign = signBit(omr_b, type, omr_b->ConvertBitsTo(intType, map(right)), true);
+    registerValue(result, omr_b->ConvertBitsTo(map(type), omr_b->Or(magnitude, sign)));
+}
+
+void
+JB1MethodBuilder::CountLeadingZeros(Location *loc, Builder *b, Value *result, Value *value) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    int32_t bits = value->type()->size();
+    TR::IlValue *v = widen(omr_b, map(value), bits);
+    // smear the highest one bit into every lower bit, then count the bits that are set
+    for (int32_t s=1;s < bits;s *= 2)
+        v = omr_b->Or(v, omr_b->UnsignedShiftR(v, omr_b->ConstInt32(s)));
+    registerValue(result, omr_b->Sub(omr_b->ConstInt32(bits), popCount(omr_b, v, bits)));
+}
+
+void
+JB1MethodBuilder::CountTrailingZeros(Location *loc, Builder *b, Value *result, Value *value) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    int32_t bits = value->type()->size();
+    TR::IlValue *v = widen(omr_b, map(value), bits);
+    if (bits < 32)
+        v = omr_b->Or(v, omr_b->ConstInt32(1 << bits)); // so that a zero value has bits trailing zeroes
+    int32_t width = (bits < 32) ? 32 : bits;
+    // ~v & (v - 1) has a one bit for each trailing zero of v
+    TR::IlValue *trailing = omr_b->And(omr_b->Xor(v, integerConst(omr_b, width, -1)),
+                                       omr_b->Sub(v, integerConst(omr_b, width, 1)));
+    registerValue(result, popCount(omr_b, trailing, width));
+}
+
+void
+JB1MethodBuilder::Div(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->Div(map(left), map(right)));
+}
+
+// JB1 has no fused multiply-add, so these generate a Mul and an Add or Sub: the product is
+// rounded before it is added or subtracted
+
+void
+JB1MethodBuilder::FMA(Location *loc, Builder *b, Value *result, Value *left, Value *right, Value *addend) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->Add(omr_b->Mul(map(left), map(right)), map(addend)));
+}
+
+void
+JB1MethodBuilder::FMS(Location *loc, Builder *b, Value *result, Value *left, Value *right, Value *subtrahend) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->Sub(omr_b->Mul(map(left), map(right)), map(subtrahend)));
+}
+
+void
+JB1MethodBuilder::FNMA(Location *loc, Builder *b, Value *result, Value *left, Value *right, Value *minuend) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->Sub(map(minuend), omr_b->Mul(map(left), map(right))));
+}
+
+void
+JB1MethodBuilder::Floor(Location *loc, Builder *b, Value *result, Value *value) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, roundToIntegral(omr_b, value, false));
+}
+
+void
+JB1MethodBuilder::Max(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    TR::IlValue *l = map(left);
+    TR::IlValue *r = map(right);
+    registerValue(result, blend(omr_b, left->type(), omr_b->GreaterThan(r, l), r, l));
+}
+
+void
+JB1MethodBuilder::Min(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    TR::IlValue *l = map(left);
+    TR::IlValue *r = map(right);
+    registerValue(result, blend(omr_b, left->type(), omr_b->LessThan(r, l), r, l));
+}
+
 void
 JB1MethodBuilder::Mul(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
     TR::IlBuilder *omr_b = map(b);
@@ -359,6 +510,89 @@ JB1MethodBuilder::Mul(Location *loc, Builder *b, Value *result, Value *left, Val
     registerValue(result, omr_b->Mul(map(left), map(right)));
 }
 
+void
+JB1MethodBuilder::MulHigh(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, mulHigh(omr_b, left, right, false));
+}
+
+void
+JB1MethodBuilder::MulWithOverflow(Location *loc, Builder *b, Value *result, Builder *overflowTarget, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    TR::IlBuilder *handler = NULL;
+    registerValue(result, omr_b->MulWithOverflow(&handler, map(left), map(right)));
+    handler->Goto(map(overflowTarget));
+}
+
+void
+JB1MethodBuilder::Not(Location *loc, Builder *b, Value *result, Value *value) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->Xor(map(value), integerConst(omr_b, value->type()->size(), -1)));
+}
+
+void
+JB1MethodBuilder::Or(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->Or(map(left), map(right)));
+}
+
+void
+JB1MethodBuilder::PopCount(Location *loc, Builder *b, Value *result, Value *value) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    int32_t bits = value->type()->size();
+    registerValue(result, popCount(omr_b, widen(omr_b, map(value), bits), bits));
+}
+
+void
+JB1MethodBuilder::Rem(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->Rem(map(left), map(right)));
+}
+
+void
+JB1MethodBuilder::RotateL(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, rotateLeft(omr_b, left, map(right)));
+}
+
+void
+JB1MethodBuilder::RotateR(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, rotateLeft(omr_b, left, omr_b->Sub(omr_b->ConstInt32(0), map(right))));
+}
+
+void
+JB1MethodBuilder::ShiftL(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->ShiftL(map(left), shiftAmount(omr_b, left, right)));
+}
+
+void
+JB1MethodBuilder::ShiftR(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->ShiftR(map(left), shiftAmount(omr_b, left, right)));
+}
+
+void
+JB1MethodBuilder::Sqrt(Location *loc, Builder *b, Value *result, Value *value) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    if (value->type()->size() == 64)
+        registerValue(result, callMathFunction(omr_b, "sqrt", (void *)(double (*)(double)) &sqrt, value));
+    else
+        registerValue(result, callMathFunction(omr_b, "sqrtf", (void *)(float (*)(float)) &sqrtf, value));
+}
+
 void
 JB1MethodBuilder::Sub(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
     TR::IlBuilder *omr_b = map(b);
@@ -366,6 +600,340 @@ JB1MethodBuilder::Sub(Location *loc, Builder *b, Value *result, Value *left, Val
     registerValue(result, omr_b->Sub(map(left), map(right)));
 }
 
+void
+JB1MethodBuilder::SubWithOverflow(Location *loc, Builder *b, Value *result, Builder *overflowTarget, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    TR::IlBuilder *handler = NULL;
+    registerValue(result, omr_b->SubWithOverflow(&handler, map(left), map(right)));
+    handler->Goto(map(overflowTarget));
+}
+
+void
+JB1MethodBuilder::UnsignedDiv(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->UnsignedDiv(map(left), map(right)));
+}
+
+void
+JB1MethodBuilder::UnsignedMulHigh(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, mulHigh(omr_b, left, right, true));
+}
+
+void
+JB1MethodBuilder::UnsignedRem(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->UnsignedRem(map(left), map(right)));
+}
+
+void
+JB1MethodBuilder::UnsignedShiftR(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->UnsignedShiftR(map(left), shiftAmount(omr_b, left, right)));
+}
+
+void
+JB1MethodBuilder::Xor(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->Xor(map(left), map(right)));
+}
+
+void
+JB1MethodBuilder::EqualTo(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->EqualTo(map(left), map(right)));
+}
+
+void
+JB1MethodBuilder::GreaterOrEqualTo(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->GreaterOrEqualTo(map(left), map(right)));
+}
+
+void
+JB1MethodBuilder::GreaterThan(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->GreaterThan(map(left), map(right)));
+}
+
+void
+JB1MethodBuilder::LessOrEqualTo(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->LessOrEqualTo(map(left), map(right)));
+}
+
+void
+JB1MethodBuilder::LessThan(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->LessThan(map(left), map(right)));
+}
+
+void
+JB1MethodBuilder::NotEqualTo(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->NotEqualTo(map(left), map(right)));
+}
+
+void
+JB1MethodBuilder::UnsignedGreaterOrEqualTo(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->UnsignedGreaterOrEqualTo(map(left), map(right)));
+}
+
+void
+JB1MethodBuilder::UnsignedGreaterThan(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->UnsignedGreaterThan(map(left), map(right)));
+}
+
+void
+JB1MethodBuilder::UnsignedLessOrEqualTo(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->UnsignedLessOrEqualTo(map(left), map(right)));
+}
+
+void
+JB1MethodBuilder::UnsignedLessThan(Location *loc, Builder *b, Value *result, Value *left, Value *right) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    registerValue(result, omr_b->UnsignedLessThan(map(left), map(right)));
+}
+
+void
+JB1MethodBuilder::Select(Location *loc, Builder *b, Value *result, Value *condition, Value *trueValue, Value *falseValue) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    TR::IlValue *isTrue = omr_b->NotEqualTo(map(condition), omr_b->ConstInt32(0));
+    registerValue(result, blend(omr_b, trueValue->type(), isTrue, map(trueValue), map(falseValue)));
+}
+
+// JB1 has no multiply high operation: narrower types are widened and multiplied as Int64,
+// and Int64 values are multiplied as 32-bit halves whose partial products are summed
+TR::IlValue *
+JB1MethodBuilder::mulHigh(TR::IlBuilder *omr_b, const Value *left, const Value *right, bool isUnsigned) {
+    TR::IlValue *l = map(left);
+    TR::IlValue *r = map(right);
+    int32_t bits = left->type()->size();
+    if (bits < 64) {
+        TR::IlValue *wideL = isUnsigned ? omr_b->UnsignedConvertTo(omr_b->Int64, l) : omr_b->ConvertTo(omr_b->Int64, l);
+        TR::IlValue *wideR = isUnsigned ? omr_b->UnsignedConvertTo(omr_b->Int64, r) : omr_b->ConvertTo(omr_b->Int64, r);
+        TR::IlValue *product = omr_b->Mul(wideL, wideR);
+        return omr_b->ConvertTo(map(left->type()), omr_b->UnsignedShiftR(product, omr_b->ConstInt32(bits)));
+    }
+
+    TR::IlValue *mask = omr_b->ConstInt64(0xFFFFFFFFLL);
+    TR::IlValue *thirtyTwo = omr_b->ConstInt32(32);
+    TR::IlValue *lLow = omr_b->And(l, mask);
+    TR::IlValue *lHigh = omr_b->UnsignedShiftR(l, thirtyTwo);
+    TR::IlValue *rLow = omr_b->And(r, mask);
+    TR::IlValue *rHigh = omr_b->UnsignedShiftR(r, thirtyTwo);
+    TR::IlValue *lowLow = omr_b->Mul(lLow, rLow);
+    TR::IlValue *lowHigh = omr_b->Mul(lLow, rHigh);
+    TR::IlValue *highLow = omr_b->Mul(lHigh, rLow);
+    TR::IlValue *highHigh = omr_b->Mul(lHigh, rHigh);
+    TR::IlValue *middle = omr_b->Add(omr_b->Add(omr_b->UnsignedShiftR(lowLow, thirtyTwo),
+                                                omr_b->And(lowHigh, mask)),
+                                     omr_b->And(highLow, mask));
+    TR::IlValue *high = omr_b->Add(omr_b->Add(omr_b->Add(highHigh,
+                                                         omr_b->UnsignedShiftR(lowHigh, thirtyTwo)),
+                                              omr_b->UnsignedShiftR(highLow, thirtyTwo)),
+                                   omr_b->UnsignedShiftR(middle, thirtyTwo));
+    if (!isUnsigned) {
+        // a negative operand contributes 2^64 times the other operand to the unsigned product
+        TR::IlValue *sixtyThree = omr_b->ConstInt32(63);
+        high = omr_b->Sub(high, omr_b->And(omr_b->ShiftR(l, sixtyThree), r));
+        high = omr_b->Sub(high, omr_b->And(omr_b->ShiftR(r, sixtyThree), l));
+    }
+    return high;
+}
+
+TR::IlValue *
+JB1MethodBuilder::integerConst(TR::IlBuilder *omr_b, int32_t bits, int64_t v) {
+    switch (bits) {
+        case 8 :
+            return omr_b->ConstInt8((int8_t) v);
+        case 16 :
+            return omr_b->ConstInt16((int16_t) v);
+        case 32 :
+            return omr_b->ConstInt32((int32_t) v);
+        default :
+            assert(bits == 64);
+            return omr_b->ConstInt64(v);
+    }
+}
+
+TR::IlType *
+JB1MethodBuilder::integerType(TR::IlBuilder *omr_b, int32_t bits) {
+    switch (bits) {
+        case 8 :
+            return omr_b->Int8;
+        case 16 :
+            return omr_b->Int16;
+        case 32 :
+            return omr_b->Int32;
+        default :
+            assert(bits == 64);
+            return omr_b->Int64;
+    }
+}
+
+// JB1 has no select operation, so values are blended with a mask that has every bit set when
+// condition (an Int32 that is 1 or 0) is 1: falseValue ^ ((trueValue ^ falseValue) & mask).
+// Floating point and address values are blended as integers of the same size.
+TR::IlValue *
+JB1MethodBuilder::blend(TR::IlBuilder *omr_b, const Type *type, TR::IlValue *condition, TR::IlValue *trueValue, TR::IlValue *falseValue) {
+    TR::IlType *omr_type = map(type);
+    int32_t bits = type->size();
+    TR::IlType *intType = integerType(omr_b, bits);
+    bool isFloatingPoint = omr_type->getPrimitiveType().isFloatingPoint();
+    bool isAddress = omr_type->getPrimitiveType().isAddress();
+    if (isFloatingPoint) {
+        trueValue = omr_b->ConvertBitsTo(intType, trueValue);
+        falseValue = omr_b->ConvertBitsTo(intType, falseValue);
+    }
+    else if (isAddress) {
+        trueValue = omr_b->ConvertTo(intType, trueValue);
+        falseValue = omr_b->ConvertTo(intType, falseValue);
+    }
+
+    TR::IlValue *mask = omr_b->Sub(omr_b->ConstInt32(0), condition);
+    if (bits != 32)
+        mask = omr_b->ConvertTo(intType, mask);
+    TR::IlValue *blended = omr_b->Xor(falseValue, omr_b->And(omr_b->Xor(trueValue, falseValue), mask));
+
+    if (isFloatingPoint)
+        return omr_b->ConvertBitsTo(omr_type, blended);
+    else if (isAddress)
+        return omr_b->ConvertTo(omr_type, blended);
+    return blended;
+}
+
+// bits holds the bits of a floating point value of the given type: returns only its sign bit if
+// keep is true, or every bit except its sign bit if keep is false
+TR::IlValue *
+JB1MethodBuilder::signBit(TR::IlBuilder *omr_b, const Type *type, TR::IlValue *bits, bool keep) {
+    int32_t size = type->size();
+    int64_t sign = (int64_t)((uint64_t)1 << (size - 1));
+    return omr_b->And(bits, integerConst(omr_b, size, keep ? sign : ~sign));
+}
+
+// JB1 has no square root operation, so Sqrt calls the C library function with the given name,
+// which is defined to the MethodBuilder the first time it is called
+TR::IlValue *
+JB1MethodBuilder::callMathFunction(TR::IlBuilder *omr_b, std::string name, void *entryPoint, const Value *value) {
+    TR::IlType *type = map(value->type());
+    if (_mathFunctions.find(name) == _mathFunctions.end()) {
+        TR::IlType **parmTypes = new TR::IlType *[1];
+        parmTypes[0] = type;
+        _mb->DefineFunction(findOrCreateString(name), findOrCreateString("libm"), findOrCreateString("0"),
+                            entryPoint, type, 1, parmTypes);
+        _mathFunctions.insert(name);
+    }
+    TR::IlValue *args[1] = { map(value) };
+    return omr_b->Call(findOrCreateString(name), 1, args);
+}
+
+// JB1 has no rounding operations, so Floor and Ceil truncate value by converting it to an integer
+// and back, then step the result by one toward -infinity (or +infinity if up is true) if it was
+// truncated the other way. The sign of value is copied to the result so that zero results keep it
+// (e.g. Ceil(-0.5) is -0.0). Values too big to have a fractional part (and so perhaps too big to
+// convert), infinities and NaN are returned as they are.
+TR::IlValue *
+JB1MethodBuilder::roundToIntegral(TR::IlBuilder *omr_b, const Value *value, bool up) {
+    const Type *type = value->type();
+    int32_t bits = type->size();
+    TR::IlType *omr_type = map(type);
+    TR::IlType *intType = integerType(omr_b, bits);
+    TR::IlValue *v = map(value);
+
+    TR::IlValue *one, *zero, *limit;
+    if (bits == 64) {
+        one = omr_b->ConstDouble(up ? 1.0 : -1.0);
+        zero = omr_b->ConstDouble(0.0);
+        limit = omr_b->ConstDouble(4503599627370496.0); // 2^52
+    } else {
+        one = omr_b->ConstFloat(up ? 1.0f : -1.0f);
+        zero = omr_b->ConstFloat(0.0f);
+        limit = omr_b->ConstFloat(8388608.0f); // 2^23
+    }
+
+    TR::IlValue *truncated = omr_b->ConvertTo(omr_type, omr_b->ConvertTo(intType, v));
+    TR::IlValue *stepped = up ? omr_b->LessThan(truncated, v) : omr_b->GreaterThan(truncated, v);
+    TR::IlValue *rounded = omr_b->Add(truncated, blend(omr_b, type, stepped, one, zero));
+
+    TR::IlValue *vBits = omr_b->ConvertBitsTo(intType, v);
+    TR::IlValue *sign = signBit(omr_b, type, vBits, true);
+    TR::IlValue *magnitude = signBit(omr_b, type, omr_b->ConvertBitsTo(intType, rounded), false);
+    rounded = omr_b->ConvertBitsTo(omr_type, omr_b->Or(magnitude, sign));
+
+    TR::IlValue *absV = omr_b->ConvertBitsTo(omr_type, signBit(omr_b, type, vBits, false));
+    return blend(omr_b, type, omr_b->LessThan(absV, limit), rounded, v);
+}
+
+// zero extends Int8 and Int16 values to Int32 so bit counting can be done on Int32 or Int64 values
+TR::IlValue *
+JB1MethodBuilder::widen(TR::IlBuilder *omr_b, TR::IlValue *v, int32_t bits) {
+    if (bits < 32)
+        return omr_b->UnsignedConvertTo(omr_b->Int32, v);
+    return v;
+}
+
+// JB1 has no rotate operation, so value is rotated with two shifts; narrower types are rotated
+// as zero extended Int32 values whose upper bits are discarded afterwards
+TR::IlValue *
+JB1MethodBuilder::rotateLeft(TR::IlBuilder *omr_b, const Value *value, TR::IlValue *amount) {
+    int32_t bits = value->type()->size();
+    TR::IlValue *v = widen(omr_b, map(value), bits);
+    TR::IlValue *mask = omr_b->ConstInt32(bits - 1);
+    TR::IlValue *left = omr_b->And(amount, mask);
+    TR::IlValue *right = omr_b->And(omr_b->Sub(omr_b->ConstInt32(bits), left), mask);
+    TR::IlValue *rotated = omr_b->Or(omr_b->ShiftL(v, left), omr_b->UnsignedShiftR(v, right));
+    if (bits < 32)
+        return omr_b->ConvertTo(map(value->type()), rotated);
+    return rotated;
+}
+
+// shift amounts are taken modulo the width of value (as ConstantFolding does), which the native
+// shift instructions do not do for Int8 and Int16 values shifted in 32-bit registers
+TR::IlValue *
+JB1MethodBuilder::shiftAmount(TR::IlBuilder *omr_b, const Value *value, const Value *amount) {
+    int32_t bits = value->type()->size();
+    return omr_b->And(map(amount), omr_b->ConstInt32(bits - 1));
+}
+
+// JB1 has no population count operation, so bits are summed in parallel within ever wider fields
+// (see Hacker's Delight 5-1); v must be an Int32 or Int64 whose value has at most bits one bits
+TR::IlValue *
+JB1MethodBuilder::popCount(TR::IlBuilder *omr_b, TR::IlValue *v, int32_t bits) {
+    int32_t width = (bits < 32) ? 32 : bits;
+    TR::IlValue *fives = integerConst(omr_b, width, 0x5555555555555555LL);
+    TR::IlValue *threes = integerConst(omr_b, width, 0x3333333333333333LL);
+    TR::IlValue *zeroFs = integerConst(omr_b, width, 0x0F0F0F0F0F0F0F0FLL);
+    TR::IlValue *ones = integerConst(omr_b, width, 0x0101010101010101LL);
+    v = omr_b->Sub(v, omr_b->And(omr_b->UnsignedShiftR(v, omr_b->ConstInt32(1)), fives));
+    v = omr_b->Add(omr_b->And(v, threes), omr_b->And(omr_b->UnsignedShiftR(v, omr_b->ConstInt32(2)), threes));
+    v = omr_b->And(omr_b->Add(v, omr_b->UnsignedShiftR(v, omr_b->ConstInt32(4))), zeroFs);
+    v = omr_b->UnsignedShiftR(omr_b->Mul(v, ones), omr_b->ConstInt32(width - 8));
+    if (width == 64)
+        return omr_b->ConvertTo(omr_b->Int32, v);
+    return v;
+}
+
 void
 JB1MethodBuilder::EntryPoint(Builder *entryBuilder) {
     TR::IlBuilder *omr_b = map(entryBuilder);
@@ -526,6 +1094,84 @@ JB1MethodBuilder::Return(Location *loc, Builder *b, Value *v) {
         omr_b->Return();
 }
 
+// JB1 appends every case and default builder of a Switch in line after it, so each one is a fresh
+// builder that branches to the actual target, which may be shared or appended elsewhere
+TR::IlBuilder *
+JB1MethodBuilder::gotoBuilder(const Builder *target) {
+    TR::IlBuilder *omr_b = _mb->OrphanBuilder();
+    omr_b->Goto(map(target));
+    return omr_b;
+}
+
+void
+JB1MethodBuilder::Switch(Location *loc, Builder *b, Value *selector, Builder *defaultTarget, std::vector<int32_t> & caseValues, std::vector<Builder *> & caseTargets) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    uint32_t numCases = caseValues.size();
+    TR::IlBuilder::JBCase **cases = new TR::IlBuilder::JBCase *[numCases];
+    for (uint32_t c=0;c < numCases;c++) {
+        TR::IlBuilder *omr_target = gotoBuilder(caseTargets[c]);
+        cases[c] = omr_b->MakeCase(caseValues[c], &omr_target, false);
+    }
+    TR::IlBuilder *omr_default = gotoBuilder(defaultTarget);
+    omr_b->Switch(map(selector), &omr_default, numCases, cases);
+}
+
+// each distinct target gets a mask with a bit set for each of its case values, relative to the
+// lowest case value, and the selector's bit is tested against each mask in turn
+void
+JB1MethodBuilder::SwitchWithBitTests(Location *loc, Builder *b, Value *selector, Builder *defaultTarget, std::vector<int32_t> & caseValues, std::vector<Builder *> & caseTargets) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    int32_t low = caseValues.front();
+    int32_t high = caseValues.back();
+    std::vector<Builder *> targets;
+    std::vector<uint64_t> masks;
+    for (size_t c=0;c < caseValues.size();c++) {
+        size_t t=0;
+        while (t < targets.size() && targets[t] != caseTargets[c])
+            t++;
+        if (t == targets.size()) {
+            targets.push_back(caseTargets[c]);
+            masks.push_back(0);
+        }
+        masks[t] |= ((uint64_t)1) << (caseValues[c] - low);
+    }
+
+    TR::IlValue *offset = omr_b->Sub(map(selector), omr_b->ConstInt32(low));
+    omr_b->IfCmpUnsignedGreaterThan(map(defaultTarget), offset, omr_b->ConstInt32(high - low));
+    TR::IlValue *bit = omr_b->ShiftL(omr_b->ConstInt64(1), offset);
+    for (size_t t=0;t < targets.size();t++)
+        omr_b->IfCmpNotEqualZero(map(targets[t]), omr_b->And(bit, omr_b->ConstInt64((int64_t)masks[t])));
+    omr_b->Goto(map(defaultTarget));
+}
+
+void
+JB1MethodBuilder::SwitchWithBinarySearch(Location *loc, Builder *b, Value *selector, Builder *defaultTarget, std::vector<int32_t> & caseValues, std::vector<Builder *> & caseTargets) {
+    TR::IlBuilder *omr_b = map(b);
+    omr_b->setBCIndex(loc->bcIndex())->SetCurrentIlGenerator();
+    searchCases(omr_b, map(selector), defaultTarget, caseValues, caseTargets, 0, caseValues.size());
+}
+
+// generates the search of caseValues[first..last): a few cases are compared one at a time, and
+// more are split at the middle case value into two halves that are searched the same way
+void
+JB1MethodBuilder::searchCases(TR::IlBuilder *omr_b, TR::IlValue *selector, Builder *defaultTarget, std::vector<int32_t> & caseValues, std::vector<Builder *> & caseTargets, size_t first, size_t last) {
+    if (last - first <= 3) {
+        for (size_t c=first;c < last;c++)
+            omr_b->IfCmpEqual(map(caseTargets[c]), selector, omr_b->ConstInt32(caseValues[c]));
+        omr_b->Goto(map(defaultTarget));
+        return;
+    }
+
+    size_t middle = first + (last - first) / 2;
+    TR::IlBuilder *lower = NULL;
+    TR::IlBuilder *upper = NULL;
+    omr_b->IfThenElse(&lower, &upper, omr_b->LessThan(selector, omr_b->ConstInt32(caseValues[middle])));
+    searchCases(lower, selector, defaultTarget, caseValues, caseTargets, first, middle);
+    searchCases(upper, selector, defaultTarget, caseValues, caseTargets, middle, last);
+}
+
 void
 JB1MethodBuilder::Load(Location *loc, Builder *b, Value *result, Symbol *sym) {
     TR::IlBuilder *omr_b = map(b);
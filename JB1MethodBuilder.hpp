@@ -23,7 +23,9 @@
 #define JB1METHODBUILDER_INCL
 
 #include <map>
+#include <set>
 #include <string>
+#include <vector>
 #include "Transformer.hpp"
 
 namespace TR { class BytecodeBuilder; }
@@ -106,10 +108,53 @@ public:
     void ConstDouble(Location *loc, Builder *b, Value *result, const double v);
     void ConstAddress(Location *loc, Builder *b, Value *result, const void *v);
 
+    void Abs(Location *loc, Builder *b, Value *result, Value *value);
     void Add(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void AddWithOverflow(Location *loc, Builder *b, Value *result, Builder *overflowTarget, Value *left, Value *right);
+    void And(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void Ceil(Location *loc, Builder *b, Value *result, Value *value);
     void ConvertTo(Location *loc, Builder *b, Value *result, const Type *type, Value *value);
+    void CopySign(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void CountLeadingZeros(Location *loc, Builder *b, Value *result, Value *value);
+    void CountTrailingZeros(Location *loc, Builder *b, Value *result, Value *value);
+    void Div(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void FMA(Location *loc, Builder *b, Value *result, Value *left, Value *right, Value *addend);
+    void FMS(Location *loc, Builder *b, Value *result, Value *left, Value *right, Value *subtrahend);
+    void FNMA(Location *loc, Builder *b, Value *result, Value *left, Value *right, Value *minuend);
+    void Floor(Location *loc, Builder *b, Value *result, Value *value);
+    void Max(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void Min(Location *loc, Builder *b, Value *result, Value *left, Value *right);
     void Mul(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void MulHigh(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void MulWithOverflow(Location *loc, Builder *b, Value *result, Builder *overflowTarget, Value *left, Value *right);
+    void Not(Location *loc, Builder *b, Value *result, Value *value);
+    void Or(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void PopCount(Location *loc, Builder *b, Value *result, Value *value);
+    void Rem(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void RotateL(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void RotateR(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void ShiftL(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void ShiftR(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void Sqrt(Location *loc, Builder *b, Value *result, Value *value);
     void Sub(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void SubWithOverflow(Location *loc, Builder *b, Value *result, Builder *overflowTarget, Value *left, Value *right);
+    void UnsignedDiv(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void UnsignedMulHigh(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void UnsignedRem(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void UnsignedShiftR(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void Xor(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+
+    void EqualTo(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void GreaterOrEqualTo(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void GreaterThan(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void LessOrEqualTo(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void LessThan(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void NotEqualTo(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void UnsignedGreaterOrEqualTo(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void UnsignedGreaterThan(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void UnsignedLessOrEqualTo(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void UnsignedLessThan(Location *loc, Builder *b, Value *result, Value *left, Value *right);
+    void Select(Location *loc, Builder *b, Value *result, Value *condition, Value *trueValue, Value *falseValue);
 
     void Call(Location *loc, Builder *b, Value *result, std::string targetName, std::vector<Value *> arguments);
     void Call(Location *loc, Builder *b, std::string targetName, std::vector<Value *> arguments);
@@ -130,6 +175,10 @@ public:
     void IfCmpUnsignedLessOrEqual(Location *loc, Builder *b, Builder *target, Value *left, Value *right);
     void Return(Location *loc, Builder *b);
     void Return(Location *loc, Builder *b, Value *value);
+    // caseValues must be in increasing order, and caseTargets[c] is the target for caseValues[c]
+    void Switch(Location *loc, Builder *b, Value *selector, Builder *defaultTarget, std::vector<int32_t> & caseValues, std::vector<Builder *> & caseTargets);
+    void SwitchWithBitTests(Location *loc, Builder *b, Value *selector, Builder *defaultTarget, std::vector<int32_t> & caseValues, std::vector<Builder *> & caseTargets);
+    void SwitchWithBinarySearch(Location *loc, Builder *b, Value *selector, Builder *defaultTarget, std::vector<int32_t> & caseValues, std::vector<Builder *> & caseTargets);
 
     void Load(Location *loc, Builder *b, Value *result, Symbol *sym);
     void Store(Location *loc, Builder *b, Symbol *sym, Value *value);
@@ -153,6 +202,20 @@ protected:
 
     char * findOrCreateString(std::string str);
     void registerValue(const Value * v, TR::IlValue *omr_v);
+    TR::IlValue *mulHigh(TR::IlBuilder *omr_b, const Value *left, const Value *right, bool isUnsigned);
+    TR::IlValue *integerConst(TR::IlBuilder *omr_b, int32_t bits, int64_t v);
+    TR::IlValue *widen(TR::IlBuilder *omr_b, TR::IlValue *v, int32_t bits);
+    TR::IlValue *rotateLeft(TR::IlBuilder *omr_b, const Value *value, TR::IlValue *amount);
+    TR::IlValue *roundToIntegral(TR::IlBuilder *omr_b, const Value *value, bool up);
+    TR::IlValue *shiftAmount(TR::IlBuilder *omr_b, const Value *value, const Value *amount);
+    TR::IlValue *popCount(TR::IlBuilder *omr_b, TR::IlValue *v, int32_t bits);
+    TR::IlType *integerType(TR::IlBuilder *omr_b, int32_t bits);
+    TR::IlValue *blend(TR::IlBuilder *omr_b, const Type *type, TR::IlValue *condition, TR::IlValue *trueValue, TR::IlValue *falseValue);
+    TR::IlValue *signBit(TR::IlBuilder *omr_b, const Type *type, TR::IlValue *bits, bool keep);
+    TR::IlValue *callMathFunction(TR::IlBuilder *omr_b, std::string name, void *entryPoint, const Value *value);
+    TR::IlBuilder *gotoBuilder(const Builder *target);
+    void markCold(const Builder *b, TR::IlBuilder *omr_b);
+    void searchCases(TR::IlBuilder *omr_b, TR::IlValue *selector, Builder *defaultTarget, std::vector<int32_t> & caseValues, std::vector<Builder *> & caseTargets, size_t first, size_t last);
 
     TR::IlBuilder *map(const Builder * b, bool checkNull=true);
     TR::BytecodeBuilder *mapBytecodeBuilder(const Builder * b, bool checkNull=true);
@@ -174,6 +237,7 @@ protected:
     //std::map<FunctionID,TR::MethodBuilder *> _methodBuilders;
     //std::map<TypeDictionaryID,TR::TypeDictionary *> _typeDictionaries;
     std::map<std::string,char *> _strings;
+    std::set<std::string> _mathFunctions; // C library functions defined to _mb
 
     Compilation *_comp;
     TR::MethodBuilder *_mb;
@@ -22,12 +22,15 @@
 #ifndef OMR_JITBUILDER_JBCORE_INCL
 #define OMR_JITBUILDER_JBCORE_INCL
 
+#include "BitVector.hpp"
 #include "Builder.hpp"
 #include "Compilation.hpp"
 #include "Compiler.hpp"
 #include "Config.hpp"
 #include "Context.hpp"
+#include "ControlFlowGraph.hpp"
 #include "CreateLoc.hpp"
+#include "DominatorTree.hpp"
 #include "Extension.hpp"
 #include "IDs.hpp"
 #include "Iterator.hpp"
@@ -37,8 +40,10 @@
 #include "KindService.hpp"
 #include "Literal.hpp"
 #include "LiteralDictionary.hpp"
+#include "Liveness.hpp"
 #include "Location.hpp"
 #include "Loggable.hpp"
+#include "LoopNest.hpp"
 #include "Mapper.hpp"
 #include "Operation.hpp"
 #include "OperationCloner.hpp"
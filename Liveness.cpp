@@ -0,0 +1,287 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <algorithm>
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "ControlFlowGraph.hpp"
+#include "Liveness.hpp"
+#include "LoopNest.hpp"
+#include "Operation.hpp"
+#include "Symbol.hpp"
+#include "TextWriter.hpp"
+#include "Value.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+Liveness::Liveness(ControlFlowGraph *cfg)
+    : _cfg(cfg)
+    , _numValues(cfg->comp()->maxValueID()+1) {
+
+    prepare();
+
+    // iterate backwards through the graph until nothing changes
+    const BuilderVector & rpo = _cfg->reversePostOrder();
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (auto it = rpo.rbegin(); it != rpo.rend(); it++) {
+            if (transfer(*it))
+                changed = true;
+        }
+    }
+}
+
+// numbers the Symbols, and finds how control leaves each Builder
+void
+Liveness::prepare() {
+    BuilderID size = _cfg->size();
+    _endSuccessors.assign(size, BuilderVector());
+    _returnsToParent.assign(size, false);
+
+    const BuilderVector & rpo = _cfg->reversePostOrder();
+    for (auto it = rpo.begin(); it != rpo.end(); it++) {
+        Builder *b = *it;
+        BuilderVector endSuccessors(_cfg->successors(b));
+        for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+            Operation *op = *opIt;
+            for (int32_t s=0;s < op->numReadSymbols();s++) {
+                Symbol *sym = op->readSymbol(s);
+                if (_symbolIndices.find(sym) == _symbolIndices.end()) {
+                    _symbolIndices[sym] = _symbols.size();
+                    _symbols.push_back(sym);
+                }
+            }
+            for (int32_t s=0;s < op->numWrittenSymbols();s++) {
+                Symbol *sym = op->writtenSymbol(s);
+                if (_symbolIndices.find(sym) == _symbolIndices.end()) {
+                    _symbolIndices[sym] = _symbols.size();
+                    _symbols.push_back(sym);
+                }
+            }
+
+            if (op->numBuilders() == 0)
+                continue;
+
+            // edges from b created by op leave at op, any others leave from the end of b
+            ControlFlowEdgeVector edges;
+            op->controlFlowEdges(edges);
+            BuilderVector & entered = _entered[op];
+            for (auto eIt = edges.begin(); eIt != edges.end(); eIt++) {
+                if (eIt->first != b)
+                    continue;
+                entered.push_back(eIt->second);
+                auto found = std::find(endSuccessors.begin(), endSuccessors.end(), eIt->second);
+                if (found != endSuccessors.end())
+                    endSuccessors.erase(found);
+            }
+        }
+        _endSuccessors[b->id()] = endSuccessors;
+
+        if (b->isBound()) {
+            ControlFlowEdgeVector edges;
+            b->boundToOperation()->controlFlowEdges(edges);
+            bool returns = true;
+            for (auto eIt = edges.begin(); eIt != edges.end(); eIt++) {
+                if (eIt->first == b)
+                    returns = false;
+            }
+            _returnsToParent[b->id()] = returns;
+        }
+    }
+
+    _empty = LiveSet(_numValues, _symbols.size());
+    _liveIn.assign(size, _empty);
+    _liveOut.assign(size, _empty);
+    _peaks.assign(size, 0);
+}
+
+int32_t
+Liveness::symbolIndex(Symbol *sym) const {
+    auto found = _symbolIndices.find(sym);
+    if (found == _symbolIndices.end())
+        return -1;
+    return found->second;
+}
+
+void
+Liveness::addUses(Operation *op, LiveSet & live) {
+    for (int32_t o=0;o < op->numOperands();o++) {
+        Value *v = op->operand(o);
+        if (v != NULL)
+            live._values.set(v->id());
+    }
+    for (int32_t s=0;s < op->numReadSymbols();s++)
+        live._symbols.set(_symbolIndices[op->readSymbol(s)]);
+}
+
+void
+Liveness::removeDefinitions(Operation *op, LiveSet & live) {
+    for (int32_t r=0;r < op->numResults();r++)
+        live._values.reset(op->result(r)->id());
+    for (int32_t s=0;s < op->numWrittenSymbols();s++)
+        live._symbols.reset(_symbolIndices[op->writtenSymbol(s)]);
+}
+
+// recomputes what is live through b, returning true if anything changed
+bool
+Liveness::transfer(Builder *b) {
+    bool changed = false;
+    LiveSet live(_empty);
+
+    const BuilderVector & endSuccessors = _endSuccessors[b->id()];
+    for (auto it = endSuccessors.begin(); it != endSuccessors.end(); it++)
+        live.unionWith(_liveIn[(*it)->id()]);
+
+    if (b->isBound()) {
+        Operation *binder = b->boundToOperation();
+        if (_returnsToParent[b->id()]) {
+            auto after = _liveAfter.find(binder);
+            if (after != _liveAfter.end())
+                live.unionWith(after->second);
+        }
+        addUses(binder, live);
+        for (int32_t s=0;s < binder->numWrittenSymbols();s++)
+            live._symbols.set(_symbolIndices[binder->writtenSymbol(s)]);
+    }
+    _liveOut[b->id()] = live;
+
+    int32_t peak = live.count();
+    OperationVector & ops = b->operations();
+    for (auto opIt = ops.rbegin(); opIt != ops.rend(); opIt++) {
+        Operation *op = *opIt;
+        auto entered = _entered.find(op);
+        if (entered != _entered.end()) {
+            auto after = _liveAfter.find(op);
+            if (after == _liveAfter.end()) {
+                _liveAfter.insert(std::make_pair(op, live));
+                changed = true;
+            }
+            else if (after->second != live) {
+                after->second = live;
+                changed = true;
+            }
+
+            BuilderVector & targets = entered->second;
+            for (auto it = targets.begin(); it != targets.end(); it++)
+                live.unionWith(_liveIn[(*it)->id()]);
+        }
+
+        removeDefinitions(op, live);
+        addUses(op, live);
+        peak = std::max(peak, live.count());
+    }
+    _peaks[b->id()] = peak;
+
+    if (_liveIn[b->id()] != live) {
+        _liveIn[b->id()] = live;
+        changed = true;
+    }
+    return changed;
+}
+
+bool
+Liveness::isInGraph(Builder *b) const {
+    return b->id() < _liveIn.size();
+}
+
+const BitVector &
+Liveness::liveInValues(Builder *b) const {
+    return isInGraph(b) ? _liveIn[b->id()]._values : _empty._values;
+}
+
+const BitVector &
+Liveness::liveOutValues(Builder *b) const {
+    return isInGraph(b) ? _liveOut[b->id()]._values : _empty._values;
+}
+
+const BitVector &
+Liveness::liveInSymbols(Builder *b) const {
+    return isInGraph(b) ? _liveIn[b->id()]._symbols : _empty._symbols;
+}
+
+const BitVector &
+Liveness::liveOutSymbols(Builder *b) const {
+    return isInGraph(b) ? _liveOut[b->id()]._symbols : _empty._symbols;
+}
+
+bool
+Liveness::isLiveIn(Builder *b, Value *v) const {
+    return liveInValues(b).test(v->id());
+}
+
+bool
+Liveness::isLiveOut(Builder *b, Value *v) const {
+    return liveOutValues(b).test(v->id());
+}
+
+bool
+Liveness::isLiveIn(Builder *b, Symbol *sym) const {
+    int32_t index = symbolIndex(sym);
+    return index >= 0 && liveInSymbols(b).test(index);
+}
+
+bool
+Liveness::isLiveOut(Builder *b, Symbol *sym) const {
+    int32_t index = symbolIndex(sym);
+    return index >= 0 && liveOutSymbols(b).test(index);
+}
+
+int32_t
+Liveness::peakPressure(Builder *b) const {
+    return isInGraph(b) ? _peaks[b->id()] : 0;
+}
+
+int32_t
+Liveness::peakPressure(Loop *loop) const {
+    int32_t peak = 0;
+    const BuilderVector & builders = loop->builders();
+    for (auto it = builders.begin(); it != builders.end(); it++)
+        peak = std::max(peak, peakPressure(*it));
+    return peak;
+}
+
+void
+Liveness::write(TextWriter & w) const {
+    w.indent() << "[ Liveness" << w.endl();
+    w.indentIn();
+    const BuilderVector & rpo = _cfg->reversePostOrder();
+    for (auto it = rpo.begin(); it != rpo.end(); it++) {
+        Builder *b = *it;
+        w.indent() << "[ " << b << " peak " << peakPressure(b) << " liveIn";
+        for (size_t v=0;v < _numValues;v++) {
+            if (liveInValues(b).test(v))
+                w << " v" << v;
+        }
+        for (size_t s=0;s < _symbols.size();s++) {
+            if (liveInSymbols(b).test(s))
+                w << " " << _symbols[s]->name();
+        }
+        w << " ]" << w.endl();
+    }
+    w.indentOut();
+    w.indent() << "]" << w.endl();
+}
+
+} // namespace JitBuilder
+} // namespace OMR
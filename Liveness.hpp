@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef LIVENESS_INCL
+#define LIVENESS_INCL
+
+#include <stdint.h>
+#include <map>
+#include <vector>
+#include "BitVector.hpp"
+#include "typedefs.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class ControlFlowGraph;
+class Loop;
+class Operation;
+class Symbol;
+class TextWriter;
+class Value;
+
+// Liveness computes which Values and Symbols are live on entry to and on exit from each Builder
+// in a ControlFlowGraph, as bit vectors indexed by ValueID (sized by Compilation::maxValueID())
+// and by a dense index this analysis gives each Symbol that operations read or write (see
+// Operation::readSymbol() and writtenSymbol()). An operation's results and written Symbols are
+// killed and its operands and read Symbols become live, walking each Builder backwards.
+//
+// Operations that branch (e.g. IfCmp) or enter bound Builders (e.g. ForLoopUp) add what is live
+// into their targets at the operation itself, not at the end of their parent. Control that leaves
+// the end of a bound Builder without any other edge resumes after its binding operation, and the
+// binding operation's operands and Symbols stay live throughout its bound Builders (a loop's final
+// value, bump and loop variable are used by the test after every iteration).
+//
+// Every point between operations has a register pressure estimate: the number of live Values and
+// Symbols. peakPressure() reports the largest for a Builder or a whole Loop so that heuristics can
+// stop before code generation has to spill. The analysis is not updated as the IL changes.
+class Liveness {
+public:
+    Liveness(ControlFlowGraph *cfg);
+
+    ControlFlowGraph *cfg() const                    { return _cfg; }
+
+    int32_t numSymbols() const                       { return _symbols.size(); }
+    Symbol *symbol(int32_t index) const              { return _symbols[index]; }
+    int32_t symbolIndex(Symbol *sym) const;          // -1 if no operation reads or writes sym
+
+    const BitVector & liveInValues(Builder *b) const;
+    const BitVector & liveOutValues(Builder *b) const;
+    const BitVector & liveInSymbols(Builder *b) const;
+    const BitVector & liveOutSymbols(Builder *b) const;
+
+    bool isLiveIn(Builder *b, Value *v) const;
+    bool isLiveOut(Builder *b, Value *v) const;
+    bool isLiveIn(Builder *b, Symbol *sym) const;
+    bool isLiveOut(Builder *b, Symbol *sym) const;
+
+    // most Values and Symbols live at once in b, or in any Builder of loop
+    int32_t peakPressure(Builder *b) const;
+    int32_t peakPressure(Loop *loop) const;
+
+    void write(TextWriter & w) const;
+
+protected:
+    struct LiveSet {
+        LiveSet(size_t numValues=0, size_t numSymbols=0)
+            : _values(numValues)
+            , _symbols(numSymbols) {
+        }
+        bool unionWith(const LiveSet & other) {
+            bool changed = _values.unionWith(other._values);
+            return _symbols.unionWith(other._symbols) || changed;
+        }
+        bool operator!=(const LiveSet & other) const { return _values != other._values || _symbols != other._symbols; }
+        int32_t count() const { return _values.count() + _symbols.count(); }
+
+        BitVector _values;
+        BitVector _symbols;
+    };
+
+    void prepare();
+    bool transfer(Builder *b);
+    void addUses(Operation *op, LiveSet & live);
+    void removeDefinitions(Operation *op, LiveSet & live);
+    bool isInGraph(Builder *b) const;
+
+    ControlFlowGraph *_cfg;
+    size_t _numValues;
+    SymbolVector _symbols;
+    std::map<Symbol *,int32_t> _symbolIndices;
+
+    std::vector<LiveSet> _liveIn;                       // indexed by BuilderID
+    std::vector<LiveSet> _liveOut;                      // indexed by BuilderID
+    std::vector<int32_t> _peaks;                        // indexed by BuilderID
+    std::vector<BuilderVector> _endSuccessors;          // indexed by BuilderID: successors reached from the end
+    std::vector<bool> _returnsToParent;                 // indexed by BuilderID
+    std::map<Operation *,BuilderVector> _entered;       // Builders each operation branches to or enters
+    std::map<Operation *,LiveSet> _liveAfter;           // for operations with Builders
+    LiveSet _empty;
+};
+
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(LIVENESS_INCL)
+
@@ -0,0 +1,177 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <algorithm>
+#include "Builder.hpp"
+#include "ControlFlowGraph.hpp"
+#include "DominatorTree.hpp"
+#include "LoopNest.hpp"
+#include "Operation.hpp"
+#include "TextWriter.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+bool
+Loop::contains(Builder *b) const {
+    return b->id() < _contains.size() && _contains[b->id()];
+}
+
+LoopNest::LoopNest(ControlFlowGraph *cfg, DominatorTree *dominators)
+    : _cfg(cfg)
+    , _dominators(dominators)
+    , _irreducible(false) {
+    compute();
+}
+
+LoopNest::~LoopNest() {
+    for (auto it = _loops.begin(); it != _loops.end(); it++)
+        delete *it;
+}
+
+void
+LoopNest::compute() {
+    const BuilderVector & rpo = _cfg->reversePostOrder();
+    BuilderID size = _cfg->size();
+    _innermostLoop.assign(size, NULL);
+
+    // headers are visited in reverse postorder, so enclosing loops are found before the loops they contain
+    for (auto it = rpo.begin(); it != rpo.end(); it++) {
+        Builder *header = *it;
+        Loop *loop = NULL;
+
+        const BuilderVector & preds = _cfg->predecessors(header);
+        for (auto pIt = preds.begin(); pIt != preds.end(); pIt++) {
+            Builder *pred = *pIt;
+            if (!_dominators->isReachable(pred))
+                continue;
+
+            if (_dominators->dominates(header, pred)) {
+                if (loop == NULL)
+                    loop = new Loop(header);
+                if (std::find(loop->_latches.begin(), loop->_latches.end(), pred) == loop->_latches.end())
+                    loop->_latches.push_back(pred);
+            }
+            else if (_cfg->rpoNumber(pred) >= _cfg->rpoNumber(header)) {
+                _irreducible = true; // retreating edge into a Builder that does not dominate its source
+            }
+        }
+
+        if (loop == NULL)
+            continue;
+
+        // the loop is every Builder that reaches a latch backwards without passing the header
+        loop->_contains.assign(size, false);
+        loop->_contains[header->id()] = true;
+        loop->_builders.push_back(header);
+        BuilderVector worklist(loop->_latches);
+        while (!worklist.empty()) {
+            Builder *b = worklist.back();
+            worklist.pop_back();
+            if (loop->_contains[b->id()])
+                continue;
+            loop->_contains[b->id()] = true;
+            loop->_builders.push_back(b);
+
+            const BuilderVector & bPreds = _cfg->predecessors(b);
+            for (auto pIt = bPreds.begin(); pIt != bPreds.end(); pIt++) {
+                if (_dominators->isReachable(*pIt))
+                    worklist.push_back(*pIt);
+            }
+        }
+
+        // control that leaves the end of a bound Builder resumes in its parent, which the graph has no
+        // edge for, so builders bound to operations in the loop (e.g. nested loops) are also in it
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (auto rIt = rpo.begin(); rIt != rpo.end(); rIt++) {
+                Builder *b = *rIt;
+                if (loop->_contains[b->id()] || !b->isBound())
+                    continue;
+                Builder *parent = b->boundToOperation()->parent();
+                if (parent != NULL && loop->contains(parent)) {
+                    loop->_contains[b->id()] = true;
+                    loop->_builders.push_back(b);
+                    changed = true;
+                }
+            }
+        }
+
+        // the innermost loop found so far that contains the header encloses this one
+        for (auto lIt = _loops.rbegin(); lIt != _loops.rend(); lIt++) {
+            Loop *outer = *lIt;
+            if (outer->contains(header)) {
+                loop->_parent = outer;
+                outer->_children.push_back(loop);
+                break;
+            }
+        }
+        if (loop->_parent != NULL)
+            loop->_depth = loop->_parent->_depth + 1;
+        else {
+            loop->_depth = 1;
+            _outermostLoops.push_back(loop);
+        }
+
+        for (auto bIt = loop->_builders.begin(); bIt != loop->_builders.end(); bIt++)
+            _innermostLoop[(*bIt)->id()] = loop;
+        _loops.push_back(loop);
+    }
+}
+
+Loop *
+LoopNest::loopFor(Builder *b) const {
+    if (b->id() >= _innermostLoop.size())
+        return NULL;
+    return _innermostLoop[b->id()];
+}
+
+int32_t
+LoopNest::loopDepth(Builder *b) const {
+    Loop *loop = loopFor(b);
+    return (loop != NULL) ? loop->depth() : 0;
+}
+
+void
+LoopNest::write(TextWriter & w) const {
+    w.indent() << "[ LoopNest";
+    if (_irreducible)
+        w << " irreducible";
+    w << w.endl();
+    w.indentIn();
+    for (auto it = _loops.begin(); it != _loops.end(); it++) {
+        Loop *loop = *it;
+        w.indent() << "[ Loop header " << loop->header() << " depth " << loop->depth() << " latches";
+        for (auto lIt = loop->latches().begin(); lIt != loop->latches().end(); lIt++)
+            w << " " << *lIt;
+        w << " builders";
+        for (auto bIt = loop->builders().begin(); bIt != loop->builders().end(); bIt++)
+            w << " " << *bIt;
+        w << " ]" << w.endl();
+    }
+    w.indentOut();
+    w.indent() << "]" << w.endl();
+}
+
+} // namespace JitBuilder
+} // namespace OMR
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef LOOPNEST_INCL
+#define LOOPNEST_INCL
+
+#include <stdint.h>
+#include <vector>
+#include "typedefs.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class ControlFlowGraph;
+class DominatorTree;
+class TextWriter;
+
+// A natural loop: a header Builder that dominates the sources of the back edges into it (its
+// latches), every Builder that can reach a latch without going through the header, and the
+// Builders bound to operations in any of those (control returns from them into the loop).
+class Loop {
+    friend class LoopNest;
+
+public:
+    Builder *header() const                        { return _header; }
+    const BuilderVector & latches() const          { return _latches; }
+
+    // every Builder in the loop, including those in nested loops; the header is first
+    const BuilderVector & builders() const         { return _builders; }
+    bool contains(Builder *b) const;
+
+    // innermost enclosing loop, or NULL for an outermost loop
+    Loop *parent() const                           { return _parent; }
+    const std::vector<Loop *> & children() const   { return _children; }
+
+    // 1 for an outermost loop
+    int32_t depth() const                          { return _depth; }
+
+protected:
+    Loop(Builder *header)
+        : _header(header)
+        , _parent(NULL)
+        , _depth(0) {
+    }
+
+    Builder *_header;
+    BuilderVector _latches;
+    BuilderVector _builders;
+    std::vector<bool> _contains;    // indexed by BuilderID
+    Loop *_parent;
+    std::vector<Loop *> _children;
+    int32_t _depth;
+};
+
+// LoopNest finds the natural loops of a ControlFlowGraph and how they nest. A ForLoopUp is a
+// loop whose header is its loopBody and whose latch is its loopContinue; Goto and IfCmp
+// operations that branch back to a Builder dominating them (as bytecode translators produce for
+// loops) form loops too. A retreating edge whose target does not dominate its source makes the
+// graph irreducible: it does not form a loop, but hasIrreducibleControlFlow() reports it so
+// heuristics can be conservative. Like DominatorTree, the nest is not updated if the graph changes.
+class LoopNest {
+public:
+    LoopNest(ControlFlowGraph *cfg, DominatorTree *dominators);
+    ~LoopNest();
+
+    ControlFlowGraph *cfg() const                  { return _cfg; }
+    DominatorTree *dominators() const              { return _dominators; }
+
+    // all loops, each after every loop enclosing it
+    int32_t numLoops() const                       { return _loops.size(); }
+    Loop *loop(int32_t i) const                    { return _loops[i]; }
+    const std::vector<Loop *> & outermostLoops() const { return _outermostLoops; }
+
+    // innermost loop containing b, or NULL if b is not in a loop
+    Loop *loopFor(Builder *b) const;
+
+    // number of loops containing b
+    int32_t loopDepth(Builder *b) const;
+
+    bool hasIrreducibleControlFlow() const         { return _irreducible; }
+
+    void write(TextWriter & w) const;
+
+protected:
+    void compute();
+
+    ControlFlowGraph *_cfg;
+    DominatorTree *_dominators;
+    std::vector<Loop *> _loops;
+    std::vector<Loop *> _outermostLoops;
+    std::vector<Loop *> _innermostLoop;     // indexed by BuilderID
+    bool _irreducible;
+};
+
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(LOOPNEST_INCL)
+
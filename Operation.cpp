@@ -51,7 +51,8 @@ Operation::Operation(LOCATION, ActionID a, Extension *ext, Builder * parent)
     , _action(a)
     , _name(ext->actionName(a))
     , _location(parent->location())
-    , _creationLocation(PASSLOC) {
+    , _creationLocation(PASSLOC)
+    , _takenProbability(UnknownProbability) {
 
     } 
 
@@ -77,6 +78,21 @@ Operation::registerDefinition(Value *result) {
     result->addDefinition(this);
 }
 
+void
+Operation::unregisterDefinitions() {
+    for (int32_t r=0;r < numResults();r++)
+        result(r)->removeDefinition(this);
+}
+
+void
+Operation::controlFlowEdges(ControlFlowEdgeVector & edges) const {
+    for (int32_t i=0;i < numBuilders();i++) {
+        Builder *b = builder(i);
+        if (b != NULL)
+            edges.push_back(ControlFlowEdge(parent(), b));
+    }
+}
+
 void
 Operation::writeFull(TextWriter & w) const {
     w.indent() << _parent << "!o" << _id << " : ";
@@ -158,6 +174,16 @@ OperationR1V2T1::write(TextWriter & w) const {
     w << " " << this->_left << " " << this->_right << w.endl();
 }
 
+void
+OperationR1V3::write(TextWriter & w) const {
+    w << this->_result << " = " << this->name() << " " << this->_first << " " << this->_second << " " << this->_third << w.endl();
+}
+
+void
+OperationB1R1V2::write(TextWriter & w) const {
+    w << this->_result << " = " << this->name() << " " << this->_builder << " " << this->_left << " " << this->_right << w.endl();
+}
+
 OperationR1S1VN::OperationR1S1VN(LOCATION, ActionID a, Extension *ext, Builder * parent, OperationCloner * cloner)
     : OperationR1S1(PASSLOC, a, ext, parent, cloner->result(), cloner->symbol()) {
 
@@ -30,6 +30,7 @@
 #include "IDs.hpp"
 #include "Iterator.hpp"
 #include "Mapper.hpp"
+#include "typedefs.hpp"
 
 namespace OMR {
 namespace JitBuilder {
@@ -87,23 +88,40 @@ public:
     virtual int32_t numResults() const                  { return 0; }
     virtual Value * result(int i=0) const               { return NULL; }
  
-    // Change to mayReadShadow() and mustReadShadow
+    // symbols this operation must read in their entirety
     virtual SymbolIterator ReadSymbolsBegin()           { return SymbolIterator(); }
             SymbolIterator ReadSymbolsEnd()             { return symbolEndIterator; }
     virtual int32_t numReadSymbols() const              { return 0; }
     virtual Symbol * readSymbol(int i=0) const          { return NULL; }
 
-    // Change to mayWriteShadow() and mustWriteShadow
+    // symbols this operation must write in their entirety
     virtual SymbolIterator WrittenSymbolsBegin()        { return SymbolIterator(); }
             SymbolIterator WrittenSymbolsEnd()          { return symbolEndIterator; }
     virtual int32_t numWrittenSymbols() const           { return 0; }
     virtual Symbol * writtenSymbol(int i=0) const       { return NULL; }
 
+    // symbols this operation may read or write, possibly only in part: the must sets above plus
+    // any classes of memory (like Base::AliasSymbol) the operation reaches through pointers
+    virtual int32_t numMayReadSymbols() const           { return numReadSymbols(); }
+    virtual Symbol * mayReadSymbol(int i=0) const       { return readSymbol(i); }
+    virtual int32_t numMayWriteSymbols() const          { return numWrittenSymbols(); }
+    virtual Symbol * mayWriteSymbol(int i=0) const      { return writtenSymbol(i); }
+
     virtual BuilderIterator BuildersBegin()             { return BuilderIterator(); }
             BuilderIterator &BuildersEnd()              { return builderEndIterator; }
     virtual int32_t numBuilders() const                 { return 0; }
     virtual Builder *builder(int i=0) const             { return NULL; }
 
+    // appends the control flow edges this operation creates to edges (see ControlFlowGraph)
+    // by default, control can flow from the operation's parent into each of its builders
+    virtual void controlFlowEdges(ControlFlowEdgeVector & edges) const;
+
+    // for operations that branch (like IfCmp*): the expected percentage of executions that
+    // take the branch, or UnknownProbability
+    static const int8_t UnknownProbability = -1;
+    int8_t takenProbability() const                     { return _takenProbability; }
+    Operation * setTakenProbability(int8_t p)           { assert(p >= 0 && p <= 100); _takenProbability = p; return this; }
+
 #ifdef CASES_BECOME_CORE
     virtual CaseIterator CasesBegin()                   { return CaseIterator(); }
     virtual CaseIterator CasesEnd()                     { return caseEndIterator; }
@@ -132,6 +150,7 @@ protected:
     Operation * setParent(Builder * newParent);
     Operation * setLocation(Location *location);
     void registerDefinition(Value *result);
+    void unregisterDefinitions();
 
     static void addToBuilder(Extension *ext, Builder *b, Operation *op);
 
@@ -142,6 +161,7 @@ protected:
     const std::string _name;
     Location * _location;
     CreateLocation _creationLocation;
+    int8_t _takenProbability;
 
     static BuilderIterator builderEndIterator;
     static CaseIterator caseEndIterator;
@@ -500,6 +520,35 @@ protected:
     const Type * _type;
 };
 
+class OperationR1V3 : public OperationR1 {
+public:
+    virtual size_t size() const         { return sizeof(OperationR1V3); }
+    virtual int32_t numOperands() const { return 3; }
+    virtual Value * operand(int i=0) const {
+        if (i == 0) return _first;
+        if (i == 1) return _second;
+        if (i == 2) return _third;
+        return NULL;
+    }
+
+    virtual ValueIterator OperandsBegin()       { return ValueIterator(_first, _second, _third); }
+
+    virtual void write(TextWriter & w) const;
+
+protected:
+    OperationR1V3(LOCATION, ActionID a, Extension *ext, Builder * parent, Value * result, Value * first, Value * second, Value * third)
+        : OperationR1(PASSLOC, a, ext, parent, result)
+        , _first(first)
+        , _second(second)
+        , _third(third) {
+
+    }
+
+    Value * _first;
+    Value * _second;
+    Value * _third;
+};
+
 class OperationR1S1VN : public OperationR1S1 {
 public:
     virtual size_t size() const { return sizeof(OperationR1S1VN); }
@@ -592,6 +641,29 @@ class OperationB1R0V2 : public OperationR0V2
    Builder * _builder;
    };
 
+class OperationB1R1V2 : public OperationR1V2
+   {
+   public:
+   virtual size_t size() const { return sizeof(OperationB1R1V2); }
+   virtual int32_t numBuilders() const { return 1; }
+   virtual Builder * builder(int i=0) const
+      {
+      if (i == 0) return _builder;
+      return NULL;
+      }
+   virtual BuilderIterator BuildersBegin()       { return BuilderIterator(_builder); }
+
+   virtual void write(TextWriter & w) const;
+
+   protected:
+   OperationB1R1V2(LOCATION, ActionID a, Extension *ext, Builder * parent, Value * result, Builder * b, Value * left, Value * right)
+      : OperationR1V2(PASSLOC, a, ext, parent, result, left, right)
+      , _builder(b)
+      { }
+
+   Builder * _builder;
+   };
+
 
 //
 // Core operations
@@ -105,12 +105,20 @@ OperationCloner::reset() {
 
 void
 OperationCloner::createResult(Builder *b, uint32_t i) {
-    changeResult( Value::create(b, _op->result(i)->type()) );
+    changeResult( Value::create(b, _op->result(i)->type()), i);
+}
+
+void
+OperationCloner::createResult(Builder *b, const Type *type, uint32_t i) {
+    changeResult( Value::create(b, type), i);
 }
 
 Operation *
 OperationCloner::clone(Builder *b) {
-    return _op->clone(LOC, b, this);
+    Operation *clone = _op->clone(LOC, b, this);
+    if (_op->takenProbability() != Operation::UnknownProbability)
+        clone->setTakenProbability(_op->takenProbability());
+    return clone;
 }
 
 } // namespace JitBuilder
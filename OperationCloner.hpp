@@ -88,6 +88,7 @@ public:
         if (i < _numResults) _results[i] = v;
     }
     void createResult(Builder *b, uint32_t i=0);
+    void createResult(Builder *b, const Type *type, uint32_t i=0);
 
     uint32_t numOperands() const {
         return _numOperands;
@@ -24,6 +24,7 @@
 #include "Builder.hpp"
 #include "Compilation.hpp"
 #include "Config.hpp"
+#include "ControlFlowGraph.hpp"
 #include "Operation.hpp"
 #include "TextWriter.hpp"
 #include "Transformer.hpp"
@@ -70,8 +71,9 @@ Transformer::performTransformation(Operation * op, Builder * transformed, std::s
 void
 Transformer::visitOperations(Builder *b, std::vector<bool> & visited, BuilderWorklist & worklist) {
     TextWriter * log = _comp->logger(traceEnabled());
+    ControlFlowGraph *cfg = _comp->hasCFG() ? _comp->cfg() : NULL;
 
-    for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+    for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); ) {
         Operation * op = *opIt;
 
         if (log) {
@@ -82,7 +84,10 @@ Transformer::visitOperations(Builder *b, std::vector<bool> & visited, BuilderWor
         Builder *transformation = transformOperation(op);
         if (transformation != NULL) {
             if (performTransformation(op, transformation)) {
+                if (cfg)
+                    cfg->removeOperation(op);
                 opIt = b->operations().erase(opIt); // remove the operation we just transformed
+                op->unregisterDefinitions(); // its results are now defined by the transformation
 
                 bool replaceWithBuilder=false;
                 if (false && replaceWithBuilder) {
@@ -106,18 +111,22 @@ Transformer::visitOperations(Builder *b, std::vector<bool> & visited, BuilderWor
                     for (OperationIterator it = transformation->OperationsBegin(); it != transformation->OperationsEnd(); it++) {
                         // scan transformed operations for builder objects we need to traverse
                         Operation *op = *it;
+                        if (cfg)
+                            cfg->addOperation(op);
                         for (BuilderIterator bIt = op->BuildersBegin(); bIt != op->BuildersEnd(); bIt++) {
                             Builder *inner_b = *bIt;
-                            if (inner_b && !visited[inner_b->id()])
+                            if (inner_b && (inner_b->id() >= visited.size() || !visited[inner_b->id()]))
                                 worklist.push_front(inner_b);
                         }
                         opIt++; // skip over inserted operations
                     }
-                    opIt--; // compensate for increment on loop back edge
                 }
 
                 // operation has changed, but any internal builders will be found by iterating
                 // over the transformed operations we just inserted
+                // opIt already refers to the operation following the transformation (which
+                // may have been empty, so there may be no inserted operation to step back to)
+                continue;
             }
         }
         else {
@@ -127,6 +136,8 @@ Transformer::visitOperations(Builder *b, std::vector<bool> & visited, BuilderWor
                     worklist.push_front(inner_b);
             }
         }
+
+        opIt++;
     }
 }
 
@@ -144,6 +144,12 @@ BytecodeBuilder::writeProperties(TextWriter & w) const {
     }
 }
 
+void
+BytecodeBuilder::controlFlowEdges(ControlFlowEdgeVector & edges) const {
+    if (_controlReachesEnd && _fallThroughBuilder)
+        edges.push_back(ControlFlowEdge(const_cast<BytecodeBuilder *>(this), _fallThroughBuilder));
+}
+
 void
 BytecodeBuilder::jbgen(JB1MethodBuilder *j1mb) const {
     j1mb->createBytecodeBuilder(this, bcIndex(), name());
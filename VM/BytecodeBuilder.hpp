@@ -40,11 +40,13 @@ namespace Base { class FunctionCompilation; }
 
 namespace VM {
 
+class InterpreterBuilder;
 class VirtualMachineRegister;
 class VirtualMachineState;
 class VMExtension;
 
 class BytecodeBuilder: public Builder {
+    friend InterpreterBuilder;
     friend VMExtension;
 
 public:
@@ -61,6 +63,9 @@ public:
     virtual std::string logName() const { return "BytecodeBuilder"; }
     virtual void writeProperties(TextWriter & w) const;
 
+    BytecodeBuilder * fallThroughBuilder() const { return _fallThroughBuilder; }
+    virtual void controlFlowEdges(ControlFlowEdgeVector & edges) const;
+
     virtual void jbgen(JB1MethodBuilder *j1mb) const;
     virtual void jbgenSuccessors(JB1MethodBuilder *j1mb) const;
 
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <assert.h>
+#include <vector>
+#include "Base/BaseExtension.hpp"
+#include "Base/BaseTypes.hpp"
+#include "Base/FunctionCompilation.hpp"
+#include "BytecodeBuilder.hpp"
+#include "InterpreterBuilder.hpp"
+#include "Value.hpp"
+#include "VirtualMachineRegister.hpp"
+#include "VirtualMachineState.hpp"
+#include "VMExtension.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace VM {
+
+InterpreterBuilder::InterpreterBuilder(LOCATION,
+                                       VMExtension *vme,
+                                       Base::FunctionCompilation *comp,
+                                       VirtualMachineState *state,
+                                       VirtualMachineRegister *pc)
+    : _vme(vme)
+    , _comp(comp)
+    , _state(state)
+    , _pc(pc)
+    , _nextBCIndex(0)
+    , _dispatched(false) {
+
+    // handlers do not correspond to bytecode indices, so each builder just gets its own index
+    _unknownOpcodeHandler = _vme->OrphanBytecodeBuilder(comp, _nextBCIndex++, 1, "unknownOpcode");
+    _unknownOpcodeHandler->propagateVMState(PASSLOC, _state);
+}
+
+BytecodeBuilder *
+InterpreterBuilder::DefineHandler(LOCATION, int32_t opcode, int32_t bcLength, std::string name) {
+    assert(!_dispatched); // every dispatch must be able to reach every handler
+    assert(_handlers.find(opcode) == _handlers.end());
+
+    if (name.length() == 0)
+        name = std::string("opcode").append(std::to_string(opcode));
+    BytecodeBuilder *handler = _vme->OrphanBytecodeBuilder(_comp, _nextBCIndex++, bcLength, name);
+    handler->propagateVMState(PASSLOC, _state);
+    _handlers[opcode] = handler;
+    return handler;
+}
+
+BytecodeBuilder *
+InterpreterBuilder::handler(int32_t opcode) const {
+    auto found = _handlers.find(opcode);
+    if (found == _handlers.end())
+        return NULL;
+    return found->second;
+}
+
+void
+InterpreterBuilder::Enter(LOCATION, Builder *b) {
+    BytecodeBuilder *enter = _vme->OrphanBytecodeBuilder(_comp, _nextBCIndex++, 1, "enterInterpreter");
+    enter->setVMState(_state);
+    _vme->baseExt()->Goto(PASSLOC, b, enter);
+    Dispatch(PASSLOC, enter);
+}
+
+void
+InterpreterBuilder::Dispatch(LOCATION, BytecodeBuilder *b) {
+    _dispatched = true;
+
+    Base::BaseExtension *base = _vme->baseExt();
+    Value *opcode = base->LoadAt(PASSLOC, b, _pc->Load(PASSLOC, b));
+    if (opcode->type() != base->Int32)
+        opcode = base->ConvertTo(PASSLOC, b, base->Int32, opcode);
+
+    // all handlers start with the same state, so unlike VMExtension::Switch no merge
+    // builders are needed along these edges: each handler is directly a successor of b
+    int32_t numCases = _handlers.size();
+    std::vector<Literal *> caseValues(numCases);
+    std::vector<Builder *> caseTargets(numCases);
+    int32_t c = 0;
+    for (auto it = _handlers.begin(); it != _handlers.end(); it++, c++) {
+        caseValues[c] = base->Int32->literal(PASSLOC, _comp, it->first);
+        caseTargets[c] = it->second;
+        b->_successorBuilders.push_back(it->second);
+    }
+    b->_successorBuilders.push_back(_unknownOpcodeHandler);
+
+    base->Switch(PASSLOC, b, opcode, _unknownOpcodeHandler, numCases, caseValues.data(), caseTargets.data());
+}
+
+void
+InterpreterBuilder::DispatchNext(LOCATION, BytecodeBuilder *b) {
+    _pc->Adjust(PASSLOC, b, static_cast<size_t>(b->bcLength()));
+    Dispatch(PASSLOC, b);
+}
+
+} // namespace VM
+} // namespace JitBuilder
+} // namespace OMR
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef INTERPRETERBUILDER_INCL
+#define INTERPRETERBUILDER_INCL
+
+#include "stdint.h"
+#include <map>
+#include <string>
+#include "CreateLoc.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+
+namespace Base { class FunctionCompilation; }
+
+namespace VM {
+
+class BytecodeBuilder;
+class VirtualMachineRegister;
+class VirtualMachineState;
+class VMExtension;
+
+/**
+ * @brief builds an interpreter for a bytecode set as a single function with direct threaded dispatch
+ *
+ * A handler BytecodeBuilder is defined for each opcode with DefineHandler(), and the client then
+ * appends the handler's IL to it. A handler that continues with the next bytecode ends with
+ * DispatchNext(), which advances the pc register past the current bytecode, loads the next opcode
+ * and jumps directly to its handler. Each handler therefore ends with its own dispatch (there is
+ * no central dispatch loop), which is a Switch over the defined opcodes: as for any Switch (see
+ * Base::Op_Switch::dispatch()), it becomes a jump table when the opcodes are dense enough, and bit
+ * tests or a binary search over the opcodes otherwise.
+ *
+ * Every handler starts with the same VirtualMachineState: the interpreter's registers (typically
+ * VirtualMachineRegisters like the pc) each live in one local variable for the whole function, so
+ * they stay in machine registers across handlers. No merging is needed along dispatch edges, and
+ * the state only needs to be committed by handlers that leave the interpreter (e.g. by returning).
+ *
+ * All handlers must be defined before any dispatch is appended. Opcodes with no handler, and any
+ * opcode value that is not defined, go to unknownOpcodeHandler(), which the client should also fill.
+ */
+class InterpreterBuilder {
+public:
+    /**
+     * @brief create an interpreter over the given state
+     * @param comp the compilation for the function being built
+     * @param state the virtual machine state at the start of every handler
+     * @param pc the register pointing at the opcode of the bytecode being interpreted, part of state
+     */
+    InterpreterBuilder(LOCATION, VMExtension *vme, Base::FunctionCompilation *comp, VirtualMachineState *state, VirtualMachineRegister *pc);
+
+    BytecodeBuilder * DefineHandler(LOCATION, int32_t opcode, int32_t bcLength=1, std::string name="");
+    BytecodeBuilder * handler(int32_t opcode) const;
+    BytecodeBuilder * unknownOpcodeHandler() const { return _unknownOpcodeHandler; }
+    int32_t numHandlers() const { return _handlers.size(); }
+
+    // enters the interpreter from b (e.g. the function's entry) at the bytecode pc points at
+    void Enter(LOCATION, Builder *b);
+
+    // ends b with a dispatch to the handler of the opcode pc points at
+    void Dispatch(LOCATION, BytecodeBuilder *b);
+
+    // ends the handler b by advancing pc past its bytecode then dispatching to the next handler
+    void DispatchNext(LOCATION, BytecodeBuilder *b);
+
+protected:
+    VMExtension *_vme;
+    Base::FunctionCompilation *_comp;
+    VirtualMachineState *_state;
+    VirtualMachineRegister *_pc;
+    std::map<int32_t,BytecodeBuilder *> _handlers;
+    BytecodeBuilder *_unknownOpcodeHandler;
+    int32_t _nextBCIndex;
+    bool _dispatched;
+};
+
+} // namespace VM
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(INTERPRETERBUILDER_INCL)
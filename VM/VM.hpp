@@ -23,6 +23,7 @@
 #define OMR_JITBUILDER_VM_INCL
 
 #include "VM/BytecodeBuilder.hpp"
+#include "VM/InterpreterBuilder.hpp"
 #include "VM/VirtualMachineOperandStack.hpp"
 #include "VM/VirtualMachineRegister.hpp"
 #include "VM/VirtualMachineRegisterInStruct.hpp"
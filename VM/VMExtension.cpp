@@ -19,6 +19,7 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <vector>
 #include "Base/BaseExtension.hpp"
 #include "Base/FunctionCompilation.hpp"
 #include "BytecodeBuilder.hpp"
@@ -55,6 +56,12 @@ VMExtension::VMExtension(Compiler *compiler, bool extended, std::string extensio
 VMExtension::~VMExtension() {
 }
 
+// control that reaches the end of b continues in target (which need not follow b)
+void
+VMExtension::FallThrough(LOCATION, BytecodeBuilder *b, BytecodeBuilder *target) {
+    b->AddFallThroughBuilder(PASSLOC, target);
+}
+
 void
 VMExtension::Goto(LOCATION, BytecodeBuilder *b, BytecodeBuilder *target) {
     target = b->AddSuccessorBuilder(PASSLOC, target);
@@ -133,6 +140,33 @@ VMExtension::IfCmpUnsignedGreaterThan(LOCATION, BytecodeBuilder *b, BytecodeBuil
     baseExt()->IfCmpUnsignedGreaterThan(PASSLOC, b, target, left, right);
 }
 
+Value *
+VMExtension::AddWithOverflow(LOCATION, BytecodeBuilder *b, BytecodeBuilder *overflowTarget, Value *left, Value *right) {
+    overflowTarget = b->AddSuccessorBuilder(PASSLOC, overflowTarget);
+    return baseExt()->AddWithOverflow(PASSLOC, b, overflowTarget, left, right);
+}
+
+Value *
+VMExtension::MulWithOverflow(LOCATION, BytecodeBuilder *b, BytecodeBuilder *overflowTarget, Value *left, Value *right) {
+    overflowTarget = b->AddSuccessorBuilder(PASSLOC, overflowTarget);
+    return baseExt()->MulWithOverflow(PASSLOC, b, overflowTarget, left, right);
+}
+
+Value *
+VMExtension::SubWithOverflow(LOCATION, BytecodeBuilder *b, BytecodeBuilder *overflowTarget, Value *left, Value *right) {
+    overflowTarget = b->AddSuccessorBuilder(PASSLOC, overflowTarget);
+    return baseExt()->SubWithOverflow(PASSLOC, b, overflowTarget, left, right);
+}
+
+void
+VMExtension::Switch(LOCATION, BytecodeBuilder *b, Value *selector, BytecodeBuilder *defaultTarget, int32_t numCases, Literal **caseValues, BytecodeBuilder **caseTargets) {
+    defaultTarget = b->AddSuccessorBuilder(PASSLOC, defaultTarget);
+    std::vector<Builder *> targets(numCases);
+    for (int32_t c=0;c < numCases;c++)
+        targets[c] = b->AddSuccessorBuilder(PASSLOC, caseTargets[c]);
+    baseExt()->Switch(PASSLOC, b, selector, defaultTarget, numCases, caseValues, targets.data());
+}
+
 BytecodeBuilder *
 VMExtension::OrphanBytecodeBuilder(Base::FunctionCompilation *comp, int32_t bcIndex, int32_t bcLength, std::string name, Context *context) {
     return new BytecodeBuilder(comp, this, bcIndex, bcLength, name, context);
@@ -36,6 +36,7 @@ namespace JitBuilder {
 
 class Compilation;
 class Context;
+class Literal;
 class Location;
 class Value;
 
@@ -79,6 +80,7 @@ public:
     //
 
     // Pseudo operations
+    void FallThrough(LOCATION, BytecodeBuilder *b, BytecodeBuilder *target);
     void Goto(LOCATION, BytecodeBuilder *b, BytecodeBuilder *target);
     void IfCmpEqual(LOCATION, BytecodeBuilder *b, BytecodeBuilder *target, Value *left, Value *right);
     void IfCmpEqualZero(LOCATION, BytecodeBuilder *b, BytecodeBuilder *target, Value *condition);
@@ -92,6 +94,10 @@ public:
     void IfCmpUnsignedLessThan(LOCATION, BytecodeBuilder *b, BytecodeBuilder *target, Value *left, Value *right);
     void IfCmpUnsignedGreaterOrEqual(LOCATION, BytecodeBuilder *b, BytecodeBuilder *target, Value *left, Value *right);
     void IfCmpUnsignedGreaterThan(LOCATION, BytecodeBuilder *b, BytecodeBuilder *target, Value *left, Value *right);
+    Value * AddWithOverflow(LOCATION, BytecodeBuilder *b, BytecodeBuilder *overflowTarget, Value *left, Value *right);
+    Value * MulWithOverflow(LOCATION, BytecodeBuilder *b, BytecodeBuilder *overflowTarget, Value *left, Value *right);
+    Value * SubWithOverflow(LOCATION, BytecodeBuilder *b, BytecodeBuilder *overflowTarget, Value *left, Value *right);
+    void Switch(LOCATION, BytecodeBuilder *b, Value *selector, BytecodeBuilder *defaultTarget, int32_t numCases, Literal **caseValues, BytecodeBuilder **caseTargets);
     BytecodeBuilder *OrphanBytecodeBuilder(Base::FunctionCompilation *comp, int32_t bcIndex, int32_t bcLength=1, std::string name="", Context *context=NULL);
 
 protected:
@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *******************************************************************************/
+
+
+
+#include <dlfcn.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdint.h>
+#include <errno.h>
+
+#include "JBCore.hpp"
+#include "Base/Base.hpp"
+#include "VM/VM.hpp"
+#include "FallThrough.hpp"
+
+using std::cout;
+using std::cerr;
+
+#define TOSTR(x)     #x
+#define LINETOSTR(x) TOSTR(x)
+
+#define DO_LOGGING false
+
+static void
+check(bool ok, const char *what, int32_t code) {
+    if (!ok) {
+        cout << "Failed: " << what << "\n";
+        exit(code);
+    }
+}
+
+int
+main(int argc, char *argv[]) {
+    cout << "Step 0: load jbcore.so\n";
+    void *handle = dlopen("libjbcore.so", RTLD_LAZY);
+    if (!handle) {
+        fputs(dlerror(), stderr);
+        return -1;
+    }
+
+    cout << "Step 1: create a Compiler\n";
+    Compiler c("FallThroughTest");
+
+    cout << "Step 2: load extensions (Base and VM)\n";
+    Base::BaseExtension *base = c.loadExtension<Base::BaseExtension>();
+    assert(base);
+    VM::VMExtension *vme = c.loadExtension<VM::VMExtension>();
+    assert(vme);
+
+    cout << "Step 3: Create Function object\n";
+    FallThroughFunction func(&c);
+
+    cout << "Step 4: Set up logging configuration\n";
+    Base::FunctionCompilation *comp = func.comp();
+    TextWriter logger(comp, std::cout, std::string("    "));
+    TextWriter *log = (DO_LOGGING) ? &logger : NULL;
+
+    cout << "Step 5: compile function\n";
+    CompilerReturnCode result = func.Compile(log);
+
+    if (result != c.CompileSuccessful) {
+        cout << "Compile failed: " << result << "\n";
+        exit(-1);
+    }
+
+    cout << "Step 6: check fall through edges in the control flow graph\n";
+    ControlFlowGraph cfg(comp);
+    cfg.build();
+    check(cfg.contains(func._bc1), "BC1 is in the graph", -2);
+    check(cfg.numPredecessors(func._bc1) == 1 && cfg.predecessors(func._bc1)[0] == func._bc0, "BC1 is only reached by falling through from BC0", -2);
+    check(cfg.numSuccessors(func._bc0) == 2, "BC0 branches to BC2 and falls through to BC1", -2);
+    check(cfg.numSuccessors(func._bc1) == 1, "BC1 falls through", -2);
+    Builder *merge = cfg.successors(func._bc1)[0];
+    check(merge == func._bc2 || (cfg.numSuccessors(merge) == 1 && cfg.successors(merge)[0] == func._bc2), "BC1 falls through to BC2", -2);
+    check(cfg.numPredecessors(func._bc2) == 2, "BC2 is reached from BC0 and from BC1", -2);
+
+    cout << "Step 7: check dominators\n";
+    DominatorTree dominators(&cfg);
+    check(dominators.isReachable(func._bc1), "BC1 is reachable", -3);
+    check(dominators.idom(func._bc1) == func._bc0, "BC0 immediately dominates BC1", -3);
+    check(dominators.idom(func._bc2) == func._bc0, "BC0 immediately dominates BC2", -3);
+    check(!dominators.dominates(func._bc1, func._bc2), "BC1 does not dominate BC2", -3);
+
+    cout << "Step 8: run function\n";
+    typedef int32_t (FallThroughMethodFunction)(int32_t);
+    FallThroughMethodFunction *f = func.nativeEntry<FallThroughMethodFunction *>();
+    int32_t retVal = f(0);
+    cout << "f(0) returned " << retVal << ", correct return value is 0\n";
+    check(retVal == 0, "f(0) branches to BC2", -4);
+    retVal = f(5);
+    cout << "f(5) returned " << retVal << ", correct return value is 6\n";
+    check(retVal == 6, "f(5) falls through BC1", -4);
+
+    cout << "Step 9: compile with LocalForwarding, which must not forward BC0's r into BC2\n";
+    FallThroughFunction forwarded(&c);
+    Strategy *strategy = new Strategy(&c, "LocalForwarding");
+    strategy->addPass(new Base::LocalForwarding(&c))
+            ->addPass(new JB1CodeGenerator(&c));
+    result = forwarded.Compile(log, strategy->id());
+    check(result == c.CompileSuccessful, "compiled with LocalForwarding", -5);
+    bool loadsR = false;
+    for (OperationIterator opIt = forwarded._bc2->OperationsBegin(); opIt != forwarded._bc2->OperationsEnd(); opIt++) {
+        if ((*opIt)->action() == base->aLoad)
+            loadsR = true;
+    }
+    check(loadsR, "BC2 still loads r", -5);
+    f = forwarded.nativeEntry<FallThroughMethodFunction *>();
+    retVal = f(0);
+    cout << "f(0) returned " << retVal << ", correct return value is 0\n";
+    check(retVal == 0, "forwarded f(0) branches to BC2", -5);
+    retVal = f(5);
+    cout << "f(5) returned " << retVal << ", correct return value is 6\n";
+    check(retVal == 6, "forwarded f(5) falls through BC1", -5);
+
+    cout << "Step 10: allow Compiler object to die (shuts down JIT because it's the last Compiler)\n";
+}
+
+
+FallThroughFunction::FallThroughFunction(Compiler *compiler)
+    : Base::Function(compiler)
+    , _base(compiler->lookupExtension<Base::BaseExtension>())
+    , _vme(compiler->lookupExtension<VM::VMExtension>()) {
+
+    DefineLine(LINETOSTR(__LINE__));
+    DefineFile(__FILE__);
+
+    DefineName("fallThrough");
+    _x = DefineParameter("x", _base->Int32);
+    DefineReturnType(_base->Int32);
+}
+
+bool
+FallThroughFunction::buildIL() {
+    Builder *entry = builderEntry();
+    _r = DefineLocal("r", _base->Int32);
+
+    _bc0 = _vme->OrphanBytecodeBuilder(comp(), 0, 1, "BC0");
+    _bc0->setVMState(new VM::VirtualMachineState(LOC, _vme, VM::VirtualMachineState::STATEKIND));
+    _base->Goto(LOC, entry, _bc0);
+    _bc1 = _vme->OrphanBytecodeBuilder(comp(), 1, 1, "BC1");
+    _bc2 = _vme->OrphanBytecodeBuilder(comp(), 2, 1, "BC2");
+
+    _base->Store(LOC, _bc0, _r, _base->ConstInt32(LOC, _bc0, 0));
+    _vme->IfCmpEqualZero(LOC, _bc0, _bc2, _base->Load(LOC, _bc0, _x));
+    _vme->FallThrough(LOC, _bc0, _bc1);
+
+    _base->Store(LOC, _bc1, _r, _base->Add(LOC, _bc1, _base->Load(LOC, _bc1, _x), _base->ConstInt32(LOC, _bc1, 1)));
+    _vme->FallThrough(LOC, _bc1, _bc2);
+
+    _base->Return(LOC, _bc2, _base->Load(LOC, _bc2, _r));
+
+    return true;
+}
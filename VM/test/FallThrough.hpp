@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *******************************************************************************/
+
+
+
+#ifndef FALLTHROUGH_INCL
+#define FALLTHROUGH_INCL
+
+#include "Base/Function.hpp"
+
+namespace OMR {
+    namespace JitBuilder {
+
+        class Compiler;
+
+        namespace Base {
+            class BaseExtension;
+            class LocalSymbol;
+            class ParameterSymbol;
+        }
+
+        namespace VM {
+            class BytecodeBuilder;
+            class VMExtension;
+        }
+    }
+}
+
+using namespace OMR::JitBuilder;
+
+// three bytecodes: BC0 sets r to 0 and, if x is zero, branches to BC2, otherwise falls through to
+// BC1, which sets r to x+1 and falls through to BC2, which returns r
+class FallThroughFunction : public Base::Function {
+public:
+    FallThroughFunction(Compiler *compiler);
+    virtual bool buildIL();
+
+    VM::BytecodeBuilder *_bc0;
+    VM::BytecodeBuilder *_bc1;
+    VM::BytecodeBuilder *_bc2;
+
+protected:
+    Base::BaseExtension *_base;
+    VM::VMExtension *_vme;
+
+    Base::ParameterSymbol *_x;
+    Base::LocalSymbol *_r;
+};
+
+#endif // !defined(FALLTHROUGH_INCL)
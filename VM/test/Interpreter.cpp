@@ -0,0 +1,176 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *******************************************************************************/
+
+
+#include <dlfcn.h>
+#include <iostream>
+#include <stdlib.h>
+#include <stdint.h>
+#include <errno.h>
+
+#include "JBCore.hpp"
+#include "Base/Base.hpp"
+#include "VM/VM.hpp"
+#include "Interpreter.hpp"
+
+using std::cout;
+using std::cerr;
+
+#define TOSTR(x)     #x
+#define LINETOSTR(x) TOSTR(x)
+
+#define DO_LOGGING true
+
+int
+main(int argc, char *argv[]) {
+    cout << "Step 0: load jbcore.so\n";
+    void *handle = dlopen("libjbcore.so", RTLD_LAZY);
+    if (!handle) {
+        fputs(dlerror(), stderr);
+        return -1;
+    }
+
+    cout << "Step 1: create a Compiler\n";
+    Compiler c("InterpreterTest");
+
+    cout << "Step 2: load extensions (Base and VM)\n";
+    Base::BaseExtension *base = c.loadExtension<Base::BaseExtension>();
+    assert(base);
+    VM::VMExtension *vme = c.loadExtension<VM::VMExtension>();
+    assert(vme);
+
+    cout << "Step 3: Create Function object\n";
+    InterpreterFunction interpFunc(&c);
+
+    cout << "Step 4: Set up logging configuration\n";
+    Base::FunctionCompilation *comp = interpFunc.comp();
+    TextWriter logger(comp, std::cout, std::string("    "));
+    TextWriter *log = (DO_LOGGING) ? &logger : NULL;
+
+    cout << "Step 5: compile interpreter function\n";
+    CompilerReturnCode result = interpFunc.Compile(log);
+
+    if (result != c.CompileSuccessful) {
+        cout << "Compile failed: " << result << "\n";
+        exit(-1);
+    }
+
+    cout << "Step 6: interpret straight line bytecodes\n";
+    typedef int32_t (InterpreterMethodFunction)(int8_t **pc);
+    InterpreterMethodFunction *interpret = interpFunc.nativeEntry<InterpreterMethodFunction *>();
+
+    int8_t straightLine[] = { ACC_ADD, 5, ACC_DOUBLE, ACC_SUB, 3, ACC_HALT };
+    int8_t *pc = straightLine;
+    int32_t retVal = interpret(&pc);
+    cout << "interpret(straightLine) returned " << retVal << ", correct return value is 7\n";
+    if (retVal != 7 || pc != straightLine + 5) {
+        cout << "Interpreter returned wrong value or left pc at the wrong bytecode\n";
+        exit(-2);
+    }
+
+    cout << "Step 7: interpret a loop\n";
+    int8_t loop[] = { ACC_ADD, 3, ACC_SUB, 1, ACC_JNZ, -2, ACC_ADD, 42, ACC_HALT };
+    pc = loop;
+    retVal = interpret(&pc);
+    cout << "interpret(loop) returned " << retVal << ", correct return value is 42\n";
+    if (retVal != 42 || pc != loop + 8) {
+        cout << "Interpreter returned wrong value or left pc at the wrong bytecode\n";
+        exit(-3);
+    }
+
+    cout << "Step 8: interpret an unknown opcode\n";
+    int8_t unknown[] = { ACC_ADD, 1, 99, ACC_HALT };
+    pc = unknown;
+    retVal = interpret(&pc);
+    cout << "interpret(unknown) returned " << retVal << ", correct return value is -1\n";
+    if (retVal != -1 || pc != unknown + 2) {
+        cout << "Interpreter returned wrong value or left pc at the wrong bytecode\n";
+        exit(-4);
+    }
+
+    cout << "Step 9: allow Compiler object to die (shuts down JIT because it's the last Compiler)\n";
+}
+
+
+InterpreterFunction::InterpreterFunction(Compiler *compiler)
+    : Base::Function(compiler)
+    , _base(compiler->lookupExtension<Base::BaseExtension>())
+    , _vme(compiler->lookupExtension<VM::VMExtension>()) {
+
+    DefineLine(LINETOSTR(__LINE__));
+    DefineFile(__FILE__);
+
+    DefineName("interpret");
+    _pc = DefineParameter("pcPtr", _base->PointerTo(LOC, comp(), _base->PointerTo(LOC, comp(), _base->Int8)));
+    DefineReturnType(_base->Int32);
+}
+
+bool
+InterpreterFunction::buildIL() {
+    Builder *entry = builderEntry();
+    VM::VirtualMachineRegister *pc = new VM::VirtualMachineRegister(LOC, _vme, "PC", this, _base->Load(LOC, entry, _pc));
+
+    _acc = DefineLocal("acc", _base->Int32);
+    _base->Store(LOC, entry, _acc, _base->ConstInt32(LOC, entry, 0));
+
+    VM::InterpreterBuilder interp(LOC, _vme, comp(), pc, pc);
+    VM::BytecodeBuilder *halt = interp.DefineHandler(LOC, ACC_HALT, 1, "HALT");
+    VM::BytecodeBuilder *add = interp.DefineHandler(LOC, ACC_ADD, 2, "ADD");
+    VM::BytecodeBuilder *sub = interp.DefineHandler(LOC, ACC_SUB, 2, "SUB");
+    VM::BytecodeBuilder *dbl = interp.DefineHandler(LOC, ACC_DOUBLE, 1, "DOUBLE");
+    VM::BytecodeBuilder *jnz = interp.DefineHandler(LOC, ACC_JNZ, 2, "JNZ");
+
+    pc->Commit(LOC, halt);
+    _base->Return(LOC, halt, _base->Load(LOC, halt, _acc));
+
+    VM::BytecodeBuilder *unknown = interp.unknownOpcodeHandler();
+    pc->Commit(LOC, unknown);
+    _base->Return(LOC, unknown, _base->ConstInt32(LOC, unknown, -1));
+
+    Value *one = _base->ConvertTo(LOC, add, _base->Word, _base->ConstInt32(LOC, add, 1));
+    Value *operand = _base->LoadAt(LOC, add, _base->IndexAt(LOC, add, pc->Load(LOC, add), one));
+    Value *acc = _base->Load(LOC, add, _acc);
+    _base->Store(LOC, add, _acc, _base->Add(LOC, add, acc, _base->ConvertTo(LOC, add, _base->Int32, operand)));
+    interp.DispatchNext(LOC, add);
+
+    one = _base->ConvertTo(LOC, sub, _base->Word, _base->ConstInt32(LOC, sub, 1));
+    operand = _base->LoadAt(LOC, sub, _base->IndexAt(LOC, sub, pc->Load(LOC, sub), one));
+    acc = _base->Load(LOC, sub, _acc);
+    _base->Store(LOC, sub, _acc, _base->Sub(LOC, sub, acc, _base->ConvertTo(LOC, sub, _base->Int32, operand)));
+    interp.DispatchNext(LOC, sub);
+
+    acc = _base->Load(LOC, dbl, _acc);
+    _base->Store(LOC, dbl, _acc, _base->Add(LOC, dbl, acc, acc));
+    interp.DispatchNext(LOC, dbl);
+
+    VM::BytecodeBuilder *taken = _vme->OrphanBytecodeBuilder(comp(), 100, 2, "JNZ_taken");
+    _vme->IfCmpNotEqualZero(LOC, jnz, taken, _base->Load(LOC, jnz, _acc));
+    interp.DispatchNext(LOC, jnz);
+
+    one = _base->ConvertTo(LOC, taken, _base->Word, _base->ConstInt32(LOC, taken, 1));
+    operand = _base->LoadAt(LOC, taken, _base->IndexAt(LOC, taken, pc->Load(LOC, taken), one));
+    pc->Adjust(LOC, taken, _base->ConvertTo(LOC, taken, _base->Word, operand));
+    interp.Dispatch(LOC, taken);
+
+    interp.Enter(LOC, entry);
+
+    return true;
+}
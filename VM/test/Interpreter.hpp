@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *******************************************************************************/
+
+
+#ifndef INTERPRETER_INCL
+#define INTERPRETER_INCL
+
+#include "Base/Function.hpp"
+
+namespace OMR {
+    namespace JitBuilder {
+
+        class Compiler;
+
+        namespace Base {
+            class BaseExtension;
+            class LocalSymbol;
+            class ParameterSymbol;
+        }
+
+        namespace VM {
+            class VMExtension;
+        }
+    }
+}
+
+using namespace OMR::JitBuilder;
+
+// opcodes of a tiny accumulator machine; operands are single bytes following the opcode
+enum AccumulatorOpcodes {
+    ACC_HALT=0,   // return the accumulator
+    ACC_ADD=1,    // add operand to the accumulator
+    ACC_SUB=2,    // subtract operand from the accumulator
+    ACC_DOUBLE=3, // double the accumulator
+    ACC_JNZ=4     // if the accumulator isn't zero, jump by the (signed) operand relative to this bytecode
+};
+
+class InterpreterFunction : public Base::Function {
+public:
+    InterpreterFunction(Compiler *compiler);
+    virtual bool buildIL();
+
+protected:
+    Base::BaseExtension *_base;
+    VM::VMExtension *_vme;
+
+    Base::ParameterSymbol *_pc;
+    Base::LocalSymbol *_acc;
+};
+
+#endif // !defined(INTERPRETER_INCL)
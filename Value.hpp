@@ -32,6 +32,7 @@ namespace JitBuilder {
 class Builder;
 class BuilderBase;
 class Extension;
+class Operation;
 class OperationCloner;
 class Type;
 
@@ -47,12 +48,16 @@ public:
     const Builder *parent() const { return _parent; }
     const Type * type() const { return _type; }
 
+    // the operation that defines this Value, or NULL unless exactly one operation does
+    const Operation *definition() const { return (_definitions.size() == 1) ? _definitions.front() : NULL; }
+
     virtual size_t size() const { return sizeof(Value); }
 
 protected:
     static Value * create(const Builder * parent, const Type * type);
     Value(const Builder * parent, const Type * type);
     void addDefinition(const Operation *op) { _definitions.push_back(op); }
+    void removeDefinition(const Operation *op) { _definitions.remove(op); }
 
     ValueID   _id;
     const Builder * _parent;
@@ -0,0 +1,524 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <limits>
+#include <string>
+#include "Base/AliasAnalysis.hpp"
+#include "Base/BaseExtension.hpp"
+#include "Base/BaseSymbols.hpp"
+#include "Base/BaseTypes.hpp"
+#include "Base/ControlOperations.hpp"
+#include "Base/Function.hpp"
+#include "Base/FunctionCompilation.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "Literal.hpp"
+#include "LoopVectorizer.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "Value.hpp"
+#include "VectorExtension.hpp"
+#include "VectorTypes.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Vector {
+
+LoopVectorizer::LoopVectorizer(Compiler *compiler)
+    : Transformer(compiler, std::string("LoopVectorizer"))
+    , _vec(compiler->lookupExtension<VectorExtension>())
+    , _base(compiler->lookupExtension<Base::BaseExtension>()) {
+
+}
+
+void
+LoopVectorizer::visitPreCompilation(Compilation * comp) {
+    setTraceEnabled(_comp->config()->traceLoopVectorizer());
+}
+
+bool
+LoopVectorizer::isArithmetic(Operation *op) const {
+    ActionID a = op->action();
+    return a == _base->aAdd || a == _base->aSub || a == _base->aMul;
+}
+
+// every Value used as a vector must have the same number of lanes
+bool
+LoopVectorizer::useLanes(Candidate & c, const Type *elementType) {
+    const VectorType *type = _vec->VectorTypeFor(elementType);
+    if (type == NULL)
+        return false;
+    if (c._numLanes == 0)
+        c._numLanes = type->numLanes();
+    return c._numLanes == type->numLanes();
+}
+
+LoopVectorizer::Shape
+LoopVectorizer::shape(Candidate & c, Value *v) {
+    auto found = c._shapes.find(v);
+    if (found != c._shapes.end())
+        return found->second;
+    assert(_definitions.find(v) == _definitions.end());
+    return Invariant; // computed before the loop
+}
+
+LoopVectorizer::Reduction *
+LoopVectorizer::reductionFor(Candidate & c, Operation *op) {
+    for (auto it = c._reductions.begin(); it != c._reductions.end(); it++) {
+        Reduction & r = *it;
+        if (op == r._load || op == r._update || op == r._store)
+            return &r;
+    }
+    return NULL;
+}
+
+// a base loaded from a symbol in the loop body is identified by the symbol, since it is
+// loaded again (as a different Value) on every iteration
+Symbol *
+LoopVectorizer::baseKey(Value *base) {
+    auto found = _definitions.find(base);
+    if (found != _definitions.end() && found->second->action() == _base->aLoad)
+        return found->second->symbol();
+    return NULL;
+}
+
+// accesses through the same base use the same index in every iteration, so they only overlap
+// in that iteration; different bases may point into the same array unless alias analysis says not
+bool
+LoopVectorizer::mayOverlap(Value *base1, Value *base2) {
+    if (base1 == base2)
+        return false;
+    Symbol *key1 = baseKey(base1);
+    if (key1 != NULL && key1 == baseKey(base2))
+        return false;
+    Base::AliasAnalysis aliasAnalysis(_base, static_cast<Base::FunctionCompilation *>(_comp)->func());
+    return aliasAnalysis.pointersMayAlias(base1, base2);
+}
+
+// a base computed before the loop, or loaded in the body from a symbol the loop does not
+// store, can be compared with other bases before the loop runs
+bool
+LoopVectorizer::isAvailableBeforeLoop(Value *base) {
+    return _definitions.find(base) == _definitions.end() || baseKey(base) != NULL;
+}
+
+Value *
+LoopVectorizer::baseBeforeLoop(Builder *b, Value *base) {
+    Symbol *key = baseKey(base);
+    if (key != NULL)
+        return _base->Load(LOC, b, key);
+    return base;
+}
+
+// every local stored in the loop must be a reduction: sum = sum + x (or sum * x) where the
+// loaded value of sum and the updated value are used nowhere else
+bool
+LoopVectorizer::analyzeReductions(Candidate & c) {
+    Builder *body = c._loop->loopBody();
+    Base::Function *func = static_cast<Base::FunctionCompilation *>(_comp)->func();
+
+    std::map<Symbol *,Operation *> loads, stores;
+    std::map<Symbol *,int32_t> numLoads, numStores;
+    std::map<Value *,int32_t> uses;
+    std::map<Operation *,int32_t> position;
+    int32_t p = 0;
+    for (OperationIterator opIt = body->OperationsBegin(); opIt != body->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        position[op] = p++;
+        if (op->action() == _base->aLoad) {
+            loads[op->symbol()] = op;
+            numLoads[op->symbol()]++;
+        }
+        else if (op->action() == _base->aStore) {
+            stores[op->symbol()] = op;
+            numStores[op->symbol()]++;
+        }
+        for (int32_t o=0;o < op->numOperands();o++)
+            uses[op->operand(o)]++;
+    }
+
+    for (auto it = stores.begin(); it != stores.end(); it++) {
+        Symbol *sym = it->first;
+        Operation *store = it->second;
+        if (sym == c._loop->loopVariable() || numStores[sym] != 1 || numLoads[sym] != 1)
+            return false;
+
+        Operation *load = loads[sym];
+        auto def = _definitions.find(store->operand());
+        if (position[load] > position[store] || def == _definitions.end())
+            return false;
+
+        Operation *update = def->second;
+        if (update->action() != _base->aAdd && update->action() != _base->aMul)
+            return false;
+        if (update->operand(0) == update->operand(1))
+            return false;
+        if (update->operand(0) != load->result() && update->operand(1) != load->result())
+            return false;
+        if (uses[load->result()] != 1 || uses[update->result()] != 1)
+            return false;
+
+        const Type *type = sym->type();
+        if (!useLanes(c, type))
+            return false;
+        if ((type == _base->Float32 || type == _base->Float64) && !func->allowsReassociation())
+            return false;
+
+        Reduction r;
+        r._symbol = sym;
+        r._load = load;
+        r._update = update;
+        r._store = store;
+        r._accumulator = NULL;
+        c._reductions.push_back(r);
+    }
+
+    return true;
+}
+
+bool
+LoopVectorizer::analyze(Candidate & c) {
+    Base::Op_ForLoopUp *loop = c._loop;
+    Builder *body = loop->loopBody();
+    if (!body->controlReachesEnd() || body->numOperations() == 0)
+        return false;
+
+    // consecutive iterations are only consecutive elements if the bump is 1
+    bool unitBump = false;
+    Builder *parent = loop->parent();
+    for (OperationIterator opIt = parent->OperationsBegin(); opIt != parent->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        if (op->action() == _base->aConst && op->result() == loop->bumpValue())
+            unitBump = (op->literal()->getInteger() == 1);
+    }
+    if (!unitBump)
+        return false;
+
+    _definitions.clear();
+    for (OperationIterator opIt = body->OperationsBegin(); opIt != body->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        if (op->numBuilders() > 0)
+            return false;
+        for (int32_t r=0;r < op->numResults();r++)
+            _definitions[op->result(r)] = op;
+    }
+
+    c._numLanes = 0;
+    if (!analyzeReductions(c))
+        return false;
+
+    std::vector<Value *> accessBases;
+    std::vector<Value *> storeBases;
+    for (OperationIterator opIt = body->OperationsBegin(); opIt != body->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        ActionID a = op->action();
+
+        Reduction *r = reductionFor(c, op);
+        if (r != NULL) {
+            if (op == r->_update) {
+                Value *other = (op->operand(0) == r->_load->result()) ? op->operand(1) : op->operand(0);
+                Shape s = shape(c, other);
+                if (s != Lanes && s != Invariant)
+                    return false;
+            }
+            continue;
+        }
+
+        if (a == _base->aConst) {
+            c._shapes[op->result()] = Invariant;
+        }
+        else if (a == _base->aLoad) {
+            // any other symbol stored in the loop is a reduction, so this one is not written
+            c._shapes[op->result()] = (op->symbol() == loop->loopVariable()) ? Index : Invariant;
+        }
+        else if (a == _base->aIndexAt) {
+            Value *base = op->operand(0);
+            Shape baseShape = shape(c, base);
+            Shape indexShape = shape(c, op->operand(1));
+            if (baseShape == Invariant && indexShape == Invariant) {
+                c._shapes[op->result()] = Invariant;
+            }
+            else if (baseShape == Invariant && indexShape == Index) {
+                const Type *elementType = base->type()->refine<Base::PointerType>()->baseType();
+                if (!useLanes(c, elementType))
+                    return false;
+                c._shapes[op->result()] = Address;
+                c._bases[op->result()] = base;
+            }
+            else
+                return false;
+        }
+        else if (a == _base->aLoadAt) {
+            if (shape(c, op->operand()) != Address)
+                return false;
+            c._shapes[op->result()] = Lanes;
+            accessBases.push_back(c._bases[op->operand()]);
+        }
+        else if (a == _base->aStoreAt) {
+            if (shape(c, op->operand(0)) != Address)
+                return false;
+            Shape valueShape = shape(c, op->operand(1));
+            if (valueShape != Lanes && valueShape != Invariant)
+                return false;
+            accessBases.push_back(c._bases[op->operand(0)]);
+            storeBases.push_back(c._bases[op->operand(0)]);
+        }
+        else if (isArithmetic(op)) {
+            Shape left = shape(c, op->operand(0));
+            Shape right = shape(c, op->operand(1));
+            if (left == Invariant && right == Invariant)
+                c._shapes[op->result()] = Invariant;
+            else if ((left == Lanes || left == Invariant) && (right == Lanes || right == Invariant)) {
+                if (!useLanes(c, op->result()->type()))
+                    return false;
+                c._shapes[op->result()] = Lanes;
+            }
+            else
+                return false;
+        }
+        else
+            return false;
+    }
+
+    // an element stored in one iteration must not be accessed by any other iteration, which
+    // can only be checked at runtime for bases of the same type that are known before the loop
+    for (auto sIt = storeBases.begin(); sIt != storeBases.end(); sIt++) {
+        for (auto aIt = accessBases.begin(); aIt != accessBases.end(); aIt++) {
+            Value *storeBase = *sIt;
+            Value *accessBase = *aIt;
+            if (!mayOverlap(storeBase, accessBase))
+                continue;
+            if (storeBase->type() != accessBase->type() || !isAvailableBeforeLoop(storeBase) || !isAvailableBeforeLoop(accessBase))
+                return false;
+
+            std::pair<Value *,Value *> check(storeBase, accessBase);
+            bool found = false;
+            for (auto cIt = c._overlapChecks.begin(); cIt != c._overlapChecks.end(); cIt++) {
+                if (*cIt == check)
+                    found = true;
+            }
+            if (!found)
+                c._overlapChecks.push_back(check);
+        }
+    }
+
+    return c._numLanes > 1;
+}
+
+Value *
+LoopVectorizer::constant(Builder *b, const Type *type, int64_t v) {
+    if (type == _base->Int8)
+        return _base->ConstInt8(LOC, b, (int8_t) v);
+    else if (type == _base->Int16)
+        return _base->ConstInt16(LOC, b, (int16_t) v);
+    else if (type == _base->Int32)
+        return _base->ConstInt32(LOC, b, (int32_t) v);
+    assert(type == _base->Int64);
+    return _base->ConstInt64(LOC, b, v);
+}
+
+int64_t
+LoopVectorizer::minValue(const Type *type) {
+    if (type == _base->Int8)
+        return std::numeric_limits<int8_t>::min();
+    else if (type == _base->Int16)
+        return std::numeric_limits<int16_t>::min();
+    else if (type == _base->Int32)
+        return std::numeric_limits<int32_t>::min();
+    assert(type == _base->Int64);
+    return std::numeric_limits<int64_t>::min();
+}
+
+Value *
+LoopVectorizer::mapped(Value *v, std::map<Value *,Value *> & scalars) {
+    auto found = scalars.find(v);
+    if (found != scalars.end())
+        return found->second;
+    return v;
+}
+
+// returns the vector for v, broadcasting it into b if v is the same in every iteration
+Value *
+LoopVectorizer::vectorOf(Candidate & c, Builder *b, Value *v, std::map<Value *,Value *> & scalars, std::map<Value *,Value *> & vectors) {
+    auto found = vectors.find(v);
+    if (found != vectors.end())
+        return found->second;
+
+    assert(shape(c, v) == Invariant);
+    Value *vector = _vec->VectorBroadcast(LOC, b, _vec->VectorTypeFor(v->type()), mapped(v, scalars));
+    vectors[v] = vector;
+    return vector;
+}
+
+// branches to overlapTarget unless the elements base1 and base2 address over all the loop's
+// iterations are disjoint; the check is the body of a loop that runs once so that it has a
+// place (the loop's break) to branch to when the elements are disjoint
+void
+LoopVectorizer::checkOverlap(Candidate & c, Builder *b, Value *base1, Value *base2, Builder *overlapTarget) {
+    Base::Op_ForLoopUp *loop = c._loop;
+    Base::Function *func = static_cast<Base::FunctionCompilation *>(_comp)->func();
+    Base::LocalSymbol *checkVariable = func->DefineLocal("_vec_check", _base->Int32);
+    Base::ForLoopBuilder *check = _base->ForLoopUp(LOC, b, checkVariable, _base->ConstInt32(LOC, b, 0), _base->ConstInt32(LOC, b, 1), _base->ConstInt32(LOC, b, 1));
+    Builder *cb = check->loopBody();
+
+    Value *p1 = baseBeforeLoop(cb, base1);
+    Value *p2 = baseBeforeLoop(cb, base2);
+    Value *first1 = _base->IndexAt(LOC, cb, p1, loop->initialValue());
+    Value *end1 = _base->IndexAt(LOC, cb, p1, loop->finalValue());
+    Value *first2 = _base->IndexAt(LOC, cb, p2, loop->initialValue());
+    Value *end2 = _base->IndexAt(LOC, cb, p2, loop->finalValue());
+    _base->IfCmpUnsignedLessOrEqual(LOC, cb, check->loopBreak(), end1, first2);
+    _base->IfCmpUnsignedLessOrEqual(LOC, cb, check->loopBreak(), end2, first1);
+    _base->Goto(LOC, cb, overlapTarget);
+}
+
+Builder *
+LoopVectorizer::vectorize(Candidate & c) {
+    Base::Op_ForLoopUp *loop = c._loop;
+    Base::Function *func = static_cast<Base::FunctionCompilation *>(_comp)->func();
+    Base::LocalSymbol *loopVariable = loop->loopVariable();
+    const Type *type = loopVariable->type();
+    Builder *result = _base->OrphanBuilder(LOC, loop->parent());
+
+    // vectorized code is generated into b: unless accesses must be checked for overlap, that is
+    // result, otherwise it is the body of a loop that runs once and is left early on overlap
+    Builder *b = result;
+    if (c._overlapChecks.size() > 0) {
+        // if the vectorized code is skipped, the original loop must run every iteration
+        _base->Store(LOC, result, loopVariable, loop->initialValue());
+        Base::LocalSymbol *guardVariable = func->DefineLocal("_vec_guard", _base->Int32);
+        Base::ForLoopBuilder *guard = _base->ForLoopUp(LOC, result, guardVariable, _base->ConstInt32(LOC, result, 0), _base->ConstInt32(LOC, result, 1), _base->ConstInt32(LOC, result, 1));
+        b = guard->loopBody();
+        for (auto it = c._overlapChecks.begin(); it != c._overlapChecks.end(); it++)
+            checkOverlap(c, b, it->first, it->second, guard->loopBreak());
+    }
+
+    for (auto it = c._reductions.begin(); it != c._reductions.end(); it++) {
+        Reduction & r = *it;
+        const Type *type = r._symbol->type();
+        const VectorType *vectorType = _vec->VectorTypeFor(type);
+        std::string name = std::string("_vec_").append(r._symbol->name()).append(std::to_string(r._update->result()->id()));
+        r._accumulator = func->DefineLocal(name, vectorType);
+
+        Literal *identity = (r._update->action() == _base->aAdd) ? type->zero(LOC, _comp) : type->identity(LOC, _comp);
+        Value *initial = _vec->VectorBroadcast(LOC, b, vectorType, _base->Const(LOC, b, identity));
+        _base->Store(LOC, b, r._accumulator, initial);
+    }
+
+    // main loop runs while all numLanes iterations would have run in the original loop; if final is
+    // within numLanes-1 of the type's minimum value that subtraction would wrap, but then there are
+    // never numLanes iterations left to run so the main loop is skipped
+    Value *lastLane = constant(b, type, c._numLanes-1);
+    Value *wraps = _base->LessThan(LOC, b, loop->finalValue(), _base->Add(LOC, b, constant(b, type, minValue(type)), lastLane));
+    Value *mainFinal = _base->Select(LOC, b, wraps, loop->initialValue(), _base->Sub(LOC, b, loop->finalValue(), lastLane));
+    Base::ForLoopBuilder *mainLoop = _base->ForLoopUp(LOC, b, loopVariable, loop->initialValue(), mainFinal, constant(b, type, c._numLanes));
+    Builder *vb = mainLoop->loopBody();
+
+    std::map<Value *,Value *> scalars;
+    std::map<Value *,Value *> vectors;
+    Builder *body = loop->loopBody();
+    for (OperationIterator opIt = body->OperationsBegin(); opIt != body->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        ActionID a = op->action();
+
+        Reduction *r = reductionFor(c, op);
+        if (r != NULL) {
+            if (op == r->_update) {
+                Value *other = (op->operand(0) == r->_load->result()) ? op->operand(1) : op->operand(0);
+                Value *v = vectorOf(c, vb, other, scalars, vectors);
+                Value *accumulator = _base->Load(LOC, vb, r->_accumulator);
+                if (a == _base->aAdd)
+                    accumulator = _vec->VectorAdd(LOC, vb, accumulator, v);
+                else
+                    accumulator = _vec->VectorMul(LOC, vb, accumulator, v);
+                _base->Store(LOC, vb, r->_accumulator, accumulator);
+            }
+            continue;
+        }
+
+        if (a == _base->aLoadAt) {
+            const VectorType *vectorType = _vec->VectorTypeFor(op->result()->type());
+            vectors[op->result()] = _vec->VectorLoadAt(LOC, vb, vectorType, mapped(op->operand(), scalars));
+        }
+        else if (a == _base->aStoreAt) {
+            Value *value = vectorOf(c, vb, op->operand(1), scalars, vectors);
+            _vec->VectorStoreAt(LOC, vb, mapped(op->operand(0), scalars), value);
+        }
+        else if (isArithmetic(op) && shape(c, op->result()) == Lanes) {
+            Value *left = vectorOf(c, vb, op->operand(0), scalars, vectors);
+            Value *right = vectorOf(c, vb, op->operand(1), scalars, vectors);
+            if (a == _base->aAdd)
+                vectors[op->result()] = _vec->VectorAdd(LOC, vb, left, right);
+            else if (a == _base->aSub)
+                vectors[op->result()] = _vec->VectorSub(LOC, vb, left, right);
+            else
+                vectors[op->result()] = _vec->VectorMul(LOC, vb, left, right);
+        }
+        else {
+            // Invariant, Index and Address values are computed as they were in the original loop
+            OperationCloner cloner(op);
+            for (int32_t o=0;o < op->numOperands();o++)
+                cloner.changeOperand(mapped(op->operand(o), scalars), o);
+            for (int32_t res=0;res < op->numResults();res++) {
+                cloner.createResult(vb, res);
+                scalars[op->result(res)] = cloner.result(res);
+            }
+            vb->appendClone(op, &cloner);
+        }
+    }
+
+    for (auto it = c._reductions.begin(); it != c._reductions.end(); it++) {
+        Reduction & r = *it;
+        Value *lanes = _base->Load(LOC, b, r._accumulator);
+        Value *value = _base->Load(LOC, b, r._symbol);
+        if (r._update->action() == _base->aAdd)
+            value = _base->Add(LOC, b, value, _vec->VectorReduceAdd(LOC, b, lanes));
+        else
+            value = _base->Mul(LOC, b, value, _vec->VectorReduceMul(LOC, b, lanes));
+        _base->Store(LOC, b, r._symbol, value);
+    }
+
+    // the original loop runs any remaining iterations, starting from where the main loop stopped
+    OperationCloner cloner(loop);
+    cloner.changeOperand(_base->Load(LOC, result, loopVariable), 0);
+    result->appendClone(loop, &cloner);
+
+    return result;
+}
+
+Builder *
+LoopVectorizer::transformOperation(Operation * op) {
+    if (op->action() != _base->aForLoopUp)
+        return NULL;
+
+    Candidate c;
+    c._loop = static_cast<Base::Op_ForLoopUp *>(op);
+    if (!analyze(c))
+        return NULL;
+
+    return vectorize(c);
+}
+
+} // namespace Vector
+} // namespace JitBuilder
+} // namespace OMR
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef LOOPVECTORIZER_INCL
+#define LOOPVECTORIZER_INCL
+
+#include <stdint.h>
+#include <map>
+#include <utility>
+#include <vector>
+#include "Transformer.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class Compiler;
+class Operation;
+class Symbol;
+class Type;
+class Value;
+
+namespace Base {
+class BaseExtension;
+class LocalSymbol;
+class Op_ForLoopUp;
+}
+
+namespace Vector {
+
+class VectorExtension;
+class VectorType;
+
+// LoopVectorizer rewrites innermost ForLoopUp loops (straight line bodies, bump of 1) whose
+// memory accesses are all LoadAt/StoreAt through IndexAt(base, i) on the loop variable i.
+// The body's Add/Sub/Mul become vector operations over numLanes consecutive iterations, a
+// main loop runs with bump numLanes, and the original loop then runs the remaining
+// iterations. A local updated as sum = sum + x (or sum * x) is a reduction: it is kept in a
+// vector accumulator that is reduced into the local after the main loop. Reductions of
+// floating point values reorder the additions, so they are only vectorized when the Function
+// allowsReassociation().
+//
+// Accesses through different base pointers may only be vectorized if they cannot overlap, which
+// Base::AliasAnalysis decides from their types and from noAlias parameters and Values. When it
+// cannot, and the bases are available before the loop, the vectorized code is guarded by a runtime
+// check that the ranges of elements the loop stores and accesses are disjoint; if they are not,
+// the original loop runs every iteration.
+class LoopVectorizer : public Transformer {
+public:
+    LoopVectorizer(Compiler *compiler);
+
+protected:
+    virtual void visitPreCompilation(Compilation * comp);
+    virtual Builder * transformOperation(Operation * op);
+
+    enum Shape {
+        Invariant, // same value in every iteration
+        Index,     // the loop variable
+        Address,   // IndexAt(invariant base, loop variable)
+        Lanes      // one value per iteration, computed as a vector
+    };
+
+    struct Reduction {
+        Symbol *_symbol;
+        Operation *_load;      // Load of _symbol in the loop body
+        Operation *_update;    // Add or Mul of _load's result and the value being reduced
+        Operation *_store;     // Store of _update's result to _symbol
+        Base::LocalSymbol *_accumulator;
+    };
+
+    struct Candidate {
+        Base::Op_ForLoopUp *_loop;
+        int32_t _numLanes;
+        std::map<Value *,Shape> _shapes;
+        std::map<Value *,Value *> _bases;       // for Address values: the base of the IndexAt
+        std::vector<Reduction> _reductions;
+        std::vector<std::pair<Value *,Value *> > _overlapChecks; // bases to check at runtime
+    };
+
+    bool analyze(Candidate & c);
+    bool analyzeReductions(Candidate & c);
+    bool useLanes(Candidate & c, const Type *elementType);
+    Shape shape(Candidate & c, Value *v);
+    Reduction *reductionFor(Candidate & c, Operation *op);
+    Symbol *baseKey(Value *base);
+    bool mayOverlap(Value *base1, Value *base2);
+    bool isAvailableBeforeLoop(Value *base);
+    bool isArithmetic(Operation *op) const;
+
+    Builder * vectorize(Candidate & c);
+    void checkOverlap(Candidate & c, Builder *b, Value *base1, Value *base2, Builder *overlapTarget);
+    Value * baseBeforeLoop(Builder *b, Value *base);
+    Value * vectorOf(Candidate & c, Builder *b, Value *v, std::map<Value *,Value *> & scalars, std::map<Value *,Value *> & vectors);
+    Value * mapped(Value *v, std::map<Value *,Value *> & scalars);
+    Value * constant(Builder *b, const Type *type, int64_t v);
+    int64_t minValue(const Type *type);
+
+    VectorExtension *_vec;
+    Base::BaseExtension *_base;
+    std::map<Value *,Operation *> _definitions; // operations in the current loop body
+};
+
+} // namespace Vector
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(LOOPVECTORIZER_INCL)
+
@@ -0,0 +1,391 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "Base/BaseExtension.hpp"
+#include "Base/BaseTypes.hpp"
+#include "Builder.hpp"
+#include "Compiler.hpp"
+#include "JB1CodeGenerator.hpp"
+#include "LoopVectorizer.hpp"
+#include "Strategy.hpp"
+#include "Value.hpp"
+#include "VectorExtension.hpp"
+#include "VectorLowering.hpp"
+#include "VectorOperations.hpp"
+#include "VectorTypes.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Vector {
+
+const SemanticVersion VectorExtension::version(VECTOREXT_MAJOR,VECTOREXT_MINOR,VECTOREXT_PATCH);
+const std::string VectorExtension::NAME("vector");
+
+extern "C" {
+    Extension *create(Compiler *compiler) {
+        return new VectorExtension(compiler);
+    }
+}
+
+VectorExtension::VectorExtension(Compiler *compiler, bool extended, std::string extensionName)
+    : Extension(compiler, (extended ? extensionName : NAME))
+    , aVectorAdd(registerAction(std::string("VectorAdd")))
+    , aVectorSub(registerAction(std::string("VectorSub")))
+    , aVectorMul(registerAction(std::string("VectorMul")))
+    , aVectorLoadAt(registerAction(std::string("VectorLoadAt")))
+    , aVectorStoreAt(registerAction(std::string("VectorStoreAt")))
+    , aVectorBroadcast(registerAction(std::string("VectorBroadcast")))
+    , aVectorShuffle(registerAction(std::string("VectorShuffle")))
+    , aVectorReduceAdd(registerAction(std::string("VectorReduceAdd")))
+    , aVectorReduceMul(registerAction(std::string("VectorReduceMul")))
+    , CompileFail_BaseExtensionNotLoaded(registerReturnCode("BaseExtensionNotLoaded"))
+    , CompileFail_BadInputTypes_VectorAdd(registerReturnCode("CompileFail_BadInputTypes_VectorAdd"))
+    , CompileFail_BadInputTypes_VectorSub(registerReturnCode("CompileFail_BadInputTypes_VectorSub"))
+    , CompileFail_BadInputTypes_VectorMul(registerReturnCode("CompileFail_BadInputTypes_VectorMul"))
+    , CompileFail_BadInputTypes_VectorLoadAt(registerReturnCode("CompileFail_BadInputTypes_VectorLoadAt"))
+    , CompileFail_BadInputTypes_VectorStoreAt(registerReturnCode("CompileFail_BadInputTypes_VectorStoreAt"))
+    , CompileFail_BadInputTypes_VectorBroadcast(registerReturnCode("CompileFail_BadInputTypes_VectorBroadcast"))
+    , CompileFail_BadInputArray_VectorShuffle(registerReturnCode("CompileFail_BadInputArray_VectorShuffle"))
+    , CompileFail_BadInputTypes_VectorReduceAdd(registerReturnCode("CompileFail_BadInputTypes_VectorReduceAdd"))
+    , CompileFail_BadInputTypes_VectorReduceMul(registerReturnCode("CompileFail_BadInputTypes_VectorReduceMul"))
+    , CompileFail_VectorValueCannotBeLowered(registerReturnCode("CompileFail_VectorValueCannotBeLowered")) {
+
+    if (!compiler->validateExtension(Base::BaseExtension::NAME)) {
+        CompilationException e(LOC, compiler, CompileFail_BaseExtensionNotLoaded);
+        e.setMessageLine(std::string("Vector Extension depends on Base extension to be loaded"))
+         .appendMessageLine(std::string("    Call compiler->loadExtension<Base::BaseExtension>(\"base\") before trying to load Vector extension"));
+        throw e;
+    }
+
+    _baseExt = compiler->lookupExtension<Base::BaseExtension>(Base::BaseExtension::NAME);
+
+    Int8x16 = VectorType::create(LOC, this, _baseExt->Int8, 16);
+    Int16x8 = VectorType::create(LOC, this, _baseExt->Int16, 8);
+    Int32x4 = VectorType::create(LOC, this, _baseExt->Int32, 4);
+    Int64x2 = VectorType::create(LOC, this, _baseExt->Int64, 2);
+    Float32x4 = VectorType::create(LOC, this, _baseExt->Float32, 4);
+    Float64x2 = VectorType::create(LOC, this, _baseExt->Float64, 2);
+
+    if (!extended) {
+        Strategy *jb1cgStrategy = new Strategy(compiler, "vectorjb1cg");
+        jb1cgStrategy->addPass(new LoopVectorizer(compiler))
+                     ->addPass(new VectorLowering(compiler))
+                     ->addPass(new JB1CodeGenerator(compiler));
+        _jb1cgStrategyID = jb1cgStrategy->id();
+        _checkers.push_back(new VectorExtensionChecker(this));
+    }
+}
+
+VectorExtension::~VectorExtension() {
+}
+
+const VectorType *
+VectorExtension::VectorTypeFor(const Type *elementType) const {
+    if (elementType == _baseExt->Int8)
+        return Int8x16;
+    else if (elementType == _baseExt->Int16)
+        return Int16x8;
+    else if (elementType == _baseExt->Int32)
+        return Int32x4;
+    else if (elementType == _baseExt->Int64)
+        return Int64x2;
+    else if (elementType == _baseExt->Float32)
+        return Float32x4;
+    else if (elementType == _baseExt->Float64)
+        return Float64x2;
+    return NULL;
+}
+
+CompilerReturnCode
+VectorExtension::jb1cgCompile(Compilation *comp) {
+    return _compiler->compile(comp, _jb1cgStrategyID);
+}
+
+
+//
+// Lane-wise arithmetic
+//
+bool
+VectorExtensionChecker::validateLanewise(LOCATION, Builder *b, Value *left, Value *right, CompilerReturnCode failCode, std::string opCodeName) {
+    const Type *lType = left->type();
+    if (lType->isKind<VectorType>() && right->type() == lType)
+        return true;
+
+    // operation is declared by this extension, so if we can't validate it we have to fail it
+    failValidateLanewise(PASSLOC, b, left, right, failCode, opCodeName);
+    return true;
+}
+
+void
+VectorExtensionChecker::failValidateLanewise(LOCATION, Builder *b, Value *left, Value *right, CompilerReturnCode failCode, std::string opCodeName) {
+    CompilationException e(PASSLOC, _vec->compiler(), failCode);
+    const Type *lType = left->type();
+    const Type *rType = right->type();
+    e.setMessageLine(opCodeName.append(std::string(": invalid input types")))
+     .appendMessageLine(std::string("    left ").append(lType->to_string()))
+     .appendMessageLine(std::string("   right ").append(rType->to_string()))
+     .appendMessageLine(std::string("Left and right types are expected to be the same vector type"));
+    throw e;
+}
+
+Value *
+VectorExtension::VectorAdd(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        VectorExtensionChecker *checker = *it;
+        if (checker->validateLanewise(PASSLOC, b, left, right, CompileFail_BadInputTypes_VectorAdd, "VectorAdd"))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_VectorAdd(PASSLOC, this, b, aVectorAdd, result, left, right));
+    return result;
+}
+
+Value *
+VectorExtension::VectorSub(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        VectorExtensionChecker *checker = *it;
+        if (checker->validateLanewise(PASSLOC, b, left, right, CompileFail_BadInputTypes_VectorSub, "VectorSub"))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_VectorSub(PASSLOC, this, b, aVectorSub, result, left, right));
+    return result;
+}
+
+Value *
+VectorExtension::VectorMul(LOCATION, Builder *b, Value *left, Value *right) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        VectorExtensionChecker *checker = *it;
+        if (checker->validateLanewise(PASSLOC, b, left, right, CompileFail_BadInputTypes_VectorMul, "VectorMul"))
+            break;
+    }
+
+    Value *result = createValue(b, left->type());
+    addOperation(b, new Op_VectorMul(PASSLOC, this, b, aVectorMul, result, left, right));
+    return result;
+}
+
+
+//
+// Memory operations
+//
+bool
+VectorExtensionChecker::isPointerToElement(Value *address, const VectorType *type) const {
+    const Type *aType = address->type();
+    if (!aType->isKind<Base::PointerType>())
+        return false;
+    return aType->refine<Base::PointerType>()->baseType() == type->elementType();
+}
+
+bool
+VectorExtensionChecker::validateLoadAt(LOCATION, Builder *b, const VectorType *type, Value *address) {
+    if (isPointerToElement(address, type))
+        return true;
+
+    failValidateLoadAt(PASSLOC, b, type, address);
+    return true;
+}
+
+void
+VectorExtensionChecker::failValidateLoadAt(LOCATION, Builder *b, const VectorType *type, Value *address) {
+    CompilationException e(PASSLOC, _vec->compiler(), _vec->CompileFail_BadInputTypes_VectorLoadAt);
+    e.setMessageLine(std::string("VectorLoadAt: invalid input types"))
+     .appendMessageLine(std::string("     type ").append(type->to_string()))
+     .appendMessageLine(std::string("  address ").append(address->type()->to_string()))
+     .appendMessageLine(std::string("Address type is expected to be a pointer to the vector's element type"));
+    throw e;
+}
+
+Value *
+VectorExtension::VectorLoadAt(LOCATION, Builder *b, const VectorType *type, Value *address) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        VectorExtensionChecker *checker = *it;
+        if (checker->validateLoadAt(PASSLOC, b, type, address))
+            break;
+    }
+
+    Value *result = createValue(b, type);
+    addOperation(b, new Op_VectorLoadAt(PASSLOC, this, b, aVectorLoadAt, result, type, address));
+    return result;
+}
+
+bool
+VectorExtensionChecker::validateStoreAt(LOCATION, Builder *b, Value *address, Value *value) {
+    const Type *vType = value->type();
+    if (vType->isKind<VectorType>() && isPointerToElement(address, vType->refine<VectorType>()))
+        return true;
+
+    failValidateStoreAt(PASSLOC, b, address, value);
+    return true;
+}
+
+void
+VectorExtensionChecker::failValidateStoreAt(LOCATION, Builder *b, Value *address, Value *value) {
+    CompilationException e(PASSLOC, _vec->compiler(), _vec->CompileFail_BadInputTypes_VectorStoreAt);
+    e.setMessageLine(std::string("VectorStoreAt: invalid input types"))
+     .appendMessageLine(std::string("  address ").append(address->type()->to_string()))
+     .appendMessageLine(std::string("    value ").append(value->type()->to_string()))
+     .appendMessageLine(std::string("Value must be a vector and address type is expected to be a pointer to the vector's element type"));
+    throw e;
+}
+
+void
+VectorExtension::VectorStoreAt(LOCATION, Builder *b, Value *address, Value *value) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        VectorExtensionChecker *checker = *it;
+        if (checker->validateStoreAt(PASSLOC, b, address, value))
+            break;
+    }
+
+    addOperation(b, new Op_VectorStoreAt(PASSLOC, this, b, aVectorStoreAt, address, value));
+}
+
+
+//
+// Lane operations
+//
+bool
+VectorExtensionChecker::validateBroadcast(LOCATION, Builder *b, const VectorType *type, Value *value) {
+    if (value->type() == type->elementType())
+        return true;
+
+    failValidateBroadcast(PASSLOC, b, type, value);
+    return true;
+}
+
+void
+VectorExtensionChecker::failValidateBroadcast(LOCATION, Builder *b, const VectorType *type, Value *value) {
+    CompilationException e(PASSLOC, _vec->compiler(), _vec->CompileFail_BadInputTypes_VectorBroadcast);
+    e.setMessageLine(std::string("VectorBroadcast: invalid input types"))
+     .appendMessageLine(std::string("   type ").append(type->to_string()))
+     .appendMessageLine(std::string("  value ").append(value->type()->to_string()))
+     .appendMessageLine(std::string("Value type is expected to be the vector's element type"));
+    throw e;
+}
+
+Value *
+VectorExtension::VectorBroadcast(LOCATION, Builder *b, const VectorType *type, Value *value) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        VectorExtensionChecker *checker = *it;
+        if (checker->validateBroadcast(PASSLOC, b, type, value))
+            break;
+    }
+
+    Value *result = createValue(b, type);
+    addOperation(b, new Op_VectorBroadcast(PASSLOC, this, b, aVectorBroadcast, result, type, value));
+    return result;
+}
+
+bool
+VectorExtensionChecker::validateShuffle(LOCATION, Builder *b, Value *value, const std::vector<int32_t> & lanes) {
+    const Type *vType = value->type();
+    if (vType->isKind<VectorType>()) {
+        int32_t numLanes = vType->refine<VectorType>()->numLanes();
+        bool valid = (lanes.size() == (size_t) numLanes);
+        for (auto it = lanes.begin(); valid && it != lanes.end(); it++)
+            valid = (*it >= 0 && *it < numLanes);
+        if (valid)
+            return true;
+    }
+
+    failValidateShuffle(PASSLOC, b, value, lanes);
+    return true;
+}
+
+void
+VectorExtensionChecker::failValidateShuffle(LOCATION, Builder *b, Value *value, const std::vector<int32_t> & lanes) {
+    CompilationException e(PASSLOC, _vec->compiler(), _vec->CompileFail_BadInputArray_VectorShuffle);
+    std::string laneList;
+    for (auto it = lanes.begin(); it != lanes.end(); it++)
+        laneList.append(" ").append(std::to_string(*it));
+    e.setMessageLine(std::string("VectorShuffle: invalid inputs"))
+     .appendMessageLine(std::string("  value ").append(value->type()->to_string()))
+     .appendMessageLine(std::string("  lanes").append(laneList))
+     .appendMessageLine(std::string("Value must be a vector and there must be one lane index, in range, for every lane of the vector"));
+    throw e;
+}
+
+Value *
+VectorExtension::VectorShuffle(LOCATION, Builder *b, Value *value, const std::vector<int32_t> & lanes) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        VectorExtensionChecker *checker = *it;
+        if (checker->validateShuffle(PASSLOC, b, value, lanes))
+            break;
+    }
+
+    Value *result = createValue(b, value->type());
+    addOperation(b, new Op_VectorShuffle(PASSLOC, this, b, aVectorShuffle, result, value, lanes));
+    return result;
+}
+
+
+//
+// Reductions
+//
+bool
+VectorExtensionChecker::validateReduce(LOCATION, Builder *b, Value *value, CompilerReturnCode failCode, std::string opCodeName) {
+    if (value->type()->isKind<VectorType>())
+        return true;
+
+    failValidateReduce(PASSLOC, b, value, failCode, opCodeName);
+    return true;
+}
+
+void
+VectorExtensionChecker::failValidateReduce(LOCATION, Builder *b, Value *value, CompilerReturnCode failCode, std::string opCodeName) {
+    CompilationException e(PASSLOC, _vec->compiler(), failCode);
+    e.setMessageLine(opCodeName.append(std::string(": invalid input types")))
+     .appendMessageLine(std::string("  value ").append(value->type()->to_string()))
+     .appendMessageLine(std::string("Value is expected to be a vector"));
+    throw e;
+}
+
+Value *
+VectorExtension::VectorReduceAdd(LOCATION, Builder *b, Value *value) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        VectorExtensionChecker *checker = *it;
+        if (checker->validateReduce(PASSLOC, b, value, CompileFail_BadInputTypes_VectorReduceAdd, "VectorReduceAdd"))
+            break;
+    }
+
+    Value *result = createValue(b, value->type()->refine<VectorType>()->elementType());
+    addOperation(b, new Op_VectorReduceAdd(PASSLOC, this, b, aVectorReduceAdd, result, value));
+    return result;
+}
+
+Value *
+VectorExtension::VectorReduceMul(LOCATION, Builder *b, Value *value) {
+    for (auto it = _checkers.begin(); it != _checkers.end(); it++) {
+        VectorExtensionChecker *checker = *it;
+        if (checker->validateReduce(PASSLOC, b, value, CompileFail_BadInputTypes_VectorReduceMul, "VectorReduceMul"))
+            break;
+    }
+
+    Value *result = createValue(b, value->type()->refine<VectorType>()->elementType());
+    addOperation(b, new Op_VectorReduceMul(PASSLOC, this, b, aVectorReduceMul, result, value));
+    return result;
+}
+
+} // namespace Vector
+} // namespace JitBuilder
+} // namespace OMR
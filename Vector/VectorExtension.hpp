@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef VECTOREXTENSION_INCL
+#define VECTOREXTENSION_INCL
+
+#include <stdint.h>
+#include <vector>
+#include "CreateLoc.hpp"
+#include "Extension.hpp"
+#include "IDs.hpp"
+#include "SemanticVersion.hpp"
+#include "typedefs.hpp"
+
+
+namespace OMR {
+namespace JitBuilder {
+
+class Compilation;
+class Type;
+class Value;
+
+namespace Base { class BaseExtension; }
+
+namespace Vector {
+
+class VectorExtensionChecker;
+class VectorType;
+
+class VectorExtension : public Extension {
+    friend class VectorExtensionChecker;
+
+public:
+    VectorExtension(Compiler *compiler, bool extended=false, std::string extensionName="vector");
+    virtual ~VectorExtension();
+
+    static const std::string NAME;
+    static const MajorID VECTOREXT_MAJOR=0;
+    static const MinorID VECTOREXT_MINOR=1;
+    static const PatchID VECTOREXT_PATCH=0;
+
+    virtual const SemanticVersion * semver() const {
+        return &version;
+    }
+
+    Base::BaseExtension *baseExt() const { return _baseExt; }
+
+    //
+    // Types
+    //
+
+    // 128-bit vectors of each primitive numeric type
+    const VectorType *Int8x16;
+    const VectorType *Int16x8;
+    const VectorType *Int32x4;
+    const VectorType *Int64x2;
+    const VectorType *Float32x4;
+    const VectorType *Float64x2;
+
+    // returns the vector Type whose lanes have type elementType, or NULL if there isn't one
+    const VectorType *VectorTypeFor(const Type *elementType) const;
+
+    //
+    // Actions
+    //
+
+    const ActionID aVectorAdd;
+    const ActionID aVectorSub;
+    const ActionID aVectorMul;
+    const ActionID aVectorLoadAt;
+    const ActionID aVectorStoreAt;
+    const ActionID aVectorBroadcast;
+    const ActionID aVectorShuffle;
+    const ActionID aVectorReduceAdd;
+    const ActionID aVectorReduceMul;
+
+    //
+    // CompilerReturnCodes
+    //
+    const CompilerReturnCode CompileFail_BaseExtensionNotLoaded;
+    const CompilerReturnCode CompileFail_BadInputTypes_VectorAdd;
+    const CompilerReturnCode CompileFail_BadInputTypes_VectorSub;
+    const CompilerReturnCode CompileFail_BadInputTypes_VectorMul;
+    const CompilerReturnCode CompileFail_BadInputTypes_VectorLoadAt;
+    const CompilerReturnCode CompileFail_BadInputTypes_VectorStoreAt;
+    const CompilerReturnCode CompileFail_BadInputTypes_VectorBroadcast;
+    const CompilerReturnCode CompileFail_BadInputArray_VectorShuffle;
+    const CompilerReturnCode CompileFail_BadInputTypes_VectorReduceAdd;
+    const CompilerReturnCode CompileFail_BadInputTypes_VectorReduceMul;
+    const CompilerReturnCode CompileFail_VectorValueCannotBeLowered;
+
+    //
+    // Operations
+    //
+
+    // Lane-wise arithmetic: both operands must have the same vector Type
+    Value * VectorAdd(LOCATION, Builder *b, Value *left, Value *right);
+    Value * VectorSub(LOCATION, Builder *b, Value *left, Value *right);
+    Value * VectorMul(LOCATION, Builder *b, Value *left, Value *right);
+
+    // Memory operations: address must be a pointer to the element type of the vector
+    Value * VectorLoadAt(LOCATION, Builder *b, const VectorType *type, Value *address);
+    void VectorStoreAt(LOCATION, Builder *b, Value *address, Value *value);
+
+    // Lane operations
+    Value * VectorBroadcast(LOCATION, Builder *b, const VectorType *type, Value *value);
+    Value * VectorShuffle(LOCATION, Builder *b, Value *value, const std::vector<int32_t> & lanes);
+
+    // Horizontal reductions of all lanes to a single value of the element type
+    Value * VectorReduceAdd(LOCATION, Builder *b, Value *value);
+    Value * VectorReduceMul(LOCATION, Builder *b, Value *value);
+
+    // JB1 compilation support: loops are vectorized, then vector operations are lowered to scalar operations
+    CompilerReturnCode jb1cgCompile(Compilation *comp);
+
+protected:
+    static const SemanticVersion version;
+    Base::BaseExtension *_baseExt;
+
+    StrategyID _jb1cgStrategyID;
+    std::vector<VectorExtensionChecker *> _checkers;
+};
+
+class VectorExtensionChecker {
+public:
+    VectorExtensionChecker(VectorExtension *vec)
+        : _vec(vec) {
+
+    }
+
+    virtual bool validateLanewise(LOCATION, Builder *b, Value *left, Value *right, CompilerReturnCode failCode, std::string opCodeName);
+    virtual bool validateLoadAt(LOCATION, Builder *b, const VectorType *type, Value *address);
+    virtual bool validateStoreAt(LOCATION, Builder *b, Value *address, Value *value);
+    virtual bool validateBroadcast(LOCATION, Builder *b, const VectorType *type, Value *value);
+    virtual bool validateShuffle(LOCATION, Builder *b, Value *value, const std::vector<int32_t> & lanes);
+    virtual bool validateReduce(LOCATION, Builder *b, Value *value, CompilerReturnCode failCode, std::string opCodeName);
+
+protected:
+    virtual void failValidateLanewise(LOCATION, Builder *b, Value *left, Value *right, CompilerReturnCode failCode, std::string opCodeName);
+    virtual void failValidateLoadAt(LOCATION, Builder *b, const VectorType *type, Value *address);
+    virtual void failValidateStoreAt(LOCATION, Builder *b, Value *address, Value *value);
+    virtual void failValidateBroadcast(LOCATION, Builder *b, const VectorType *type, Value *value);
+    virtual void failValidateShuffle(LOCATION, Builder *b, Value *value, const std::vector<int32_t> & lanes);
+    virtual void failValidateReduce(LOCATION, Builder *b, Value *value, CompilerReturnCode failCode, std::string opCodeName);
+
+    bool isPointerToElement(Value *address, const VectorType *type) const;
+
+    VectorExtension *_vec;
+};
+
+} // namespace Vector
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(VECTOREXTENSION_INCL)
+
@@ -0,0 +1,232 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string>
+#include "Base/BaseExtension.hpp"
+#include "Base/BaseSymbols.hpp"
+#include "Base/Function.hpp"
+#include "Base/FunctionCompilation.hpp"
+#include "Builder.hpp"
+#include "Compilation.hpp"
+#include "Compiler.hpp"
+#include "Config.hpp"
+#include "Mapper.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "Value.hpp"
+#include "VectorExtension.hpp"
+#include "VectorLowering.hpp"
+#include "VectorOperations.hpp"
+#include "VectorTypes.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Vector {
+
+VectorLowering::VectorLowering(Compiler *compiler)
+    : Transformer(compiler, std::string("VectorLowering"))
+    , _vec(compiler->lookupExtension<VectorExtension>())
+    , _base(compiler->lookupExtension<Base::BaseExtension>()) {
+
+}
+
+void
+VectorLowering::visitPreCompilation(Compilation * comp) {
+    setTraceEnabled(_comp->config()->traceVectorLowering());
+    _lanes.clear();
+    _laneSymbols.clear();
+}
+
+void
+VectorLowering::failLowering(Operation *op) {
+    CompilationException e(LOC, _vec->compiler(), _vec->CompileFail_VectorValueCannotBeLowered);
+    e.setMessageLine(std::string("VectorLowering: cannot lower operation ").append(op->name()))
+     .appendMessageLine(std::string("Vector values can only be used by vector operations or be stored in local variables"));
+    throw e;
+}
+
+std::vector<Value *> &
+VectorLowering::lanes(Operation *op, Value *v) {
+    auto found = _lanes.find(v);
+    if (found == _lanes.end())
+        failLowering(op);
+    return found->second;
+}
+
+// LocalSymbols of a vector Type are replaced by one LocalSymbol per lane of the Type's layout
+std::vector<Base::LocalSymbol *> &
+VectorLowering::laneSymbols(Operation *op, Symbol *sym) {
+    auto found = _laneSymbols.find(sym);
+    if (found != _laneSymbols.end())
+        return found->second;
+
+    if (!sym->isExactKind<Base::LocalSymbol>())
+        failLowering(op);
+
+    TypeMapper m;
+    sym->type()->layout()->explodeAsLayout(NULL, 0, &m);
+
+    Base::Function *func = static_cast<Base::FunctionCompilation *>(_comp)->func();
+    std::vector<Base::LocalSymbol *> & symbols = _laneSymbols[sym];
+    m.start();
+    for (size_t l=0;l < m.size();l++) {
+        std::string name = sym->name() + std::string(".") + m.name();
+        const Type *laneType = m.next();
+        symbols.push_back(func->DefineLocal(name, laneType));
+    }
+    return symbols;
+}
+
+// appends left+right (or left*right) to b, computed into the (scalar) result of op so that
+// later operations using that result need not change
+void
+VectorLowering::defineResult(Builder *b, Operation *op, Value *left, Value *right, bool multiply) {
+    Builder *scratch = _base->OrphanBuilder(LOC, b);
+    if (multiply)
+        _base->Mul(LOC, scratch, left, right);
+    else
+        _base->Add(LOC, scratch, left, right);
+
+    Operation *combine = *scratch->OperationsBegin();
+    OperationCloner cloner(combine);
+    cloner.changeResult(op->result());
+    b->appendClone(combine, &cloner);
+}
+
+Builder *
+VectorLowering::transformOperation(Operation * op) {
+    ActionID a = op->action();
+
+    if (a == _vec->aVectorAdd || a == _vec->aVectorSub || a == _vec->aVectorMul) {
+        Builder *b = _base->OrphanBuilder(LOC, op->parent());
+        std::vector<Value *> & left = lanes(op, op->operand(0));
+        std::vector<Value *> & right = lanes(op, op->operand(1));
+        std::vector<Value *> result;
+        for (size_t l=0;l < left.size();l++) {
+            if (a == _vec->aVectorAdd)
+                result.push_back(_base->Add(LOC, b, left[l], right[l]));
+            else if (a == _vec->aVectorSub)
+                result.push_back(_base->Sub(LOC, b, left[l], right[l]));
+            else
+                result.push_back(_base->Mul(LOC, b, left[l], right[l]));
+        }
+        _lanes[op->result()] = result;
+        return b;
+    }
+
+    if (a == _vec->aVectorLoadAt) {
+        Builder *b = _base->OrphanBuilder(LOC, op->parent());
+        const VectorType *type = op->type()->refine<VectorType>();
+        Value *address = op->operand();
+        std::vector<Value *> result;
+        for (int32_t l=0;l < type->numLanes();l++) {
+            Value *laneAddress = (l == 0) ? address : _base->IndexAt(LOC, b, address, _base->ConstInt32(LOC, b, l));
+            result.push_back(_base->LoadAt(LOC, b, laneAddress));
+        }
+        _lanes[op->result()] = result;
+        return b;
+    }
+
+    if (a == _vec->aVectorStoreAt) {
+        Builder *b = _base->OrphanBuilder(LOC, op->parent());
+        Value *address = op->operand(0);
+        std::vector<Value *> & value = lanes(op, op->operand(1));
+        for (size_t l=0;l < value.size();l++) {
+            Value *laneAddress = (l == 0) ? address : _base->IndexAt(LOC, b, address, _base->ConstInt32(LOC, b, l));
+            _base->StoreAt(LOC, b, laneAddress, value[l]);
+        }
+        return b;
+    }
+
+    if (a == _vec->aVectorBroadcast) {
+        const VectorType *type = op->type()->refine<VectorType>();
+        _lanes[op->result()] = std::vector<Value *>(type->numLanes(), op->operand());
+        return _base->OrphanBuilder(LOC, op->parent());
+    }
+
+    if (a == _vec->aVectorShuffle) {
+        Op_VectorShuffle *shuffle = static_cast<Op_VectorShuffle *>(op);
+        std::vector<Value *> & value = lanes(op, op->operand());
+        std::vector<Value *> result;
+        for (int32_t l=0;l < shuffle->numLanes();l++)
+            result.push_back(value[shuffle->lane(l)]);
+        _lanes[op->result()] = result;
+        return _base->OrphanBuilder(LOC, op->parent());
+    }
+
+    if (a == _vec->aVectorReduceAdd || a == _vec->aVectorReduceMul) {
+        Builder *b = _base->OrphanBuilder(LOC, op->parent());
+        bool multiply = (a == _vec->aVectorReduceMul);
+        std::vector<Value *> & value = lanes(op, op->operand());
+        Value *partial = value[0];
+        for (size_t l=1;l < value.size()-1;l++)
+            partial = multiply ? _base->Mul(LOC, b, partial, value[l]) : _base->Add(LOC, b, partial, value[l]);
+        defineResult(b, op, partial, value[value.size()-1], multiply);
+        return b;
+    }
+
+    if (a == _base->aLoad && op->symbol()->type()->isKind<VectorType>()) {
+        Builder *b = _base->OrphanBuilder(LOC, op->parent());
+        std::vector<Base::LocalSymbol *> & symbols = laneSymbols(op, op->symbol());
+        std::vector<Value *> result;
+        for (size_t l=0;l < symbols.size();l++)
+            result.push_back(_base->Load(LOC, b, symbols[l]));
+        _lanes[op->result()] = result;
+        return b;
+    }
+
+    if (a == _base->aStore && op->symbol()->type()->isKind<VectorType>()) {
+        Builder *b = _base->OrphanBuilder(LOC, op->parent());
+        std::vector<Base::LocalSymbol *> & symbols = laneSymbols(op, op->symbol());
+        std::vector<Value *> & value = lanes(op, op->operand());
+        for (size_t l=0;l < symbols.size();l++)
+            _base->Store(LOC, b, symbols[l], value[l]);
+        return b;
+    }
+
+    // no other operation knows what to do with a vector
+    for (int32_t o=0;o < op->numOperands();o++) {
+        if (op->operand(o)->type()->isKind<VectorType>())
+            failLowering(op);
+    }
+    for (int32_t r=0;r < op->numResults();r++) {
+        if (op->result(r)->type()->isKind<VectorType>())
+            failLowering(op);
+    }
+
+    return NULL;
+}
+
+// vector LocalSymbols have all been replaced by their lanes and cannot be allocated by JB1
+void
+VectorLowering::visitPostCompilation(Compilation * comp) {
+    Base::Function *func = static_cast<Base::FunctionCompilation *>(_comp)->func();
+    Base::LocalSymbolVector locals = func->ResetLocals();
+    for (auto lIt = locals.begin(); lIt != locals.end(); lIt++) {
+        Base::LocalSymbol *local = *lIt;
+        if (!local->type()->isKind<VectorType>())
+            func->DefineLocal(local);
+    }
+}
+
+} // namespace Vector
+} // namespace JitBuilder
+} // namespace OMR
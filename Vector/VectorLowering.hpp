@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef VECTORLOWERING_INCL
+#define VECTORLOWERING_INCL
+
+#include <map>
+#include <vector>
+#include "Transformer.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Builder;
+class Compiler;
+class Operation;
+class Symbol;
+class Type;
+class Value;
+
+namespace Base {
+class BaseExtension;
+class LocalSymbol;
+}
+
+namespace Vector {
+
+class VectorExtension;
+class VectorType;
+
+// VectorLowering replaces every vector operation with the equivalent scalar operations on
+// each lane, for targets (like JB1) that have no vector support. Every vector Value is
+// exploded, via its Type's layout(), into one Value per lane, and every vector LocalSymbol
+// into one LocalSymbol per lane. Vector Values may only flow through vector operations and
+// Load/Store of LocalSymbols: any other use of a vector Value fails the compilation.
+class VectorLowering : public Transformer {
+public:
+    VectorLowering(Compiler *compiler);
+
+protected:
+    virtual void visitPreCompilation(Compilation * comp);
+    virtual Builder * transformOperation(Operation * op);
+    virtual void visitPostCompilation(Compilation * comp);
+
+    std::vector<Value *> & lanes(Operation *op, Value *v);
+    std::vector<Base::LocalSymbol *> & laneSymbols(Operation *op, Symbol *sym);
+    void defineResult(Builder *b, Operation *op, Value *left, Value *right, bool multiply);
+    void failLowering(Operation *op);
+
+    VectorExtension *_vec;
+    Base::BaseExtension *_base;
+    std::map<Value *,std::vector<Value *> > _lanes;
+    std::map<Symbol *,std::vector<Base::LocalSymbol *> > _laneSymbols;
+};
+
+} // namespace Vector
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(VECTORLOWERING_INCL)
+
@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "Builder.hpp"
+#include "Operation.hpp"
+#include "OperationCloner.hpp"
+#include "TextWriter.hpp"
+#include "Value.hpp"
+#include "VectorOperations.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Vector {
+
+//
+// VectorAdd
+//
+Op_VectorAdd::Op_VectorAdd(LOCATION, Extension *ext, Builder * parent, ActionID aVectorAdd, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aVectorAdd, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_VectorAdd::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_VectorAdd(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+
+//
+// VectorSub
+//
+Op_VectorSub::Op_VectorSub(LOCATION, Extension *ext, Builder * parent, ActionID aVectorSub, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aVectorSub, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_VectorSub::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_VectorSub(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+
+//
+// VectorMul
+//
+Op_VectorMul::Op_VectorMul(LOCATION, Extension *ext, Builder * parent, ActionID aVectorMul, Value *result, Value *left, Value *right)
+    : OperationR1V2(PASSLOC, aVectorMul, ext, parent, result, left, right) {
+
+}
+
+Operation *
+Op_VectorMul::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_VectorMul(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(0), cloner->operand(1));
+}
+
+
+//
+// VectorLoadAt
+//
+Op_VectorLoadAt::Op_VectorLoadAt(LOCATION, Extension *ext, Builder * parent, ActionID aVectorLoadAt, Value *result, const Type *vectorType, Value *address)
+    : OperationR1V1T1(PASSLOC, aVectorLoadAt, ext, parent, result, vectorType, address) {
+
+}
+
+Operation *
+Op_VectorLoadAt::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_VectorLoadAt(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->type(), cloner->operand());
+}
+
+
+//
+// VectorStoreAt
+//
+Op_VectorStoreAt::Op_VectorStoreAt(LOCATION, Extension *ext, Builder * parent, ActionID aVectorStoreAt, Value *address, Value *value)
+    : OperationR0V2(PASSLOC, aVectorStoreAt, ext, parent, address, value) {
+
+}
+
+Operation *
+Op_VectorStoreAt::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_VectorStoreAt(PASSLOC, this->_ext, b, this->action(), cloner->operand(0), cloner->operand(1));
+}
+
+
+//
+// VectorBroadcast
+//
+Op_VectorBroadcast::Op_VectorBroadcast(LOCATION, Extension *ext, Builder * parent, ActionID aVectorBroadcast, Value *result, const Type *vectorType, Value *value)
+    : OperationR1V1T1(PASSLOC, aVectorBroadcast, ext, parent, result, vectorType, value) {
+
+}
+
+Operation *
+Op_VectorBroadcast::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_VectorBroadcast(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->type(), cloner->operand());
+}
+
+
+//
+// VectorShuffle
+//
+Op_VectorShuffle::Op_VectorShuffle(LOCATION, Extension *ext, Builder * parent, ActionID aVectorShuffle, Value *result, Value *value, const std::vector<int32_t> & lanes)
+    : OperationR1V1(PASSLOC, aVectorShuffle, ext, parent, result, value)
+    , _lanes(lanes) {
+
+}
+
+Operation *
+Op_VectorShuffle::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_VectorShuffle(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand(), _lanes);
+}
+
+void
+Op_VectorShuffle::write(TextWriter & w) const {
+    w << this->_result << " = " << this->name() << " " << this->_value << " [";
+    for (int32_t l=0;l < numLanes();l++) {
+        if (l > 0)
+            w << " ";
+        w << _lanes[l];
+    }
+    w << "]" << w.endl();
+}
+
+
+//
+// VectorReduceAdd
+//
+Op_VectorReduceAdd::Op_VectorReduceAdd(LOCATION, Extension *ext, Builder * parent, ActionID aVectorReduceAdd, Value *result, Value *value)
+    : OperationR1V1(PASSLOC, aVectorReduceAdd, ext, parent, result, value) {
+
+}
+
+Operation *
+Op_VectorReduceAdd::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_VectorReduceAdd(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand());
+}
+
+
+//
+// VectorReduceMul
+//
+Op_VectorReduceMul::Op_VectorReduceMul(LOCATION, Extension *ext, Builder * parent, ActionID aVectorReduceMul, Value *result, Value *value)
+    : OperationR1V1(PASSLOC, aVectorReduceMul, ext, parent, result, value) {
+
+}
+
+Operation *
+Op_VectorReduceMul::clone(LOCATION, Builder *b, OperationCloner *cloner) const {
+    return new Op_VectorReduceMul(PASSLOC, this->_ext, b, this->action(), cloner->result(), cloner->operand());
+}
+
+} // namespace Vector
+} // namespace JitBuilder
+} // namespace OMR
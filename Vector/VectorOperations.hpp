@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef VECTOROPERATIONS_INCL
+#define VECTOROPERATIONS_INCL
+
+#include <vector>
+#include "Operation.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Vector {
+
+// None of these operations have a jbgen(): VectorLowering must replace them before JB1 code generation
+
+class Op_VectorAdd : public OperationR1V2 {
+    friend class VectorExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+
+protected:
+    Op_VectorAdd(LOCATION, Extension *ext, Builder * parent, ActionID aVectorAdd, Value *result, Value *left, Value *right);
+};
+
+class Op_VectorSub : public OperationR1V2 {
+    friend class VectorExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+
+protected:
+    Op_VectorSub(LOCATION, Extension *ext, Builder * parent, ActionID aVectorSub, Value *result, Value *left, Value *right);
+};
+
+class Op_VectorMul : public OperationR1V2 {
+    friend class VectorExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+
+protected:
+    Op_VectorMul(LOCATION, Extension *ext, Builder * parent, ActionID aVectorMul, Value *result, Value *left, Value *right);
+};
+
+// loads numLanes consecutive elements starting at address
+class Op_VectorLoadAt : public OperationR1V1T1 {
+    friend class VectorExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+
+protected:
+    Op_VectorLoadAt(LOCATION, Extension *ext, Builder * parent, ActionID aVectorLoadAt, Value *result, const Type *vectorType, Value *address);
+};
+
+// stores the lanes of value to numLanes consecutive elements starting at address
+class Op_VectorStoreAt : public OperationR0V2 {
+    friend class VectorExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+
+protected:
+    Op_VectorStoreAt(LOCATION, Extension *ext, Builder * parent, ActionID aVectorStoreAt, Value *address, Value *value);
+};
+
+class Op_VectorBroadcast : public OperationR1V1T1 {
+    friend class VectorExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+
+protected:
+    Op_VectorBroadcast(LOCATION, Extension *ext, Builder * parent, ActionID aVectorBroadcast, Value *result, const Type *vectorType, Value *value);
+};
+
+// lane l of the result is lane lane(l) of the operand
+class Op_VectorShuffle : public OperationR1V1 {
+    friend class VectorExtension;
+public:
+    virtual size_t size() const { return sizeof(Op_VectorShuffle); }
+    int32_t numLanes() const { return _lanes.size(); }
+    int32_t lane(int32_t l) const { return _lanes[l]; }
+
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+    virtual void write(TextWriter & w) const;
+
+protected:
+    Op_VectorShuffle(LOCATION, Extension *ext, Builder * parent, ActionID aVectorShuffle, Value *result, Value *value, const std::vector<int32_t> & lanes);
+
+    std::vector<int32_t> _lanes;
+};
+
+class Op_VectorReduceAdd : public OperationR1V1 {
+    friend class VectorExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+
+protected:
+    Op_VectorReduceAdd(LOCATION, Extension *ext, Builder * parent, ActionID aVectorReduceAdd, Value *result, Value *value);
+};
+
+class Op_VectorReduceMul : public OperationR1V1 {
+    friend class VectorExtension;
+public:
+    virtual Operation * clone(LOCATION, Builder *b, OperationCloner *cloner) const;
+
+protected:
+    Op_VectorReduceMul(LOCATION, Extension *ext, Builder * parent, ActionID aVectorReduceMul, Value *result, Value *value);
+};
+
+} // namespace Vector
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(VECTOROPERATIONS_INCL)
+
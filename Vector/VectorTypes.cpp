@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "Extension.hpp"
+#include "Mapper.hpp"
+#include "TextWriter.hpp"
+#include "VectorTypes.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+namespace Vector {
+
+TypeKind VectorLayoutType::TYPEKIND = Type::kindService.assignKind(KindService::AnyKind, "VectorLayout");
+
+VectorLayoutType::VectorLayoutType(LOCATION, Extension *ext, std::string name, const Type *elementType, int32_t numLanes)
+    : Type(PASSLOC, TYPEKIND, ext, name, numLanes * elementType->size())
+    , _elementType(elementType)
+    , _numLanes(numLanes) {
+
+}
+
+std::string
+VectorLayoutType::to_string(bool useHeader) const {
+    std::string s = Type::base_string(useHeader);
+    return s.append(std::string("vectorLayoutType element t")).append(std::to_string(_elementType->id()))
+            .append(std::string(" lanes ")).append(std::to_string(_numLanes));
+}
+
+void
+VectorLayoutType::explodeAsLayout(TypeReplacer *repl, size_t baseOffset, TypeMapper *m) const {
+    for (int32_t l=0;l < _numLanes;l++) {
+        std::string laneName = std::string("lane") + std::to_string(l);
+        m->add(_elementType, laneName, baseOffset + l * _elementType->size());
+    }
+}
+
+
+TypeKind VectorType::TYPEKIND = Type::kindService.assignKind(KindService::AnyKind, "Vector");
+
+VectorType::VectorType(LOCATION, Extension *ext, std::string name, const VectorLayoutType *layout)
+    : Type(PASSLOC, TYPEKIND, ext, name, layout->size(), layout)
+    , _elementType(layout->elementType())
+    , _numLanes(layout->numLanes()) {
+
+}
+
+VectorType *
+VectorType::create(LOCATION, Extension *ext, const Type *elementType, int32_t numLanes) {
+    std::string name = elementType->name() + std::string("x") + std::to_string(numLanes);
+    const VectorLayoutType *layout = new VectorLayoutType(PASSLOC, ext, name + std::string("Lanes"), elementType, numLanes);
+    return new VectorType(PASSLOC, ext, name, layout);
+}
+
+std::string
+VectorType::to_string(bool useHeader) const {
+    std::string s = Type::base_string(useHeader);
+    return s.append(std::string("vectorType element t")).append(std::to_string(_elementType->id()))
+            .append(std::string(" lanes ")).append(std::to_string(_numLanes));
+}
+
+void
+VectorType::printValue(TextWriter &w, const void *p) const {
+    const uint8_t *lane = reinterpret_cast<const uint8_t *>(p);
+    w << name() << " [";
+    for (int32_t l=0;l < _numLanes;l++) {
+        if (l > 0)
+            w << ", ";
+        _elementType->printValue(w, lane);
+        lane += _elementType->size() / 8;
+    }
+    w << "]";
+}
+
+} // namespace Vector
+} // namespace JitBuilder
+} // namespace OMR
@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef VECTORTYPES_INCL
+#define VECTORTYPES_INCL
+
+#include <stdint.h>
+#include <string>
+#include "Type.hpp"
+
+namespace OMR {
+namespace JitBuilder {
+
+class Extension;
+class TextWriter;
+class TypeReplacer;
+
+namespace Vector {
+
+class VectorExtension;
+
+// The layout of a VectorType: numLanes consecutive values of the element type. Exploding a
+// vector Value through this layout produces one Value per lane, named "lane0", "lane1", ...
+class VectorLayoutType : public Type {
+    friend class VectorType;
+
+public:
+    static TypeKind TYPEKIND;
+
+    const Type *elementType() const { return _elementType; }
+    int32_t numLanes() const { return _numLanes; }
+
+    virtual std::string to_string(bool useHeader=false) const;
+    virtual bool canBeLayout() const { return true; }
+    virtual void explodeAsLayout(TypeReplacer *repl, size_t baseOffset, TypeMapper *m) const;
+
+protected:
+    VectorLayoutType(LOCATION, Extension *ext, std::string name, const Type *elementType, int32_t numLanes);
+
+    const Type *_elementType;
+    int32_t _numLanes;
+};
+
+// A fixed width vector of numLanes values of a primitive element type. Vector Types have no
+// representation in the JB1 code generator, so they must be lowered (see VectorLowering) to
+// their lanes before code generation.
+class VectorType : public Type {
+    friend class VectorExtension;
+
+public:
+    static TypeKind TYPEKIND;
+
+    const Type *elementType() const { return _elementType; }
+    int32_t numLanes() const { return _numLanes; }
+    const VectorLayoutType *laneLayout() const { return static_cast<const VectorLayoutType *>(_layout); }
+
+    virtual std::string to_string(bool useHeader=false) const;
+    virtual void printValue(TextWriter &w, const void *p) const;
+
+protected:
+    VectorType(LOCATION, Extension *ext, std::string name, const VectorLayoutType *layout);
+
+    static VectorType * create(LOCATION, Extension *ext, const Type *elementType, int32_t numLanes);
+
+    const Type *_elementType;
+    int32_t _numLanes;
+};
+
+} // namespace Vector
+} // namespace JitBuilder
+} // namespace OMR
+
+#endif // defined(VECTORTYPES_INCL)
+
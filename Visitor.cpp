@@ -33,7 +33,8 @@ Visitor::Visitor(Compiler *compiler, std::string name, bool visitAppendedBuilder
     : Pass(compiler, name)
     , _comp(NULL)
     , _aborted(false)
-    , _visitAppendedBuilders(visitAppendedBuilders) {
+    , _visitAppendedBuilders(visitAppendedBuilders)
+    , _visitColdBuildersLast(false) {
 }
 
 CompilerReturnCode
@@ -53,7 +54,9 @@ Visitor::start(Compilation *comp) {
 
     {
         BuilderWorklist worklist;
-        std::vector<bool> visited(_comp->maxBuilderID());
+        BuilderWorklist coldWorklist;
+        bool deferCold = _visitColdBuildersLast;
+        std::vector<bool> visited(_comp->maxBuilderID()+1);
         _comp->addInitialBuildersToWorklist(worklist);
 
         visitPreCompilation(_comp);
@@ -62,8 +65,20 @@ Visitor::start(Compilation *comp) {
             if (_aborted)
                 break;
             Builder *b = worklist.back();
-            visitBuilder(b, visited, worklist);
-            worklist.pop_back();
+            if (deferCold && b->isCold()) {
+                coldWorklist.push_back(b);
+                worklist.pop_back();
+            }
+            else {
+                visitBuilder(b, visited, worklist);
+                worklist.pop_back();
+            }
+
+            if (worklist.empty() && deferCold) {
+                // cold Builders are visited (and so laid out) after all the others
+                deferCold = false;
+                worklist.insert(worklist.end(), coldWorklist.rbegin(), coldWorklist.rend());
+            }
         }
     }
 
@@ -83,7 +98,7 @@ Visitor::abort() {
 void
 Visitor::start(Builder * b) {
     BuilderWorklist worklist;
-    std::vector<bool> visited(_comp->maxBuilderID());
+    std::vector<bool> visited(_comp->maxBuilderID()+1);
     visitBuilder(b, visited, worklist);
 }
 
@@ -95,6 +110,8 @@ Visitor::start(Operation * op) {
 void
 Visitor::visitBuilder(Builder *b, std::vector<bool> & visited, BuilderWorklist & worklist) {
     int64_t id = b->id();
+    if (id >= visited.size())
+        visited.resize(id+1); // builder was created after the visit started
     if (visited[id])
         return;
 
@@ -113,10 +130,19 @@ Visitor::visitOperations(Builder *b, std::vector<bool> & visited, BuilderWorklis
 
         for (BuilderIterator bIt = op->BuildersBegin(); bIt != op->BuildersEnd(); bIt++) {
             Builder * inner_b = *bIt;
-            if (inner_b && !visited[inner_b->id()])
+            if (inner_b && (inner_b->id() >= visited.size() || !visited[inner_b->id()]))
                 worklist.push_front(inner_b);
         }
     }
+
+    // Builders only reached by falling off the end of b
+    ControlFlowEdgeVector edges;
+    b->controlFlowEdges(edges);
+    for (auto it = edges.begin(); it != edges.end(); it++) {
+        Builder * next_b = it->second;
+        if (next_b->id() >= visited.size() || !visited[next_b->id()])
+            worklist.push_front(next_b);
+    }
 }
 
 void
@@ -67,6 +67,7 @@ protected:
     Compilation *_comp;
     bool _aborted;
     bool _visitAppendedBuilders;
+    bool _visitColdBuildersLast; // code generators set this so cold Builders are laid out after the others
 };
 
 } // namespace JitBuilder
@@ -50,8 +50,8 @@ MatMult::MatMult(Compiler * compiler, Base::BaseExtension *base, const Type *ele
 
     DefineName("matmult");
 
-    // C = A * B, all NxN matrices
-    _symC = DefineParameter("C", _pElementType);
+    // C = A * B, all NxN matrices, and C must not overlap A or B
+    _symC = DefineParameter("C", _pElementType, true);
     _symA = DefineParameter("A", _pElementType);
     _symB = DefineParameter("B", _pElementType);
     _symN = DefineParameter("N", base->Int32);
@@ -21,14 +21,44 @@
 
 #include <dlfcn.h>
 #include <limits>
+#include <math.h>
 #include <stdio.h>
+#include <string.h>
+#include <vector>
 #include "gtest/gtest.h"
 #include "Compiler.hpp"
+#include "ControlFlowGraph.hpp"
+#include "DominatorTree.hpp"
+#include "Base/AliasAnalysis.hpp"
 #include "Base/BaseExtension.hpp"
+#include "Base/ColdBuilderLayout.hpp"
+#include "Base/ConstantFolding.hpp"
 #include "Base/ControlOperations.hpp"
+#include "Base/DivisionByConstant.hpp"
+#include "Base/FMAContraction.hpp"
 #include "Base/Function.hpp"
 #include "Base/FunctionCompilation.hpp"
+#include "Base/FunctionProfile.hpp"
+#include "Base/IfConversion.hpp"
+#include "Base/Inliner.hpp"
+#include "Base/LocalForwarding.hpp"
+#include "Base/LoopNestOptimizer.hpp"
+#include "Base/LoopUnroller.hpp"
+#include "Base/Outliner.hpp"
+#include "Base/ProfileFeedback.hpp"
+#include "Base/ProfileInstrumentation.hpp"
+#include "Base/SSAConstruction.hpp"
+#include "Base/SSADestruction.hpp"
+#include "Base/ScalarReplacement.hpp"
+#include "Base/StrengthReduction.hpp"
+#include "JB1CodeGenerator.hpp"
+#include "Liveness.hpp"
+#include "LoopNest.hpp"
+#include "Operation.hpp"
+#include "Strategy.hpp"
 #include "TextWriter.hpp"
+#include "Value.hpp"
+#include "Visitor.hpp"
 
 
 using namespace OMR::JitBuilder;
@@ -107,6 +137,21 @@ TEST(BaseExtension, checkVersionFail) {
     FuncProto *f = func.nativeEntry<FuncProto *>(); \
     assert(f)
 
+#define COMPILE_FUNC_WITH_PASS(FuncClass, FuncProto, f, PassClass, DO_LOGGING) \
+    Compiler c("testBase"); \
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>(); \
+    FuncClass func(&c, ext); \
+    Base::FunctionCompilation *comp = func.comp(); \
+    TextWriter logger(comp, std::cout, std::string("    ")); \
+    TextWriter *log = (DO_LOGGING) ? &logger : NULL; \
+    Strategy *strategy = new Strategy(&c, #PassClass); \
+    strategy->addPass(new PassClass(&c)) \
+            ->addPass(new JB1CodeGenerator(&c)); \
+    CompilerReturnCode result = func.Compile(log, strategy->id()); \
+    EXPECT_EQ((int)result, (int)c.CompileSuccessful) << "Compiled function ok"; \
+    FuncProto *f = func.nativeEntry<FuncProto *>(); \
+    assert(f)
+
 #define COMPILE_FUNC_TO_FAIL(FuncClass, expectedFailureCode, DO_LOGGING) \
     Compiler c("testBase"); \
     Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>(); \
@@ -977,3 +1022,1796 @@ TESTINVALIDFORLOOP(Int32,Int16,Int32,Int32)
 TESTINVALIDFORLOOP(Int32,Int64,Int32,Int32)
 TESTINVALIDFORLOOP(Int32,Int32,Float32,Int32)
 TESTINVALIDFORLOOP(Int32,Int32,Int32,Float64)
+
+static int32_t
+countActions(Builder *b, ActionID a) {
+    int32_t count = 0;
+    for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+        if ((*opIt)->action() == a)
+            count++;
+    }
+    return count;
+}
+
+// counts Loads and Stores of locals that are not parameters, in every builder of comp
+static int32_t
+countLocalAccesses(Compilation *comp, Base::BaseExtension *ext) {
+    int32_t count = 0;
+    for (BuilderIterator bIt = comp->buildersBegin(); bIt != comp->buildersEnd(); bIt++) {
+        Builder *b = *bIt;
+        for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+            Operation *op = *opIt;
+            if (op->action() != ext->aLoad && op->action() != ext->aStore)
+                continue;
+            Symbol *sym = op->symbol();
+            if (sym->isKind<Base::LocalSymbol>() && !sym->isKind<Base::ParameterSymbol>())
+                count++;
+        }
+    }
+    return count;
+}
+
+// Test function that sums column k of an n x n matrix, whose address computation
+// IndexAt(a, Add(Mul(i, n), k)) is strength reduced to a pointer bumped by n each iteration
+BASE_FUNC(SumColumnFunction, "0", "SumColumn.cpp", Builder *_body, \
+    _x, { \
+        DefineReturnType(_x->Int32); \
+        DefineParameter("a", PointerTo(LOC, _x->Int32)); \
+        DefineParameter("n", _x->Int32); \
+        DefineParameter("k", _x->Int32); \
+        DefineLocal("i", _x->Int32); \
+        DefineLocal("sum", _x->Int32); \
+        }, \
+    b, { \
+        auto sumSym = LookupLocal("sum"); \
+        _x->Store(LOC, b, sumSym, _x->ConstInt32(LOC, b, 0)); \
+        auto iSym = LookupLocal("i"); \
+        Value *n = _x->Load(LOC, b, LookupLocal("n")); \
+        Base::ForLoopBuilder *loop = _x->ForLoopUp(LOC, b, iSym, _x->ConstInt32(LOC, b, 0), n, _x->ConstInt32(LOC, b, 1)); { \
+            Builder *body = loop->loopBody(); \
+            _body = body; \
+            Value *i = _x->Load(LOC, body, iSym); \
+            Value *index = _x->Add(LOC, body, _x->Mul(LOC, body, i, _x->Load(LOC, body, LookupLocal("n"))), _x->Load(LOC, body, LookupLocal("k"))); \
+            Value *element = _x->LoadAt(LOC, body, _x->IndexAt(LOC, body, _x->Load(LOC, body, LookupLocal("a")), index)); \
+            _x->Store(LOC, body, sumSym, _x->Add(LOC, body, _x->Load(LOC, body, sumSym), element)); \
+        } \
+        _x->Return(LOC, b, _x->Load(LOC, b, sumSym)); \
+        })
+
+TEST(BaseExtension, strengthReduceIndexAtInForLoop) {
+    typedef int32_t (FuncProto)(int32_t *, int32_t, int32_t);
+    COMPILE_FUNC_WITH_PASS(SumColumnFunction, FuncProto, f, Base::StrengthReduction, false);
+    Builder *body = func._body;
+    EXPECT_EQ(countActions(body, ext->aIndexAt), 1) << "Only the pointer increment computes an address in the loop";
+    Operation *update = body->operations().back();
+    EXPECT_EQ(update->action(), ext->aStore) << "Pointer advanced at the end of each iteration";
+    for (OperationIterator opIt = body->OperationsBegin(); opIt != body->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        if (op->action() == ext->aIndexAt) {
+            EXPECT_EQ(op->result(), update->operand()) << "Increment is stored to the pointer";
+            EXPECT_NE(op->operand(1)->definition()->parent(), body) << "Stride computed before the loop";
+        }
+        if (op->action() == ext->aLoadAt) {
+            const Operation *address = op->operand()->definition();
+            EXPECT_EQ(address->action(), ext->aLoad) << "Element address is loaded from the pointer";
+            EXPECT_EQ(address->symbol(), update->symbol()) << "Element address is the strength reduced pointer";
+        }
+    }
+    int32_t m[4*4];
+    for (int32_t e=0;e < 4*4;e++)
+        m[e] = e;
+    EXPECT_EQ(f(m, 4, 0), 0+4+8+12) << "Compiled f(m,4,0) sums column 0";
+    EXPECT_EQ(f(m, 4, 3), 3+7+11+15) << "Compiled f(m,4,3) sums column 3";
+    EXPECT_EQ(f(m, 0, 0), 0) << "Compiled f(m,0,0) sums no elements";
+}
+
+// Test function that sums the first n elements of an array and leaves i in a[n]
+#define SUMARRAYFUNC(name,final_code) \
+    BASE_FUNC(name, "0", #name ".cpp", , \
+        _x, { \
+            DefineReturnType(_x->Int32); \
+            DefineParameter("a", PointerTo(LOC, _x->Int32)); \
+            DefineParameter("n", _x->Int32); \
+            DefineLocal("i", _x->Int32); \
+            DefineLocal("sum", _x->Int32); \
+            }, \
+        b, { \
+            auto sumSym = LookupLocal("sum"); \
+            _x->Store(LOC, b, sumSym, _x->ConstInt32(LOC, b, 0)); \
+            auto iSym = LookupLocal("i"); \
+            Value *final = final_code; \
+            Base::ForLoopBuilder *loop = _x->ForLoopUp(LOC, b, iSym, _x->ConstInt32(LOC, b, 0), final, _x->ConstInt32(LOC, b, 1)); { \
+                Builder *body = loop->loopBody(); \
+                Value *element = _x->LoadAt(LOC, body, _x->IndexAt(LOC, body, _x->Load(LOC, body, LookupLocal("a")), _x->Load(LOC, body, iSym))); \
+                _x->Store(LOC, body, sumSym, _x->Add(LOC, body, _x->Load(LOC, body, sumSym), element)); \
+            } \
+            _x->StoreAt(LOC, b, _x->IndexAt(LOC, b, _x->Load(LOC, b, LookupLocal("a")), _x->Load(LOC, b, iSym)), _x->Load(LOC, b, iSym)); \
+            _x->Return(LOC, b, _x->Load(LOC, b, sumSym)); \
+            })
+
+SUMARRAYFUNC(SumArrayFunction, _x->Load(LOC, b, LookupLocal("n")))
+TEST(BaseExtension, unrollForLoop) {
+    typedef int32_t (FuncProto)(int32_t *, int32_t);
+    COMPILE_FUNC_WITH_PASS(SumArrayFunction, FuncProto, f, Base::LoopUnroller, false);
+    for (int32_t n=0;n < 10;n++) {
+        int32_t a[11];
+        int32_t expected = 0;
+        for (int32_t e=0;e < 11;e++)
+            a[e] = e+1;
+        for (int32_t e=0;e < n;e++)
+            expected += a[e];
+        EXPECT_EQ(f(a, n), expected) << "Compiled f(a," << n << ") sums " << n << " elements";
+        EXPECT_EQ(a[n], n) << "Loop variable is " << n << " after the loop";
+    }
+}
+
+SUMARRAYFUNC(SumFiveFunction, _x->ConstInt32(LOC, b, 5))
+TEST(BaseExtension, fullyUnrollForLoop) {
+    typedef int32_t (FuncProto)(int32_t *, int32_t);
+    COMPILE_FUNC_WITH_PASS(SumFiveFunction, FuncProto, f, Base::LoopUnroller, false);
+    int32_t a[6] = { 1, 2, 3, 4, 5, 6 };
+    EXPECT_EQ(f(a, 0), 1+2+3+4+5) << "Compiled f(a) sums 5 elements";
+    EXPECT_EQ(a[5], 5) << "Loop variable is 5 after the loop";
+}
+
+// Test function that counts the iterations of a loop from "from" up to "to"
+BASE_FUNC(CountIterationsFunction, "0", "CountIterations.cpp", , \
+    _x, { \
+        DefineReturnType(_x->Int32); \
+        DefineParameter("from", _x->Int32); \
+        DefineParameter("to", _x->Int32); \
+        DefineLocal("i", _x->Int32); \
+        DefineLocal("count", _x->Int32); \
+        }, \
+    b, { \
+        auto countSym = LookupLocal("count"); \
+        _x->Store(LOC, b, countSym, _x->ConstInt32(LOC, b, 0)); \
+        Base::ForLoopBuilder *loop = _x->ForLoopUp(LOC, b, LookupLocal("i"), _x->Load(LOC, b, LookupLocal("from")), _x->Load(LOC, b, LookupLocal("to")), _x->ConstInt32(LOC, b, 1)); { \
+            Builder *body = loop->loopBody(); \
+            _x->Store(LOC, body, countSym, _x->Add(LOC, body, _x->Load(LOC, body, countSym), _x->ConstInt32(LOC, body, 1))); \
+        } \
+        _x->Return(LOC, b, _x->Load(LOC, b, countSym)); \
+        })
+
+TEST(BaseExtension, unrollForLoopNearMinimum) {
+    typedef int32_t (FuncProto)(int32_t, int32_t);
+    COMPILE_FUNC_WITH_PASS(CountIterationsFunction, FuncProto, f, Base::LoopUnroller, false);
+    int32_t min = std::numeric_limits<int32_t>::min();
+    for (int32_t n=0;n < 10;n++)
+        EXPECT_EQ(f(min, min+n), n) << "Compiled f(min, min+" << n << ") runs " << n << " iterations";
+    EXPECT_EQ(f(-5, 5), 10) << "Compiled f(-5, 5) runs 10 iterations";
+}
+
+// Test function that computes c += a * b for n x n matrices with the loops in i-j-k order;
+// LoopNestOptimizer interchanges them to i-k-j and tiles them, as the matrices are noAlias. Returns the final value of i
+BASE_FUNC(MatMultFunction, "0", "MatMult.cpp", , \
+    _x, { \
+        DefineReturnType(_x->Int32); \
+        DefineParameter("c", PointerTo(LOC, _x->Int32), true); \
+        DefineParameter("a", PointerTo(LOC, _x->Int32), true); \
+        DefineParameter("b", PointerTo(LOC, _x->Int32), true); \
+        DefineParameter("n", _x->Int32); \
+        DefineLocal("i", _x->Int32); \
+        DefineLocal("j", _x->Int32); \
+        DefineLocal("k", _x->Int32); \
+        }, \
+    b, { \
+        auto iSym = LookupLocal("i"); \
+        auto jSym = LookupLocal("j"); \
+        auto kSym = LookupLocal("k"); \
+        Value *zero = _x->ConstInt32(LOC, b, 0); \
+        Value *one = _x->ConstInt32(LOC, b, 1); \
+        Value *n = _x->Load(LOC, b, LookupLocal("n")); \
+        Base::ForLoopBuilder *iLoop = _x->ForLoopUp(LOC, b, iSym, zero, n, one); { \
+            Builder *iBody = iLoop->loopBody(); \
+            Base::ForLoopBuilder *jLoop = _x->ForLoopUp(LOC, iBody, jSym, zero, n, one); { \
+                Builder *jBody = jLoop->loopBody(); \
+                Base::ForLoopBuilder *kLoop = _x->ForLoopUp(LOC, jBody, kSym, zero, n, one); { \
+                    Builder *kBody = kLoop->loopBody(); \
+                    Value *i = _x->Load(LOC, kBody, iSym); \
+                    Value *j = _x->Load(LOC, kBody, jSym); \
+                    Value *k = _x->Load(LOC, kBody, kSym); \
+                    Value *N = _x->Load(LOC, kBody, LookupLocal("n")); \
+                    Value *cij = _x->IndexAt(LOC, kBody, _x->Load(LOC, kBody, LookupLocal("c")), _x->Add(LOC, kBody, _x->Mul(LOC, kBody, i, N), j)); \
+                    Value *aik = _x->LoadAt(LOC, kBody, _x->IndexAt(LOC, kBody, _x->Load(LOC, kBody, LookupLocal("a")), _x->Add(LOC, kBody, _x->Mul(LOC, kBody, i, N), k))); \
+                    Value *bkj = _x->LoadAt(LOC, kBody, _x->IndexAt(LOC, kBody, _x->Load(LOC, kBody, LookupLocal("b")), _x->Add(LOC, kBody, _x->Mul(LOC, kBody, k, N), j))); \
+                    _x->StoreAt(LOC, kBody, cij, _x->Add(LOC, kBody, _x->LoadAt(LOC, kBody, cij), _x->Mul(LOC, kBody, aik, bkj))); \
+                } \
+            } \
+        } \
+        _x->Return(LOC, b, _x->Load(LOC, b, iSym)); \
+        })
+
+TEST(BaseExtension, interchangeAndTileLoopNest) {
+    typedef int32_t (FuncProto)(int32_t *, int32_t *, int32_t *, int32_t);
+    COMPILE_FUNC_WITH_PASS(MatMultFunction, FuncProto, f, Base::LoopNestOptimizer, false);
+    const int32_t sizes[] = { 0, 3, 37 };
+    for (int32_t s=0;s < 3;s++) {
+        int32_t n = sizes[s];
+        std::vector<int32_t> a(n*n+1), bm(n*n+1), c(n*n+1, 1), expected(n*n+1, 1);
+        for (int32_t e=0;e < n*n;e++) {
+            a[e] = e % 7;
+            bm[e] = e % 5 - 2;
+        }
+        for (int32_t i=0;i < n;i++)
+            for (int32_t j=0;j < n;j++)
+                for (int32_t k=0;k < n;k++)
+                    expected[i*n+j] += a[i*n+k] * bm[k*n+j];
+        EXPECT_EQ(f(c.data(), a.data(), bm.data(), n), n) << "Compiled f(c,a,b," << n << ") leaves i at " << n;
+        EXPECT_EQ(c, expected) << "Compiled f(c,a,b," << n << ") computes c += a * b";
+    }
+}
+
+// Test function that adds the transpose of b to the n x n matrix a; a and b may be the same matrix
+BASE_FUNC(AddTransposeFunction, "0", "AddTranspose.cpp", , \
+    _x, { \
+        DefineReturnType(_x->NoType); \
+        DefineParameter("a", PointerTo(LOC, _x->Int32)); \
+        DefineParameter("b", PointerTo(LOC, _x->Int32)); \
+        DefineParameter("n", _x->Int32); \
+        DefineLocal("i", _x->Int32); \
+        DefineLocal("j", _x->Int32); \
+        }, \
+    b, { \
+        Value *zero = _x->ConstInt32(LOC, b, 0); \
+        Value *one = _x->ConstInt32(LOC, b, 1); \
+        Value *n = _x->Load(LOC, b, LookupLocal("n")); \
+        Base::ForLoopBuilder *iLoop = _x->ForLoopUp(LOC, b, LookupLocal("i"), zero, n, one); { \
+            Builder *iBody = iLoop->loopBody(); \
+            Base::ForLoopBuilder *jLoop = _x->ForLoopUp(LOC, iBody, LookupLocal("j"), zero, n, one); { \
+                Builder *jBody = jLoop->loopBody(); \
+                Value *i = _x->Load(LOC, jBody, LookupLocal("i")); \
+                Value *j = _x->Load(LOC, jBody, LookupLocal("j")); \
+                Value *N = _x->Load(LOC, jBody, LookupLocal("n")); \
+                Value *aij = _x->IndexAt(LOC, jBody, _x->Load(LOC, jBody, LookupLocal("a")), _x->Add(LOC, jBody, _x->Mul(LOC, jBody, i, N), j)); \
+                Value *bji = _x->LoadAt(LOC, jBody, _x->IndexAt(LOC, jBody, _x->Load(LOC, jBody, LookupLocal("b")), _x->Add(LOC, jBody, _x->Mul(LOC, jBody, j, N), i))); \
+                _x->StoreAt(LOC, jBody, aij, _x->Add(LOC, jBody, _x->LoadAt(LOC, jBody, aij), bji)); \
+            } \
+        } \
+        _x->Return(LOC, b); \
+        })
+
+TEST(BaseExtension, loopNestWithAliasedArraysIsNotTransformed) {
+    typedef void (FuncProto)(int32_t *, int32_t *, int32_t);
+    COMPILE_FUNC_WITH_PASS(AddTransposeFunction, FuncProto, f, Base::LoopNestOptimizer, false);
+    Builder *entry = func.builderEntry();
+    for (OperationIterator opIt = entry->OperationsBegin(); opIt != entry->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        if (op->action() == ext->aForLoopUp)
+            EXPECT_EQ(static_cast<Base::Op_ForLoopUp *>(op)->loopVariable()->name(), "i") << "Entry still holds the original i loop";
+    }
+
+    int32_t n = 40;
+    std::vector<int32_t> a(n*n), expected(n*n);
+    for (int32_t e=0;e < n*n;e++)
+        a[e] = expected[e] = e % 11 - 5;
+    for (int32_t i=0;i < n;i++)
+        for (int32_t j=0;j < n;j++)
+            expected[i*n+j] += expected[j*n+i];
+    f(a.data(), a.data(), n);
+    EXPECT_EQ(a, expected) << "Compiled f(a,a,n) updates a in the original order";
+}
+
+// Test function that doubles each element of a, a row of m elements at a time, and adds an element of b:
+// if m < n then the rows overlap, so the elements must be updated in the original order
+BASE_FUNC(OverlappingRowsFunction, "0", "OverlappingRows.cpp", , \
+    _x, { \
+        DefineReturnType(_x->Int32); \
+        DefineParameter("a", PointerTo(LOC, _x->Int32), true); \
+        DefineParameter("b", PointerTo(LOC, _x->Int32), true); \
+        DefineParameter("n", _x->Int32); \
+        DefineParameter("m", _x->Int32); \
+        DefineLocal("i", _x->Int32); \
+        DefineLocal("j", _x->Int32); \
+        }, \
+    b, { \
+        Value *zero = _x->ConstInt32(LOC, b, 0); \
+        Value *one = _x->ConstInt32(LOC, b, 1); \
+        Value *n = _x->Load(LOC, b, LookupLocal("n")); \
+        Base::ForLoopBuilder *iLoop = _x->ForLoopUp(LOC, b, LookupLocal("i"), zero, n, one); { \
+            Builder *iBody = iLoop->loopBody(); \
+            Base::ForLoopBuilder *jLoop = _x->ForLoopUp(LOC, iBody, LookupLocal("j"), zero, n, one); { \
+                Builder *jBody = jLoop->loopBody(); \
+                Value *i = _x->Load(LOC, jBody, LookupLocal("i")); \
+                Value *j = _x->Load(LOC, jBody, LookupLocal("j")); \
+                Value *ai = _x->IndexAt(LOC, jBody, _x->Load(LOC, jBody, LookupLocal("a")), _x->Add(LOC, jBody, _x->Mul(LOC, jBody, i, _x->Load(LOC, jBody, LookupLocal("m"))), j)); \
+                Value *bj = _x->LoadAt(LOC, jBody, _x->IndexAt(LOC, jBody, _x->Load(LOC, jBody, LookupLocal("b")), _x->Add(LOC, jBody, _x->Mul(LOC, jBody, j, _x->Load(LOC, jBody, LookupLocal("n"))), i))); \
+                Value *ax = _x->LoadAt(LOC, jBody, ai); \
+                _x->StoreAt(LOC, jBody, ai, _x->Add(LOC, jBody, _x->Add(LOC, jBody, ax, ax), bj)); \
+            } \
+        } \
+        _x->Return(LOC, b, _x->Load(LOC, b, LookupLocal("j"))); \
+        })
+
+TEST(BaseExtension, loopNestWithOverlappingRowsRunsOriginalNest) {
+    typedef int32_t (FuncProto)(int32_t *, int32_t *, int32_t, int32_t);
+    COMPILE_FUNC_WITH_PASS(OverlappingRowsFunction, FuncProto, f, Base::LoopNestOptimizer, false);
+    int32_t n = 40;
+    for (int32_t m=n-2;m <= n;m++) {
+        std::vector<int32_t> a(n*n, 1), bm(n*n), expected(n*n, 1);
+        for (int32_t e=0;e < n*n;e++)
+            bm[e] = e % 3 - 1;
+        for (int32_t i=0;i < n;i++)
+            for (int32_t j=0;j < n;j++)
+                expected[i*m+j] = 2*expected[i*m+j] + bm[j*n+i];
+        EXPECT_EQ(f(a.data(), bm.data(), n, m), n) << "Compiled f(a,b," << n << "," << m << ") leaves j at " << n;
+        EXPECT_EQ(a, expected) << "Compiled f(a,b," << n << "," << m << ") updates a in the original order";
+    }
+}
+
+// Test functions that are inlined: SquarePlusOne has only a final Return, FirstOrDefault also returns from inside a loop
+BASE_FUNC(SquarePlusOneFunction, "0", "SquarePlusOne.cpp", , \
+    _x, { \
+        DefineReturnType(_x->Int32); \
+        DefineParameter("x", _x->Int32); \
+        }, \
+    b, { \
+        Value *x = _x->Load(LOC, b, LookupLocal("x")); \
+        _x->Return(LOC, b, _x->Add(LOC, b, _x->Mul(LOC, b, x, x), _x->ConstInt32(LOC, b, 1))); \
+        })
+
+BASE_FUNC(FirstOrDefaultFunction, "0", "FirstOrDefault.cpp", , \
+    _x, { \
+        DefineReturnType(_x->Int32); \
+        DefineParameter("a", PointerTo(LOC, _x->Int32)); \
+        DefineParameter("n", _x->Int32); \
+        DefineLocal("i", _x->Int32); \
+        }, \
+    b, { \
+        Base::ForLoopBuilder *loop = _x->ForLoopUp(LOC, b, LookupLocal("i"), _x->ConstInt32(LOC, b, 0), _x->Load(LOC, b, LookupLocal("n")), _x->ConstInt32(LOC, b, 1)); { \
+            Builder *body = loop->loopBody(); \
+            _x->Return(LOC, body, _x->LoadAt(LOC, body, _x->Load(LOC, body, LookupLocal("a")))); \
+        } \
+        _x->Return(LOC, b, _x->ConstInt32(LOC, b, -1)); \
+        })
+
+// Test function that returns SquarePlusOne(FirstOrDefault(a, n)) + i, where i is its own local
+class InlineCallsFunction : public Base::Function {
+public:
+    InlineCallsFunction(Compiler *c, Base::BaseExtension *x, Base::Function *square, Base::Function *first)
+        : Base::Function(c)
+        , _x(x) {
+        DefineName("InlineCalls");
+        DefineLine("0");
+        DefineFile("InlineCalls.cpp");
+        DefineReturnType(_x->Int32);
+        DefineParameter("a", PointerTo(LOC, _x->Int32));
+        DefineParameter("n", _x->Int32);
+        DefineLocal("i", _x->Int32);
+        _square = DefineFunction(LOC, square);
+        _first = DefineFunction(LOC, first);
+    }
+    virtual bool buildIL() {
+        Builder *b = builderEntry();
+        _x->Store(LOC, b, LookupLocal("i"), _x->ConstInt32(LOC, b, 100));
+        Value *first = _x->Call(LOC, b, _first, _x->Load(LOC, b, LookupLocal("a")), _x->Load(LOC, b, LookupLocal("n")));
+        Value *square = _x->Call(LOC, b, _square, first);
+        _x->Return(LOC, b, _x->Add(LOC, b, square, _x->Load(LOC, b, LookupLocal("i"))));
+        return true;
+    }
+protected:
+    Base::BaseExtension *_x;
+    Base::FunctionSymbol *_square;
+    Base::FunctionSymbol *_first;
+};
+
+TEST(BaseExtension, inlineCalls) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+    SquarePlusOneFunction square(&c, ext);
+    EXPECT_EQ((int)square.Compile(), (int)c.CompileSuccessful) << "Compiled SquarePlusOne ok";
+    FirstOrDefaultFunction first(&c, ext);
+    EXPECT_EQ((int)first.Compile(), (int)c.CompileSuccessful) << "Compiled FirstOrDefault ok";
+
+    InlineCallsFunction func(&c, ext, &square, &first);
+    Strategy *strategy = new Strategy(&c, "Inliner");
+    strategy->addPass(new Base::Inliner(&c))
+            ->addPass(new JB1CodeGenerator(&c));
+    EXPECT_EQ((int)func.Compile(NULL, strategy->id()), (int)c.CompileSuccessful) << "Compiled InlineCalls ok";
+    typedef int32_t (FuncProto)(int32_t *, int32_t);
+    FuncProto *f = func.nativeEntry<FuncProto *>();
+    int32_t a[1] = { 3 };
+    EXPECT_EQ(f(a, 1), 3*3+1+100) << "Compiled f(a,1) returns a[0]*a[0]+1+100";
+    EXPECT_EQ(f(a, 0), (-1)*(-1)+1+100) << "Compiled f(a,0) returns (-1)*(-1)+1+100";
+}
+
+// Test function that returns the n-th Fibonacci number: once its locals are promoted to Values,
+// the MergeDefs at the end of the loop body swap a and b and must be copied in parallel
+BASE_FUNC(FibonacciFunction, "0", "Fibonacci.cpp", , \
+    _x, { \
+        DefineReturnType(_x->Int64); \
+        DefineParameter("n", _x->Int32); \
+        DefineLocal("i", _x->Int32); \
+        DefineLocal("a", _x->Int64); \
+        DefineLocal("b", _x->Int64); \
+        DefineLocal("t", _x->Int64); \
+        }, \
+    b, { \
+        auto aSym = LookupLocal("a"); \
+        auto bSym = LookupLocal("b"); \
+        auto tSym = LookupLocal("t"); \
+        _x->Store(LOC, b, aSym, _x->ConstInt64(LOC, b, 0)); \
+        _x->Store(LOC, b, bSym, _x->ConstInt64(LOC, b, 1)); \
+        Base::ForLoopBuilder *loop = _x->ForLoopUp(LOC, b, LookupLocal("i"), _x->ConstInt32(LOC, b, 0), _x->Load(LOC, b, LookupLocal("n")), _x->ConstInt32(LOC, b, 1)); { \
+            Builder *body = loop->loopBody(); \
+            _x->Store(LOC, body, tSym, _x->Load(LOC, body, aSym)); \
+            _x->Store(LOC, body, aSym, _x->Load(LOC, body, bSym)); \
+            _x->Store(LOC, body, bSym, _x->Add(LOC, body, _x->Load(LOC, body, tSym), _x->Load(LOC, body, bSym))); \
+        } \
+        _x->Return(LOC, b, _x->Load(LOC, b, aSym)); \
+        })
+
+TEST(BaseExtension, promoteLocalsToValues) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+    FibonacciFunction func(&c, ext);
+    Strategy *strategy = new Strategy(&c, "SSA");
+    strategy->addPass(new Base::SSAConstruction(&c))
+            ->addPass(new Base::SSADestruction(&c))
+            ->addPass(new JB1CodeGenerator(&c));
+    EXPECT_EQ((int)func.Compile(NULL, strategy->id()), (int)c.CompileSuccessful) << "Compiled Fibonacci ok";
+    EXPECT_EQ(countLocalAccesses(func.comp(), ext), 0) << "Loads and Stores of a, b and t removed";
+    typedef int64_t (FuncProto)(int32_t);
+    FuncProto *f = func.nativeEntry<FuncProto *>();
+    int64_t a = 0, b = 1;
+    for (int32_t n=0;n < 20;n++) {
+        EXPECT_EQ(f(n), a) << "Compiled f(" << n << ") returns " << a;
+        int64_t t = a;
+        a = b;
+        b = t + b;
+    }
+}
+
+// Test function that computes the greatest common divisor of two positive numbers by subtraction in a
+// loop built from Goto and IfCmp; the header branches out twice before storing y, so the Values merged
+// at the header must come from the right point on each edge
+BASE_FUNC(GCDWithGotoFunction, "0", "GCDWithGoto.cpp", Builder *_header; Builder *_bigger; Builder *_done, \
+    _x, { \
+        DefineReturnType(_x->Int32); \
+        DefineParameter("a", _x->Int32); \
+        DefineParameter("b", _x->Int32); \
+        DefineLocal("x", _x->Int32); \
+        DefineLocal("y", _x->Int32); \
+        }, \
+    b, { \
+        auto xSym = LookupLocal("x"); \
+        auto ySym = LookupLocal("y"); \
+        _header = _x->OrphanBuilder(LOC, b); \
+        _bigger = _x->OrphanBuilder(LOC, b); \
+        _done = _x->OrphanBuilder(LOC, b); \
+        _x->Store(LOC, b, xSym, _x->Load(LOC, b, LookupLocal("a"))); \
+        _x->Store(LOC, b, ySym, _x->Load(LOC, b, LookupLocal("b"))); \
+        _x->Goto(LOC, b, _header); \
+        _x->IfCmpEqual(LOC, _header, _done, _x->Load(LOC, _header, xSym), _x->Load(LOC, _header, ySym)); \
+        _x->IfCmpGreaterThan(LOC, _header, _bigger, _x->Load(LOC, _header, xSym), _x->Load(LOC, _header, ySym)); \
+        _x->Store(LOC, _header, ySym, _x->Sub(LOC, _header, _x->Load(LOC, _header, ySym), _x->Load(LOC, _header, xSym))); \
+        _x->Goto(LOC, _header, _header); \
+        _x->Store(LOC, _bigger, xSym, _x->Sub(LOC, _bigger, _x->Load(LOC, _bigger, xSym), _x->Load(LOC, _bigger, ySym))); \
+        _x->Goto(LOC, _bigger, _header); \
+        _x->Return(LOC, _done, _x->Load(LOC, _done, xSym)); \
+        })
+
+TEST(BaseExtension, promoteLocalsInGotoLoop) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+    GCDWithGotoFunction func(&c, ext);
+    Strategy *strategy = new Strategy(&c, "SSA");
+    strategy->addPass(new Base::SSAConstruction(&c))
+            ->addPass(new Base::SSADestruction(&c))
+            ->addPass(new JB1CodeGenerator(&c));
+    EXPECT_EQ((int)func.Compile(NULL, strategy->id()), (int)c.CompileSuccessful) << "Compiled GCDWithGoto ok";
+    EXPECT_EQ(countLocalAccesses(func.comp(), ext), 0) << "Loads and Stores of x and y removed";
+    typedef int32_t (FuncProto)(int32_t, int32_t);
+    FuncProto *f = func.nativeEntry<FuncProto *>();
+    EXPECT_EQ(f(48, 18), 6) << "Compiled f(48,18) returns 6";
+    EXPECT_EQ(f(18, 48), 6) << "Compiled f(18,48) returns 6";
+    EXPECT_EQ(f(7, 7), 7) << "Compiled f(7,7) returns 7";
+    EXPECT_EQ(f(17, 5), 1) << "Compiled f(17,5) returns 1";
+}
+
+TEST(BaseExtension, controlFlowGraphOfForLoop) {
+    typedef int32_t (FuncProto)(int32_t *, int32_t);
+    COMPILE_FUNC(SumArrayFunction, FuncProto, f, false);
+    ControlFlowGraph *cfg = comp->cfg();
+    Builder *entry = func.builderEntry();
+    EXPECT_EQ(cfg->numEntries(), 1) << "One entry";
+    EXPECT_EQ(cfg->entry(), entry) << "Entry is the function's entry builder";
+
+    Base::Op_ForLoopUp *loop = NULL;
+    for (OperationIterator opIt = entry->OperationsBegin(); opIt != entry->OperationsEnd(); opIt++) {
+        if ((*opIt)->action() == ext->aForLoopUp)
+            loop = static_cast<Base::Op_ForLoopUp *>(*opIt);
+    }
+    ASSERT_TRUE(loop != NULL) << "Found the ForLoopUp";
+    Builder *body = loop->loopBody();
+    Builder *loopBreak = loop->loopBreak();
+    Builder *loopContinue = loop->loopContinue();
+
+    EXPECT_EQ(cfg->numPredecessors(entry), 0) << "Nothing branches to the entry";
+    EXPECT_EQ(cfg->numSuccessors(entry), 2) << "Entry enters the body or breaks";
+    EXPECT_EQ(cfg->numPredecessors(body), 2) << "Body is entered from the entry and loopContinue";
+    EXPECT_EQ(cfg->numSuccessors(loopContinue), 2) << "loopContinue enters the body or breaks";
+    EXPECT_EQ(cfg->numPredecessors(loopBreak), 2) << "loopBreak is reached from the entry and loopContinue";
+
+    EXPECT_EQ(cfg->rpoNumber(entry), 0) << "Entry is first in reverse postorder";
+    EXPECT_LT(cfg->rpoNumber(body), cfg->rpoNumber(loopContinue)) << "Body precedes loopContinue";
+    EXPECT_LT(cfg->rpoNumber(loopContinue), cfg->rpoNumber(loopBreak)) << "loopContinue precedes loopBreak";
+    EXPECT_EQ((int)cfg->reversePostOrder().size(), 4) << "Four builders are reachable";
+
+    cfg->removeOperation(loop);
+    EXPECT_EQ(cfg->numSuccessors(entry), 0) << "Removing the loop removes its edges";
+    EXPECT_EQ(cfg->rpoNumber(body), -1) << "Body is unreachable without the loop";
+    EXPECT_FALSE(cfg->contains(body)) << "Body is removed with the loop";
+
+    cfg->addOperation(loop);
+    EXPECT_EQ(cfg->numSuccessors(entry), 2) << "Adding the loop restores its edges";
+    EXPECT_EQ(cfg->numPredecessors(body), 2) << "Body edges are restored";
+    EXPECT_EQ((int)cfg->reversePostOrder().size(), 4) << "Four builders are reachable again";
+}
+
+TEST(BaseExtension, dominatorsAndLoopNestOfForLoops) {
+    typedef int32_t (FuncProto)(int32_t *, int32_t *, int32_t *, int32_t);
+    COMPILE_FUNC(MatMultFunction, FuncProto, f, false);
+    ControlFlowGraph *cfg = comp->cfg();
+    DominatorTree dominators(cfg);
+    LoopNest loops(cfg, &dominators);
+
+    // each loop body holds the next loop
+    std::vector<Builder *> bodies;
+    Builder *b = func.builderEntry();
+    while (b != NULL) {
+        Builder *body = NULL;
+        for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+            if ((*opIt)->action() == ext->aForLoopUp)
+                body = static_cast<Base::Op_ForLoopUp *>(*opIt)->loopBody();
+        }
+        if (body != NULL)
+            bodies.push_back(body);
+        b = body;
+    }
+    ASSERT_EQ((int)bodies.size(), 3) << "Found three nested loop bodies";
+
+    Builder *entry = func.builderEntry();
+    EXPECT_EQ(dominators.idom(entry), (Builder *)NULL) << "Entry has no immediate dominator";
+    EXPECT_EQ(dominators.idom(bodies[0]), entry) << "Entry immediately dominates the i loop body";
+    EXPECT_EQ(dominators.idom(bodies[2]), bodies[1]) << "j loop body immediately dominates the k loop body";
+    EXPECT_TRUE(dominators.dominates(entry, bodies[2])) << "Entry dominates the k loop body";
+    EXPECT_FALSE(dominators.dominates(bodies[2], bodies[0])) << "k loop body does not dominate the i loop body";
+    EXPECT_EQ(dominators.depth(bodies[2]), 3) << "k loop body is at depth 3 in the dominator tree";
+
+    EXPECT_EQ(loops.numLoops(), 3) << "Three loops";
+    EXPECT_FALSE(loops.hasIrreducibleControlFlow()) << "Loops are reducible";
+    EXPECT_EQ(loops.loopDepth(entry), 0) << "Entry is not in a loop";
+    for (int32_t l=0;l < 3;l++) {
+        Loop *loop = loops.loopFor(bodies[l]);
+        ASSERT_TRUE(loop != NULL) << "Loop body " << l << " is in a loop";
+        EXPECT_EQ(loop->header(), bodies[l]) << "Loop body " << l << " is its loop's header";
+        EXPECT_EQ(loops.loopDepth(bodies[l]), l+1) << "Loop body " << l << " is at depth " << (l+1);
+        EXPECT_EQ(loop->parent(), (l > 0) ? loops.loopFor(bodies[l-1]) : NULL) << "Loop " << l << " is nested in the previous loop";
+    }
+    EXPECT_TRUE(loops.loopFor(bodies[0])->contains(bodies[2])) << "i loop contains the k loop body";
+}
+
+// Test function that counts i up to n with Goto and IfCmp rather than ForLoopUp; its IL is only built, not compiled
+BASE_FUNC(CountUpWithGotoFunction, "0", "CountUpWithGoto.cpp", Builder *_header; Builder *_body; Builder *_exit, \
+    _x, { \
+        DefineReturnType(_x->Int32); \
+        DefineParameter("n", _x->Int32); \
+        DefineLocal("i", _x->Int32); \
+        }, \
+    b, { \
+        auto iSym = LookupLocal("i"); \
+        _header = _x->OrphanBuilder(LOC, b); \
+        _body = _x->OrphanBuilder(LOC, b); \
+        _exit = _x->OrphanBuilder(LOC, b); \
+        _x->Store(LOC, b, iSym, _x->ConstInt32(LOC, b, 0)); \
+        _x->Goto(LOC, b, _header); \
+        _x->IfCmpGreaterOrEqual(LOC, _header, _exit, _x->Load(LOC, _header, iSym), _x->Load(LOC, _header, LookupLocal("n"))); \
+        _x->Goto(LOC, _header, _body); \
+        _x->Increment(LOC, _body, iSym); \
+        _x->Goto(LOC, _body, _header); \
+        _x->Return(LOC, _exit, _x->Load(LOC, _exit, iSym)); \
+        })
+
+TEST(BaseExtension, loopNestOfGotoLoop) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+    CountUpWithGotoFunction func(&c, ext);
+    ASSERT_TRUE(func.comp()->buildIL()) << "Built IL ok";
+    ControlFlowGraph *cfg = func.comp()->cfg();
+    DominatorTree dominators(cfg);
+    LoopNest loops(cfg, &dominators);
+
+    EXPECT_EQ(dominators.idom(func._header), func.builderEntry()) << "Entry immediately dominates the header";
+    EXPECT_EQ(dominators.idom(func._body), func._header) << "Header immediately dominates the body";
+    EXPECT_EQ(dominators.idom(func._exit), func._header) << "Header immediately dominates the exit";
+
+    EXPECT_EQ(loops.numLoops(), 1) << "One loop";
+    Loop *loop = loops.loopFor(func._body);
+    ASSERT_TRUE(loop != NULL) << "Body is in a loop";
+    EXPECT_EQ(loop->header(), func._header) << "Loop header is the Goto target";
+    EXPECT_EQ((int)loop->latches().size(), 1) << "Loop has one latch";
+    EXPECT_EQ(loop->latches()[0], func._body) << "Body is the latch";
+    EXPECT_EQ(loops.loopDepth(func._header), 1) << "Header is at loop depth 1";
+    EXPECT_EQ(loops.loopDepth(func._exit), 0) << "Exit is not in the loop";
+}
+
+TEST(BaseExtension, livenessOfForLoop) {
+    typedef int32_t (FuncProto)(int32_t *, int32_t);
+    COMPILE_FUNC(SumArrayFunction, FuncProto, f, false);
+    ControlFlowGraph *cfg = comp->cfg();
+    Liveness liveness(cfg);
+    DominatorTree dominators(cfg);
+    LoopNest loops(cfg, &dominators);
+
+    Builder *entry = func.builderEntry();
+    Base::Op_ForLoopUp *loop = NULL;
+    for (OperationIterator opIt = entry->OperationsBegin(); opIt != entry->OperationsEnd(); opIt++) {
+        if ((*opIt)->action() == ext->aForLoopUp)
+            loop = static_cast<Base::Op_ForLoopUp *>(*opIt);
+    }
+    ASSERT_TRUE(loop != NULL) << "Found the ForLoopUp";
+    Builder *body = loop->loopBody();
+    Symbol *sum = func.LookupLocal("sum");
+    Symbol *a = func.LookupLocal("a");
+
+    EXPECT_FALSE(liveness.isLiveIn(entry, sum)) << "sum is stored before it is loaded";
+    EXPECT_TRUE(liveness.isLiveIn(body, sum)) << "sum is live into the loop body";
+    EXPECT_TRUE(liveness.isLiveOut(body, sum)) << "sum is live around the loop";
+    EXPECT_TRUE(liveness.isLiveOut(loop->loopBreak(), sum)) << "sum is live after the loop";
+    EXPECT_TRUE(liveness.isLiveIn(entry, a)) << "a is live into the function";
+    EXPECT_TRUE(liveness.isLiveIn(body, loop->finalValue())) << "Loop's final value is live throughout the loop";
+    EXPECT_FALSE(liveness.isLiveIn(entry, loop->finalValue())) << "Loop's final value is not live before it is computed";
+    EXPECT_TRUE(liveness.isLiveIn(body, loop->loopVariable())) << "Loop variable is live throughout the loop";
+
+    Loop *l = loops.loopFor(body);
+    ASSERT_TRUE(l != NULL) << "Body is in a loop";
+    EXPECT_GE(liveness.peakPressure(l), 5) << "At least sum, a, i, the final value and the bump are live in the loop";
+    EXPECT_GE(liveness.peakPressure(l), liveness.peakPressure(body)) << "Loop pressure includes its body";
+}
+
+// Test function whose memory operations access Int32, Float64 and Int8 memory through pointers,
+// two fields of a struct, and call a function that may access any memory
+class AliasClassesFunction : public Base::Function {
+public:
+    AliasClassesFunction(Compiler *c, Base::BaseExtension *x, Base::Function *square)
+        : Base::Function(c)
+        , _x(x) {
+        DefineName("AliasClasses");
+        DefineLine("0");
+        DefineFile("AliasClasses.cpp");
+        Base::StructTypeBuilder stb(_x, this);
+        stb.setName("IntAndDouble")
+           ->addField("i", _x->Int32, 0)
+           ->addField("d", _x->Float64, 64);
+        _structType = stb.create(LOC);
+        _iField = _structType->LookupField("i");
+        _dField = _structType->LookupField("d");
+        Base::StructTypeBuilder utb(_x, this);
+        utb.setName("IntOrFloat")
+           ->addField("i", _x->Int32, 0)
+           ->addField("f", _x->Float32, 0)
+           ->addField("s", _x->Int16, 16);
+        _unionType = utb.create(LOC);
+        DefineReturnType(_x->NoType);
+        DefineParameter("p", PointerTo(LOC, _structType));
+        DefineParameter("pi", PointerTo(LOC, _x->Int32));
+        DefineParameter("pd", PointerTo(LOC, _x->Float64));
+        DefineParameter("pb", PointerTo(LOC, _x->Int8));
+        _square = DefineFunction(LOC, square);
+    }
+    virtual bool buildIL() {
+        Builder *b = builderEntry();
+        Value *i = _x->LoadAt(LOC, b, _x->Load(LOC, b, LookupLocal("pi")));
+        Value *d = _x->LoadAt(LOC, b, _x->Load(LOC, b, LookupLocal("pd")));
+        Value *p = _x->Load(LOC, b, LookupLocal("p"));
+        _x->StoreFieldAt(LOC, b, _iField, p, i);
+        _x->LoadFieldAt(LOC, b, _dField, p);
+        _x->LoadAt(LOC, b, _x->Load(LOC, b, LookupLocal("pb")));
+        _x->Call(LOC, b, _square, i);
+        _x->StoreAt(LOC, b, _x->Load(LOC, b, LookupLocal("pd")), d);
+        _x->Return(LOC, b);
+        return true;
+    }
+    const Base::StructType *_structType;
+    const Base::FieldType *_iField;
+    const Base::FieldType *_dField;
+    const Base::StructType *_unionType;
+protected:
+    Base::BaseExtension *_x;
+    Base::FunctionSymbol *_square;
+};
+
+TEST(BaseExtension, aliasClassesOfMemoryOperations) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+    SquarePlusOneFunction square(&c, ext);
+    AliasClassesFunction func(&c, ext, &square);
+    ASSERT_TRUE(func.comp()->buildIL()) << "Built IL ok";
+
+    OperationVector & ops = func.builderEntry()->operations();
+    ASSERT_EQ((int)ops.size(), 13) << "Thirteen operations";
+    Operation *loadPi = ops[0];
+    Operation *loadInt = ops[1];
+    Operation *storeIField = ops[5];
+    Operation *loadDField = ops[6];
+    Operation *loadByte = ops[8];
+    Operation *call = ops[9];
+    Operation *storeDouble = ops[11];
+
+    EXPECT_EQ(loadPi->readSymbol(), func.LookupLocal("pi")) << "Load must read its local";
+    EXPECT_EQ(loadPi->numMayReadSymbols(), 1) << "Load may read only its local";
+    EXPECT_EQ(loadInt->numReadSymbols(), 0) << "LoadAt must read no symbol";
+    EXPECT_EQ(loadInt->mayReadSymbol(), ext->TypeAliasClass(ext->Int32)) << "LoadAt may read Int32 memory";
+    EXPECT_EQ(storeIField->mayWriteSymbol(), ext->FieldAliasClass(func._iField)) << "StoreFieldAt may write its field";
+    EXPECT_EQ(call->mayWriteSymbol(), ext->AnyMemory()) << "Call may write any memory";
+    EXPECT_EQ(ext->TypeAliasClass(ext->Address), ext->TypeAliasClass(func.LookupLocal("pi")->type())) << "All pointers share one alias class";
+
+    Base::AliasAnalysis aa(ext);
+    EXPECT_FALSE(aa.mayInterfere(loadInt, storeDouble)) << "Int32 and Float64 memory do not overlap";
+    EXPECT_TRUE(aa.mayInterfere(loadInt, storeIField)) << "Int32 memory overlaps an Int32 field";
+    EXPECT_FALSE(aa.mayInterfere(loadDField, storeIField)) << "Different fields do not overlap";
+    EXPECT_TRUE(aa.mayInterfere(loadDField, storeDouble)) << "Float64 memory overlaps a Float64 field";
+    EXPECT_TRUE(aa.mayInterfere(loadByte, storeDouble)) << "Int8 memory overlaps anything";
+    EXPECT_TRUE(aa.mayInterfere(call, loadInt)) << "Call may write what LoadAt reads";
+    EXPECT_FALSE(aa.mayInterfere(call, loadPi)) << "Call cannot reach a local";
+    EXPECT_FALSE(aa.mayInterfere(loadInt, loadDField)) << "Reads never interfere";
+    EXPECT_TRUE(aa.mayAlias(ext->TypeAliasClass(func._structType), ext->FieldAliasClass(func._iField))) << "A struct overlaps its fields";
+
+    Symbol *unionI = ext->FieldAliasClass(func._unionType->LookupField("i"));
+    Symbol *unionF = ext->FieldAliasClass(func._unionType->LookupField("f"));
+    Symbol *unionS = ext->FieldAliasClass(func._unionType->LookupField("s"));
+    EXPECT_TRUE(aa.mayAlias(unionI, unionF)) << "Fields at the same offset overlap";
+    EXPECT_TRUE(aa.mayAlias(unionI, unionS)) << "A field overlaps a smaller field inside it";
+    EXPECT_FALSE(aa.mayAlias(unionI, ext->FieldAliasClass(func._iField))) << "Fields of different structs do not overlap";
+}
+
+// Test function that loads pointer parameters, of which only a is declared noAlias
+BASE_FUNC(NoAliasParametersFunction, "0", "NoAliasParameters.cpp", Value *_a; Value *_a1; Value *_b; Value *_c; Value *_d, \
+    _x, { \
+        DefineReturnType(_x->NoType); \
+        DefineParameter("a", PointerTo(LOC, _x->Int32), true); \
+        DefineParameter("b", PointerTo(LOC, _x->Int32)); \
+        DefineParameter("c", PointerTo(LOC, _x->Int32)); \
+        DefineParameter("d", PointerTo(LOC, _x->Float64)); \
+        }, \
+    b, { \
+        _a = _x->Load(LOC, b, LookupLocal("a")); \
+        _a1 = _x->IndexAt(LOC, b, _a, _x->ConstInt32(LOC, b, 1)); \
+        _b = _x->Load(LOC, b, LookupLocal("b")); \
+        _c = _x->Load(LOC, b, LookupLocal("c")); \
+        _d = _x->Load(LOC, b, LookupLocal("d")); \
+        _x->Return(LOC, b); \
+        })
+
+TEST(BaseExtension, noAliasPointers) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+    NoAliasParametersFunction func(&c, ext);
+    ASSERT_TRUE(func.comp()->buildIL()) << "Built IL ok";
+    Base::AliasAnalysis aa(ext, &func);
+
+    EXPECT_EQ(aa.rootPointer(func._a1), func._a) << "a+1 is derived from a";
+    EXPECT_EQ(aa.rootSymbol(func._a), func.LookupLocal("a")) << "a is loaded from parameter a";
+    EXPECT_TRUE(aa.pointersMayAlias(func._a, func._a1)) << "a and a+1 point into the same object";
+    EXPECT_FALSE(aa.pointersMayAlias(func._a1, func._b)) << "a is noAlias so nothing derived from it aliases b";
+    EXPECT_FALSE(aa.pointersMayAlias(func._b, func._d)) << "Int32 and Float64 pointers do not alias";
+    EXPECT_TRUE(aa.pointersMayAlias(func._b, func._c)) << "b and c may alias";
+    func.AssumeNoAlias(func._c);
+    EXPECT_FALSE(aa.pointersMayAlias(func._b, func._c)) << "c is assumed not to alias b";
+}
+
+// Test function that returns a*b + c - c*d, whose Muls are contracted into an FMA and an FNMA
+BASE_FUNC(MulAddFunction, "0", "MulAdd.cpp", , \
+    _x, { \
+        DefineReturnType(_x->Float64); \
+        DefineParameter("a", _x->Float64); \
+        DefineParameter("b", _x->Float64); \
+        DefineParameter("c", _x->Float64); \
+        DefineParameter("d", _x->Float64); \
+        SetFPContractionMode(FPContractOn); \
+        }, \
+    b, { \
+        Value *a = _x->Load(LOC, b, LookupLocal("a")); \
+        Value *c = _x->Load(LOC, b, LookupLocal("c")); \
+        Value *r = _x->Add(LOC, b, _x->Mul(LOC, b, a, _x->Load(LOC, b, LookupLocal("b"))), c); \
+        r = _x->Sub(LOC, b, r, _x->Mul(LOC, b, c, _x->Load(LOC, b, LookupLocal("d")))); \
+        _x->Return(LOC, b, r); \
+        })
+
+TEST(BaseExtension, contractMulAddToFMA) {
+    typedef double (FuncProto)(double, double, double, double);
+    COMPILE_FUNC_WITH_PASS(MulAddFunction, FuncProto, f, Base::FMAContraction, false);
+    Builder *entry = func.builderEntry();
+    EXPECT_EQ(countActions(entry, ext->aFMA), 1) << "a*b + c contracted to an FMA";
+    EXPECT_EQ(countActions(entry, ext->aFNMA), 1) << "r - c*d contracted to an FNMA";
+    EXPECT_EQ(countActions(entry, ext->aMul), 0) << "Both Muls removed";
+    EXPECT_EQ(f(2.0, 3.0, 4.0, 0.5), 8.0) << "Compiled f(2,3,4,0.5) returns 2*3 + 4 - 4*0.5";
+    EXPECT_EQ(f(-1.5, 2.0, 0.0, 7.0), -3.0) << "Compiled f(-1.5,2,0,7) returns -1.5*2 + 0 - 0*7";
+}
+
+// Test function that divides its parameter by a constant, which DivisionByConstant strength reduces
+#define DIVBYCONSTFUNC(name,type,op,d) \
+    BASE_FUNC(name ## Function, "0", #name ".cpp", , \
+        _x, { \
+            DefineReturnType(_x->type); \
+            DefineParameter("x", _x->type); \
+            }, \
+        b, { \
+            Value *x = _x->Load(LOC, b, LookupLocal("x")); \
+            _x->Return(LOC, b, _x->op(LOC, b, x, _x->Const ## type(LOC, b, d))); \
+            })
+
+#define TESTDIVBYCONST(name,type,ctype,op,d,expected_code) \
+    DIVBYCONSTFUNC(name,type,op,d) \
+    TEST(BaseExtension, name) { \
+        typedef ctype (FuncProto)(ctype); \
+        COMPILE_FUNC_WITH_PASS(name ## Function, FuncProto, f, Base::DivisionByConstant, false); \
+        ctype values[] = { 0, 1, -1, 2, -2, 6, 7, -7, 8, -9, 100, -12345, 987654321, \
+                           std::numeric_limits<ctype>::min(), std::numeric_limits<ctype>::max() }; \
+        for (int32_t v=0;v < sizeof(values)/sizeof(ctype);v++) { \
+            ctype x = values[v]; \
+            ctype expected = (expected_code); \
+            EXPECT_EQ(f(x), expected) << "Compiled f(" << x << ") returns " << expected; \
+        } \
+    }
+
+TESTDIVBYCONST(divInt32By7, Int32, int32_t, Div, 7, x / 7)
+TESTDIVBYCONST(divInt32ByMinus3, Int32, int32_t, Div, -3, x / -3)
+TESTDIVBYCONST(divInt32By8, Int32, int32_t, Div, 8, x / 8)
+TESTDIVBYCONST(remInt32By7, Int32, int32_t, Rem, 7, x % 7)
+TESTDIVBYCONST(remInt32ByMinus16, Int32, int32_t, Rem, -16, x % -16)
+TESTDIVBYCONST(unsignedDivInt32By10, Int32, int32_t, UnsignedDiv, 10, (int32_t)((uint32_t)x / 10u))
+TESTDIVBYCONST(unsignedDivInt32ByLarge, Int32, int32_t, UnsignedDiv, (int32_t)0xC0000001u, (int32_t)((uint32_t)x / 0xC0000001u))
+TESTDIVBYCONST(unsignedRemInt32By7, Int32, int32_t, UnsignedRem, 7, (int32_t)((uint32_t)x % 7u))
+TESTDIVBYCONST(unsignedRemInt32By16, Int32, int32_t, UnsignedRem, 16, (int32_t)((uint32_t)x % 16u))
+TESTDIVBYCONST(divInt64By1000000007, Int64, int64_t, Div, 1000000007, x / 1000000007)
+TESTDIVBYCONST(remInt64ByMinus1000, Int64, int64_t, Rem, -1000, x % -1000)
+TESTDIVBYCONST(unsignedDivInt64By7, Int64, int64_t, UnsignedDiv, 7, (int64_t)((uint64_t)x / 7u))
+
+// Test function that computes the remainder of two Float64 values, which Rem does not allow
+BASE_FUNC(Float64RemFunction, "0", "Float64Rem.cpp", , \
+    _x, { \
+        DefineReturnType(_x->Float64); \
+        DefineParameter("left", _x->Float64); \
+        DefineParameter("right", _x->Float64); \
+        }, \
+    b, { \
+        Value *left = _x->Load(LOC, b, LookupLocal("left")); \
+        Value *right = _x->Load(LOC, b, LookupLocal("right")); \
+        _x->Return(LOC, b, _x->Rem(LOC, b, left, right)); \
+        })
+
+TEST(BaseExtension, testRemTypesInvalid_Float64Float64) {
+    COMPILE_FUNC_TO_FAIL(Float64RemFunction, ext->CompileFail_BadInputTypes_Rem, false);
+}
+
+// Test function that applies a binary bitwise, shift or rotate operation to its parameters
+#define BITWISEFUNC(name,type,rightType,op) \
+    BASE_FUNC(name ## Function, "0", #name ".cpp", , \
+        _x, { \
+            DefineReturnType(_x->type); \
+            DefineParameter("x", _x->type); \
+            DefineParameter("y", _x->rightType); \
+            }, \
+        b, { \
+            Value *x = _x->Load(LOC, b, LookupLocal("x")); \
+            Value *y = _x->Load(LOC, b, LookupLocal("y")); \
+            _x->Return(LOC, b, _x->op(LOC, b, x, y)); \
+            })
+
+#define TESTBITWISE(name,type,ctype,rightType,rctype,op,expected_code) \
+    BITWISEFUNC(name,type,rightType,op) \
+    TEST(BaseExtension, name) { \
+        typedef ctype (FuncProto)(ctype, rctype); \
+        COMPILE_FUNC(name ## Function, FuncProto, f, false); \
+        ctype xs[] = { 0, 1, -1, 0x5A, (ctype)0x8001, std::numeric_limits<ctype>::min(), std::numeric_limits<ctype>::max() }; \
+        rctype ys[] = { 0, 1, 3, 7, 8, 16, 31, 32, 63 }; \
+        for (int32_t i=0;i < sizeof(xs)/sizeof(ctype);i++) { \
+            for (int32_t j=0;j < sizeof(ys)/sizeof(rctype);j++) { \
+                ctype x = xs[i]; rctype y = ys[j]; \
+                ctype expected = (expected_code); \
+                EXPECT_EQ(f(x, y), expected) << "Compiled f(" << (int64_t)x << "," << (int64_t)y << ") returns " << (int64_t)expected; \
+            } \
+        } \
+    }
+
+TESTBITWISE(andInt32, Int32, int32_t, Int32, int32_t, And, x & y)
+TESTBITWISE(orInt64, Int64, int64_t, Int64, int64_t, Or, x | y)
+TESTBITWISE(xorInt32, Int32, int32_t, Int32, int32_t, Xor, x ^ y)
+TESTBITWISE(shiftLInt32, Int32, int32_t, Int32, int32_t, ShiftL, (int32_t)((uint32_t)x << (y & 31)))
+TESTBITWISE(shiftRInt64, Int64, int64_t, Int32, int32_t, ShiftR, x >> (y & 63))
+TESTBITWISE(unsignedShiftRInt32, Int32, int32_t, Int32, int32_t, UnsignedShiftR, (int32_t)((uint32_t)x >> (y & 31)))
+TESTBITWISE(shiftLInt8, Int8, int8_t, Int32, int32_t, ShiftL, (int8_t)((uint8_t)x << (y & 7)))
+TESTBITWISE(shiftRInt16, Int16, int16_t, Int32, int32_t, ShiftR, (int16_t)(x >> (y & 15)))
+TESTBITWISE(unsignedShiftRInt8, Int8, int8_t, Int32, int32_t, UnsignedShiftR, (int8_t)((uint8_t)x >> (y & 7)))
+TESTBITWISE(unsignedShiftRInt16, Int16, int16_t, Int32, int32_t, UnsignedShiftR, (int16_t)((uint16_t)x >> (y & 15)))
+TESTBITWISE(rotateLInt32, Int32, int32_t, Int32, int32_t, RotateL, (int32_t)(((uint32_t)x << (y & 31)) | ((uint32_t)x >> ((32 - (y & 31)) & 31))))
+TESTBITWISE(rotateRInt64, Int64, int64_t, Int32, int32_t, RotateR, (int64_t)(((uint64_t)x >> (y & 63)) | ((uint64_t)x << ((64 - (y & 63)) & 63))))
+TESTBITWISE(rotateLInt8, Int8, int8_t, Int32, int32_t, RotateL, (int8_t)(((uint8_t)x << (y & 7)) | ((uint8_t)x >> ((8 - (y & 7)) & 7))))
+
+// Test function that applies a unary bitwise or bit counting operation to its parameter
+#define BITCOUNTFUNC(name,type,returnType,op) \
+    BASE_FUNC(name ## Function, "0", #name ".cpp", , \
+        _x, { \
+            DefineReturnType(_x->returnType); \
+            DefineParameter("x", _x->type); \
+            }, \
+        b, { \
+            _x->Return(LOC, b, _x->op(LOC, b, _x->Load(LOC, b, LookupLocal("x")))); \
+            })
+
+#define TESTBITCOUNT(name,type,ctype,returnType,rctype,op,expected_code) \
+    BITCOUNTFUNC(name,type,returnType,op) \
+    TEST(BaseExtension, name) { \
+        typedef rctype (FuncProto)(ctype); \
+        COMPILE_FUNC(name ## Function, FuncProto, f, false); \
+        ctype xs[] = { 0, 1, -1, 2, 0x5A, (ctype)0x8001, (ctype)0x1234567890ABCDEFLL, std::numeric_limits<ctype>::min(), std::numeric_limits<ctype>::max() }; \
+        for (int32_t i=0;i < sizeof(xs)/sizeof(ctype);i++) { \
+            ctype x = xs[i]; \
+            rctype expected = (expected_code); \
+            EXPECT_EQ(f(x), expected) << "Compiled f(" << (int64_t)x << ") returns " << (int64_t)expected; \
+        } \
+    }
+
+TESTBITCOUNT(notInt16, Int16, int16_t, Int16, int16_t, Not, (int16_t)~x)
+TESTBITCOUNT(popCountInt8, Int8, int8_t, Int32, int32_t, PopCount, __builtin_popcount((uint8_t)x))
+TESTBITCOUNT(popCountInt32, Int32, int32_t, Int32, int32_t, PopCount, __builtin_popcount((uint32_t)x))
+TESTBITCOUNT(popCountInt64, Int64, int64_t, Int32, int32_t, PopCount, __builtin_popcountll((uint64_t)x))
+TESTBITCOUNT(countLeadingZerosInt16, Int16, int16_t, Int32, int32_t, CountLeadingZeros, (x == 0) ? 16 : __builtin_clz((uint16_t)x) - 16)
+TESTBITCOUNT(countLeadingZerosInt32, Int32, int32_t, Int32, int32_t, CountLeadingZeros, (x == 0) ? 32 : __builtin_clz((uint32_t)x))
+TESTBITCOUNT(countTrailingZerosInt8, Int8, int8_t, Int32, int32_t, CountTrailingZeros, (x == 0) ? 8 : __builtin_ctz((uint8_t)x))
+TESTBITCOUNT(countTrailingZerosInt64, Int64, int64_t, Int32, int32_t, CountTrailingZeros, (x == 0) ? 64 : __builtin_ctzll((uint64_t)x))
+
+// Test function whose bit operations on constants are all folded into a single constant; its
+// ShiftL amount of 40 is taken modulo 32
+BASE_FUNC(FoldBitsFunction, "0", "FoldBits.cpp", , \
+    _x, { \
+        DefineReturnType(_x->Int32); \
+        }, \
+    b, { \
+        Value *rotated = _x->RotateL(LOC, b, _x->ConstInt32(LOC, b, 0x12345678), _x->ConstInt32(LOC, b, 36)); \
+        Value *bits = _x->Xor(LOC, b, rotated, _x->Not(LOC, b, _x->ConstInt32(LOC, b, 0xFF))); \
+        Value *shifted = _x->ShiftR(LOC, b, bits, _x->ConstInt32(LOC, b, 4)); \
+        Value *count = _x->PopCount(LOC, b, shifted); \
+        Value *leading = _x->CountLeadingZeros(LOC, b, _x->ConstInt64(LOC, b, 0x00F0000000000000LL)); \
+        _x->Return(LOC, b, _x->Or(LOC, b, _x->ShiftL(LOC, b, count, _x->ConstInt32(LOC, b, 40)), leading)); \
+        })
+
+TEST(BaseExtension, foldBitOperations) {
+    typedef int32_t (FuncProto)();
+    COMPILE_FUNC_WITH_PASS(FoldBitsFunction, FuncProto, f, Base::ConstantFolding, false);
+    uint32_t rotated = (0x12345678u << 4) | (0x12345678u >> 28);
+    int32_t shifted = ((int32_t)(rotated ^ ~0xFFu)) >> 4;
+    int32_t expected = (__builtin_popcount((uint32_t)shifted) << 8) | 8;
+    EXPECT_EQ(f(), expected) << "Compiled f() returns " << expected;
+
+    Builder *entry = func.builderEntry();
+    ActionID folded[] = { ext->aRotateL, ext->aXor, ext->aNot, ext->aShiftR, ext->aPopCount, ext->aCountLeadingZeros, ext->aShiftL, ext->aOr };
+    for (int32_t a=0;a < sizeof(folded)/sizeof(ActionID);a++)
+        EXPECT_EQ(countActions(entry, folded[a]), 0) << "Bit operation " << a << " folded";
+}
+
+// Test function that applies a unary math operation to its parameter
+#define MATHUNARYFUNC(name,type,op) \
+    BASE_FUNC(name ## Function, "0", #name ".cpp", , \
+        _x, { \
+            DefineReturnType(_x->type); \
+            DefineParameter("x", _x->type); \
+            }, \
+        b, { \
+            _x->Return(LOC, b, _x->op(LOC, b, _x->Load(LOC, b, LookupLocal("x")))); \
+            })
+
+#define TESTMATHUNARY(name,type,ctype,op,expected_code) \
+    MATHUNARYFUNC(name,type,op) \
+    TEST(BaseExtension, name) { \
+        typedef ctype (FuncProto)(ctype); \
+        COMPILE_FUNC(name ## Function, FuncProto, f, false); \
+        ctype xs[] = { 0, 1, (ctype)-1, (ctype)2.5, (ctype)-2.5, 16, (ctype)-100.75, std::numeric_limits<ctype>::max() }; \
+        for (int32_t i=0;i < sizeof(xs)/sizeof(ctype);i++) { \
+            ctype x = xs[i]; \
+            ctype expected = (expected_code); \
+            if (expected != expected) \
+                EXPECT_TRUE(std::isnan(f(x))) << "Compiled f(" << x << ") returns NaN"; \
+            else \
+                EXPECT_EQ(f(x), expected) << "Compiled f(" << x << ") returns " << expected; \
+        } \
+    }
+
+TESTMATHUNARY(absInt32, Int32, int32_t, Abs, (x < 0) ? -x : x)
+TESTMATHUNARY(absInt8, Int8, int8_t, Abs, (int8_t)((x < 0) ? -x : x))
+TESTMATHUNARY(absFloat64, Float64, double, Abs, fabs(x))
+TESTMATHUNARY(absFloat32, Float32, float, Abs, fabsf(x))
+TESTMATHUNARY(sqrtFloat64, Float64, double, Sqrt, sqrt(x))
+TESTMATHUNARY(floorFloat64, Float64, double, Floor, floor(x))
+TESTMATHUNARY(ceilFloat32, Float32, float, Ceil, ceilf(x))
+
+// Floor and Ceil are computed without calls, so check the values where that is hardest: small
+// fractions whose result is a signed zero, values too big to convert to an integer, and infinities
+#define TESTROUNDING(name,type,ctype,op,expected_code) \
+    MATHUNARYFUNC(name,type,op) \
+    TEST(BaseExtension, name) { \
+        typedef ctype (FuncProto)(ctype); \
+        COMPILE_FUNC(name ## Function, FuncProto, f, false); \
+        ctype xs[] = { (ctype)0.5, (ctype)-0.5, (ctype)0.25, (ctype)-0.75, (ctype)-0.0, (ctype)1e10, (ctype)-1e10, (ctype)12345678.5, \
+                       (ctype)1e30, (ctype)-1e30, std::numeric_limits<ctype>::infinity(), -std::numeric_limits<ctype>::infinity() }; \
+        for (int32_t i=0;i < sizeof(xs)/sizeof(ctype);i++) { \
+            ctype x = xs[i]; \
+            ctype expected = (expected_code); \
+            ctype actual = f(x); \
+            EXPECT_EQ(actual, expected) << "Compiled f(" << x << ") returns " << expected; \
+            EXPECT_EQ(std::signbit(actual), std::signbit(expected)) << "Compiled f(" << x << ") has the sign of " << expected; \
+        } \
+        EXPECT_TRUE(std::isnan(f(std::numeric_limits<ctype>::quiet_NaN()))) << "Compiled f(NaN) returns NaN"; \
+    }
+
+TESTROUNDING(floorRoundingFloat64, Float64, double, Floor, floor(x))
+TESTROUNDING(ceilRoundingFloat64, Float64, double, Ceil, ceil(x))
+TESTROUNDING(floorRoundingFloat32, Float32, float, Floor, floorf(x))
+TESTROUNDING(ceilRoundingFloat32, Float32, float, Ceil, ceilf(x))
+
+// Test function that applies a binary math operation to its parameters
+#define MATHBINARYFUNC(name,type,op) \
+    BASE_FUNC(name ## Function, "0", #name ".cpp", , \
+        _x, { \
+            DefineReturnType(_x->type); \
+            DefineParameter("x", _x->type); \
+            DefineParameter("y", _x->type); \
+            }, \
+        b, { \
+            Value *x = _x->Load(LOC, b, LookupLocal("x")); \
+            Value *y = _x->Load(LOC, b, LookupLocal("y")); \
+            _x->Return(LOC, b, _x->op(LOC, b, x, y)); \
+            })
+
+#define TESTMATHBINARY(name,type,ctype,op,expected_code) \
+    MATHBINARYFUNC(name,type,op) \
+    TEST(BaseExtension, name) { \
+        typedef ctype (FuncProto)(ctype, ctype); \
+        COMPILE_FUNC(name ## Function, FuncProto, f, false); \
+        ctype values[] = { 0, 1, (ctype)-1, 7, (ctype)-2.5, std::numeric_limits<ctype>::min(), std::numeric_limits<ctype>::max() }; \
+        for (int32_t i=0;i < sizeof(values)/sizeof(ctype);i++) { \
+            for (int32_t j=0;j < sizeof(values)/sizeof(ctype);j++) { \
+                ctype x = values[i]; ctype y = values[j]; \
+                ctype expected = (expected_code); \
+                EXPECT_EQ(f(x, y), expected) << "Compiled f(" << x << "," << y << ") returns " << expected; \
+            } \
+        } \
+    }
+
+TESTMATHBINARY(maxInt32, Int32, int32_t, Max, (y > x) ? y : x)
+TESTMATHBINARY(minInt64, Int64, int64_t, Min, (y < x) ? y : x)
+TESTMATHBINARY(maxFloat64, Float64, double, Max, (y > x) ? y : x)
+TESTMATHBINARY(minFloat32, Float32, float, Min, (y < x) ? y : x)
+TESTMATHBINARY(copySignFloat64, Float64, double, CopySign, copysign(x, y))
+
+// Test function that computes the square root of an integer parameter, which Sqrt does not allow
+BASE_FUNC(Int32SqrtFunction, "0", "Int32Sqrt.cpp", , \
+    _x, { \
+        DefineReturnType(_x->Int32); \
+        DefineParameter("x", _x->Int32); \
+        }, \
+    b, { \
+        _x->Return(LOC, b, _x->Sqrt(LOC, b, _x->Load(LOC, b, LookupLocal("x")))); \
+        })
+
+TEST(BaseExtension, testSqrtTypesInvalid_Int32) {
+    COMPILE_FUNC_TO_FAIL(Int32SqrtFunction, ext->CompileFail_BadInputTypes_Sqrt, false);
+}
+
+// Test function whose math operations on constants are all folded into a single constant
+BASE_FUNC(FoldMathFunction, "0", "FoldMath.cpp", , \
+    _x, { \
+        DefineReturnType(_x->Float64); \
+        }, \
+    b, { \
+        Value *root = _x->Sqrt(LOC, b, _x->Max(LOC, b, _x->ConstFloat64(LOC, b, 2.0), _x->ConstFloat64(LOC, b, 16.0))); \
+        Value *floor = _x->Floor(LOC, b, _x->ConstFloat64(LOC, b, -2.5)); \
+        Value *copied = _x->CopySign(LOC, b, _x->ConstFloat64(LOC, b, 3.0), _x->ConstFloat64(LOC, b, -0.0)); \
+        Value *abs = _x->Abs(LOC, b, _x->Min(LOC, b, _x->ConstInt32(LOC, b, -7), _x->ConstInt32(LOC, b, 3))); \
+        Value *sum = _x->Add(LOC, b, _x->Add(LOC, b, root, floor), copied); \
+        _x->Return(LOC, b, _x->Add(LOC, b, sum, _x->ConvertTo(LOC, b, _x->Float64, abs))); \
+        })
+
+TEST(BaseExtension, foldMathOperations) {
+    typedef double (FuncProto)();
+    COMPILE_FUNC_WITH_PASS(FoldMathFunction, FuncProto, f, Base::ConstantFolding, false);
+    EXPECT_EQ(f(), 5.0) << "Compiled f() returns sqrt(16) + floor(-2.5) + copysign(3,-0) + abs(-7)";
+}
+
+// Test function that returns x + y, or -1 if the sum overflows
+BASE_FUNC(AddOrMinusOneFunction, "0", "AddOrMinusOne.cpp", Builder *_overflow, \
+    _x, { \
+        DefineReturnType(_x->Int32); \
+        DefineParameter("x", _x->Int32); \
+        DefineParameter("y", _x->Int32); \
+        }, \
+    b, { \
+        _overflow = _x->OrphanBuilder(LOC, b); \
+        Value *x = _x->Load(LOC, b, LookupLocal("x")); \
+        Value *y = _x->Load(LOC, b, LookupLocal("y")); \
+        _x->Return(LOC, b, _x->AddWithOverflow(LOC, b, _overflow, x, y)); \
+        _x->Return(LOC, _overflow, _x->ConstInt32(LOC, _overflow, -1)); \
+        })
+
+TEST(BaseExtension, addWithOverflowBranchesToTarget) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+    AddOrMinusOneFunction func(&c, ext);
+    ASSERT_TRUE(func.comp()->buildIL()) << "Built IL ok";
+
+    Builder *entry = func.builderEntry();
+    Operation *add = NULL;
+    for (OperationIterator opIt = entry->OperationsBegin(); opIt != entry->OperationsEnd(); opIt++) {
+        if ((*opIt)->action() == ext->aAddWithOverflow)
+            add = *opIt;
+    }
+    ASSERT_TRUE(add != NULL) << "Entry has an AddWithOverflow";
+    EXPECT_EQ(add->numBuilders(), 1) << "AddWithOverflow has one target";
+    EXPECT_EQ(add->builder(), func._overflow) << "AddWithOverflow targets the overflow builder";
+    EXPECT_EQ(add->result()->type(), ext->Int32) << "AddWithOverflow produces an Int32";
+
+    ControlFlowGraph *cfg = func.comp()->cfg();
+    DominatorTree dominators(cfg);
+    EXPECT_EQ(dominators.idom(func._overflow), entry) << "Entry immediately dominates the overflow builder";
+}
+
+TEST(BaseExtension, addWithOverflowExecutes) {
+    typedef int32_t (FuncProto)(int32_t, int32_t);
+    COMPILE_FUNC(AddOrMinusOneFunction, FuncProto, f, false);
+    EXPECT_EQ(f(1, 2), 3) << "Compiled f(1,2) returns 3";
+    EXPECT_EQ(f(-5, 2), -3) << "Compiled f(-5,2) returns -3";
+    EXPECT_EQ(f(std::numeric_limits<int32_t>::max(), 1), -1) << "Compiled f(INT32_MAX,1) overflows";
+    EXPECT_EQ(f(std::numeric_limits<int32_t>::min(), -1), -1) << "Compiled f(INT32_MIN,-1) overflows";
+}
+
+// Test function that returns x op y, or -1 if the operation overflows
+#define OVERFLOWFUNC(name,type,op) \
+    BASE_FUNC(name ## Function, "0", #name ".cpp", , \
+        _x, { \
+            DefineReturnType(_x->type); \
+            DefineParameter("x", _x->type); \
+            DefineParameter("y", _x->type); \
+            }, \
+        b, { \
+            Builder *overflow = _x->OrphanBuilder(LOC, b); \
+            Value *x = _x->Load(LOC, b, LookupLocal("x")); \
+            Value *y = _x->Load(LOC, b, LookupLocal("y")); \
+            _x->Return(LOC, b, _x->op(LOC, b, overflow, x, y)); \
+            _x->Return(LOC, overflow, _x->Const ## type(LOC, overflow, -1)); \
+            })
+
+#define TESTOVERFLOW(name,type,ctype,op,x1,y1,r1,x2,y2,x3,y3) \
+    OVERFLOWFUNC(name,type,op) \
+    TEST(BaseExtension, name) { \
+        typedef ctype (FuncProto)(ctype, ctype); \
+        COMPILE_FUNC(name ## Function, FuncProto, f, false); \
+        EXPECT_EQ(f(x1, y1), (ctype)(r1)) << "Compiled f(" #x1 "," #y1 ") returns " #r1; \
+        EXPECT_EQ(f(x2, y2), (ctype)-1) << "Compiled f(" #x2 "," #y2 ") overflows"; \
+        EXPECT_EQ(f(x3, y3), (ctype)-1) << "Compiled f(" #x3 "," #y3 ") overflows"; \
+    }
+
+TESTOVERFLOW(addWithOverflowInt64, Int64, int64_t, AddWithOverflow, \
+             (int64_t)1 << 40, (int64_t)1 << 40, (int64_t)1 << 41, \
+             std::numeric_limits<int64_t>::max(), 1, std::numeric_limits<int64_t>::min(), -1)
+TESTOVERFLOW(subWithOverflowInt32, Int32, int32_t, SubWithOverflow, \
+             5, 8, -3, \
+             std::numeric_limits<int32_t>::min(), 1, std::numeric_limits<int32_t>::max(), -1)
+TESTOVERFLOW(subWithOverflowInt64, Int64, int64_t, SubWithOverflow, \
+             -((int64_t)1 << 40), (int64_t)1 << 40, -((int64_t)1 << 41), \
+             std::numeric_limits<int64_t>::min(), 1, std::numeric_limits<int64_t>::max(), -1)
+TESTOVERFLOW(mulWithOverflowInt32, Int32, int32_t, MulWithOverflow, \
+             -6, 7, -42, \
+             std::numeric_limits<int32_t>::max(), 2, std::numeric_limits<int32_t>::min(), -1)
+TESTOVERFLOW(mulWithOverflowInt64, Int64, int64_t, MulWithOverflow, \
+             (int64_t)1 << 31, (int64_t)1 << 31, (int64_t)1 << 62, \
+             (int64_t)1 << 32, (int64_t)1 << 31, std::numeric_limits<int64_t>::min(), -1)
+
+// Test function that multiplies Float64 parameters with an overflow check, which MulWithOverflow does not allow
+BASE_FUNC(Float64MulWithOverflowFunction, "0", "Float64MulWithOverflow.cpp", , \
+    _x, { \
+        DefineReturnType(_x->Float64); \
+        DefineParameter("x", _x->Float64); \
+        DefineParameter("y", _x->Float64); \
+        }, \
+    b, { \
+        Builder *overflow = _x->OrphanBuilder(LOC, b); \
+        Value *x = _x->Load(LOC, b, LookupLocal("x")); \
+        Value *y = _x->Load(LOC, b, LookupLocal("y")); \
+        _x->Return(LOC, b, _x->MulWithOverflow(LOC, b, overflow, x, y)); \
+        _x->Return(LOC, overflow, x); \
+        })
+
+TEST(BaseExtension, testMulWithOverflowTypesInvalid_Float64) {
+    COMPILE_FUNC_TO_FAIL(Float64MulWithOverflowFunction, ext->CompileFail_BadInputTypes_MulWithOverflow, false);
+}
+
+// Test functions that switch on their parameter: each case returns the index of its target, and
+// the default returns -1
+#define SWITCHFUNC(name,cases,arms) \
+    BASE_FUNC(name ## Function, "0", #name ".cpp", Base::Op_Switch *_switch, \
+        _x, { \
+            DefineReturnType(_x->Int32); \
+            DefineParameter("x", _x->Int32); \
+            }, \
+        b, { \
+            int32_t numCases = sizeof(cases)/sizeof(int32_t); \
+            std::vector<Builder *> armTargets; \
+            std::vector<Literal *> caseValues(numCases); \
+            std::vector<Builder *> caseTargets(numCases); \
+            for (int32_t c=0;c < numCases;c++) { \
+                while (armTargets.size() <= arms[c]) { \
+                    Builder *arm = _x->OrphanBuilder(LOC, b); \
+                    _x->Return(LOC, arm, _x->ConstInt32(LOC, arm, armTargets.size())); \
+                    armTargets.push_back(arm); \
+                } \
+                caseValues[c] = _x->Int32->literal(LOC, b->comp(), cases[c]); \
+                caseTargets[c] = armTargets[arms[c]]; \
+            } \
+            Builder *defaultTarget = _x->OrphanBuilder(LOC, b); \
+            _x->Return(LOC, defaultTarget, _x->ConstInt32(LOC, defaultTarget, -1)); \
+            _x->Switch(LOC, b, _x->Load(LOC, b, LookupLocal("x")), defaultTarget, numCases, caseValues.data(), caseTargets.data()); \
+            _switch = static_cast<Base::Op_Switch *>(b->operations().back()); \
+            })
+
+static int32_t opcodeCases[] = { 3, 0, 1, 2, 5, 6, 7, 4 };
+static int32_t opcodeArms[]  = { 3, 0, 1, 2, 5, 6, 7, 4 };
+SWITCHFUNC(OpcodeSwitch, opcodeCases, opcodeArms)
+
+static int32_t vowelCases[] = { 'a', 'e', 'i', 'o', 'u', 'y' };
+static int32_t vowelArms[]  = { 0, 0, 0, 0, 0, 1 };
+SWITCHFUNC(VowelSwitch, vowelCases, vowelArms)
+
+static int32_t sparseCases[] = { -5, 1, 100, 10000, 1000000, 7 };
+static int32_t sparseArms[]  = { 0, 1, 2, 3, 4, 5 };
+SWITCHFUNC(SparseSwitch, sparseCases, sparseArms)
+
+TEST(BaseExtension, switchDispatchByDensity) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+
+    OpcodeSwitchFunction opcodes(&c, ext);
+    ASSERT_TRUE(opcodes.comp()->buildIL()) << "Built opcode switch IL ok";
+    ASSERT_EQ(opcodes._switch->action(), ext->aSwitch) << "Entry ends with a Switch";
+    EXPECT_EQ(opcodes._switch->numCases(), 8) << "Opcode switch has 8 cases";
+    EXPECT_EQ(opcodes._switch->numBuilders(), 9) << "Opcode switch has a default and 8 case targets";
+    EXPECT_EQ(opcodes._switch->dispatch(), Base::Op_Switch::JumpTable) << "Consecutive case values use a jump table";
+    ControlFlowGraph *cfg = opcodes.comp()->cfg();
+    EXPECT_EQ(cfg->numSuccessors(opcodes.builderEntry()), 9) << "Entry branches to every target";
+
+    VowelSwitchFunction vowels(&c, ext);
+    ASSERT_TRUE(vowels.comp()->buildIL()) << "Built vowel switch IL ok";
+    EXPECT_EQ(vowels._switch->dispatch(), Base::Op_Switch::BitTests) << "Two targets over a small range use bit tests";
+
+    SparseSwitchFunction sparse(&c, ext);
+    ASSERT_TRUE(sparse.comp()->buildIL()) << "Built sparse switch IL ok";
+    EXPECT_EQ(sparse._switch->dispatch(), Base::Op_Switch::BinarySearch) << "Sparse case values use a binary search";
+}
+
+// compiles a switch function and calls it with every case value, the values either side of each
+// case, and the extreme values, checking each reaches the right case target or the default
+#define TESTSWITCHEXECUTES(name,cases,arms) \
+    TEST(BaseExtension, name ## Executes) { \
+        typedef int32_t (FuncProto)(int32_t); \
+        COMPILE_FUNC(name ## Function, FuncProto, f, false); \
+        int32_t numCases = sizeof(cases)/sizeof(int32_t); \
+        std::vector<int32_t> xs; \
+        xs.push_back(std::numeric_limits<int32_t>::min()); \
+        xs.push_back(std::numeric_limits<int32_t>::max()); \
+        for (int32_t c=0;c < numCases;c++) { \
+            xs.push_back(cases[c] - 1); \
+            xs.push_back(cases[c]); \
+            xs.push_back(cases[c] + 1); \
+        } \
+        for (auto it = xs.begin(); it != xs.end(); it++) { \
+            int32_t x = *it; \
+            int32_t expected = -1; \
+            for (int32_t c=0;c < numCases;c++) { \
+                if (cases[c] == x) \
+                    expected = arms[c]; \
+            } \
+            EXPECT_EQ(f(x), expected) << "Compiled f(" << x << ") returns " << expected; \
+        } \
+    }
+
+TESTSWITCHEXECUTES(OpcodeSwitch, opcodeCases, opcodeArms)
+TESTSWITCHEXECUTES(VowelSwitch, vowelCases, vowelArms)
+TESTSWITCHEXECUTES(SparseSwitch, sparseCases, sparseArms)
+
+static int32_t duplicateCases[] = { 1, 2, 1 };
+static int32_t duplicateArms[]  = { 0, 1, 2 };
+SWITCHFUNC(DuplicateCaseSwitch, duplicateCases, duplicateArms)
+
+TEST(BaseExtension, testSwitchDuplicateCaseInvalid) {
+    COMPILE_FUNC_TO_FAIL(DuplicateCaseSwitchFunction, ext->CompileFail_BadInputTypes_Switch, false);
+}
+
+// Test function that compares its parameters, producing an Int32 that is 1 or 0
+#define COMPAREFUNC(name,type,op) \
+    BASE_FUNC(name ## Function, "0", #name ".cpp", , \
+        _x, { \
+            DefineReturnType(_x->Int32); \
+            DefineParameter("x", _x->type); \
+            DefineParameter("y", _x->type); \
+            }, \
+        b, { \
+            Value *x = _x->Load(LOC, b, LookupLocal("x")); \
+            Value *y = _x->Load(LOC, b, LookupLocal("y")); \
+            _x->Return(LOC, b, _x->op(LOC, b, x, y)); \
+            })
+
+#define TESTCOMPARE(name,type,ctype,op,expected_code) \
+    COMPAREFUNC(name,type,op) \
+    TEST(BaseExtension, name) { \
+        typedef int32_t (FuncProto)(ctype, ctype); \
+        COMPILE_FUNC(name ## Function, FuncProto, f, false); \
+        ctype values[] = { 0, 1, (ctype)-1, 7, std::numeric_limits<ctype>::min(), std::numeric_limits<ctype>::max() }; \
+        for (int32_t i=0;i < sizeof(values)/sizeof(ctype);i++) { \
+            for (int32_t j=0;j < sizeof(values)/sizeof(ctype);j++) { \
+                ctype x = values[i]; ctype y = values[j]; \
+                int32_t expected = (expected_code) ? 1 : 0; \
+                EXPECT_EQ(f(x, y), expected) << "Compiled f(" << x << "," << y << ") returns " << expected; \
+            } \
+        } \
+    }
+
+TESTCOMPARE(equalToInt32, Int32, int32_t, EqualTo, x == y)
+TESTCOMPARE(notEqualToInt64, Int64, int64_t, NotEqualTo, x != y)
+TESTCOMPARE(lessThanInt8, Int8, int8_t, LessThan, x < y)
+TESTCOMPARE(greaterOrEqualToInt64, Int64, int64_t, GreaterOrEqualTo, x >= y)
+TESTCOMPARE(lessOrEqualToFloat64, Float64, double, LessOrEqualTo, x <= y)
+TESTCOMPARE(greaterThanFloat32, Float32, float, GreaterThan, x > y)
+TESTCOMPARE(unsignedLessThanInt32, Int32, int32_t, UnsignedLessThan, (uint32_t)x < (uint32_t)y)
+TESTCOMPARE(unsignedGreaterThanInt64, Int64, int64_t, UnsignedGreaterThan, (uint64_t)x > (uint64_t)y)
+
+// Test function that selects one of two parameters without branching
+#define SELECTFUNC(name,type) \
+    BASE_FUNC(name ## Function, "0", #name ".cpp", , \
+        _x, { \
+            DefineReturnType(_x->type); \
+            DefineParameter("c", _x->Int32); \
+            DefineParameter("a", _x->type); \
+            DefineParameter("b", _x->type); \
+            }, \
+        b, { \
+            Value *c = _x->Load(LOC, b, LookupLocal("c")); \
+            Value *a = _x->Load(LOC, b, LookupLocal("a")); \
+            Value *v = _x->Load(LOC, b, LookupLocal("b")); \
+            _x->Return(LOC, b, _x->Select(LOC, b, c, a, v)); \
+            })
+
+#define TESTSELECT(name,type,ctype,a,b) \
+    SELECTFUNC(name,type) \
+    TEST(BaseExtension, name) { \
+        typedef ctype (FuncProto)(int32_t, ctype, ctype); \
+        COMPILE_FUNC(name ## Function, FuncProto, f, false); \
+        EXPECT_EQ(f(1, a, b), a) << "Compiled f(1,a,b) returns a"; \
+        EXPECT_EQ(f(-5, a, b), a) << "Compiled f(-5,a,b) returns a"; \
+        EXPECT_EQ(f(0, a, b), b) << "Compiled f(0,a,b) returns b"; \
+    }
+
+TESTSELECT(selectInt8, Int8, int8_t, (int8_t)-3, (int8_t)100)
+TESTSELECT(selectInt32, Int32, int32_t, 12345, -7)
+TESTSELECT(selectInt64, Int64, int64_t, (int64_t)1 << 40, -1)
+TESTSELECT(selectFloat32, Float32, float, 1.5f, -0.25f)
+TESTSELECT(selectFloat64, Float64, double, 3.25, -1e100)
+
+// Test function that selects with a condition that is not Int32, which Select does not allow
+BASE_FUNC(Int64SelectFunction, "0", "Int64Select.cpp", , \
+    _x, { \
+        DefineReturnType(_x->Int32); \
+        DefineParameter("c", _x->Int64); \
+        }, \
+    b, { \
+        Value *c = _x->Load(LOC, b, LookupLocal("c")); \
+        _x->Return(LOC, b, _x->Select(LOC, b, c, _x->ConstInt32(LOC, b, 1), _x->ConstInt32(LOC, b, 0))); \
+        })
+
+TEST(BaseExtension, testSelectTypesInvalid_Int64Condition) {
+    COMPILE_FUNC_TO_FAIL(Int64SelectFunction, ext->CompileFail_BadInputTypes_Select, false);
+}
+
+// Test function that stores the larger of its parameters to a local in an if-then-else diamond,
+// and clamps the local to be at most 100 in an if-then triangle
+BASE_FUNC(MaxDiamondFunction, "0", "MaxDiamond.cpp", Builder *_then; Builder *_else; Builder *_merge; Builder *_clamp; Builder *_exit, \
+    _x, { \
+        DefineReturnType(_x->Int32); \
+        DefineParameter("a", _x->Int32); \
+        DefineParameter("b", _x->Int32); \
+        DefineLocal("m", _x->Int32); \
+        }, \
+    b, { \
+        auto mSym = LookupLocal("m"); \
+        _then = _x->OrphanBuilder(LOC, b); \
+        _else = _x->OrphanBuilder(LOC, b); \
+        _merge = _x->OrphanBuilder(LOC, b); \
+        _clamp = _x->OrphanBuilder(LOC, b); \
+        _exit = _x->OrphanBuilder(LOC, b); \
+        Value *a = _x->Load(LOC, b, LookupLocal("a")); \
+        Value *v = _x->Load(LOC, b, LookupLocal("b")); \
+        _x->IfCmpGreaterThan(LOC, b, _then, a, v); \
+        _x->Goto(LOC, b, _else); \
+        _x->Store(LOC, _then, mSym, a); \
+        _x->Goto(LOC, _then, _merge); \
+        _x->Store(LOC, _else, mSym, v); \
+        _x->Goto(LOC, _else, _merge); \
+        _x->IfCmpGreaterThan(LOC, _merge, _clamp, _x->Load(LOC, _merge, mSym), _x->ConstInt32(LOC, _merge, 100)); \
+        _x->Goto(LOC, _merge, _exit); \
+        _x->Store(LOC, _clamp, mSym, _x->ConstInt32(LOC, _clamp, 100)); \
+        _x->Goto(LOC, _clamp, _exit); \
+        _x->Return(LOC, _exit, _x->Load(LOC, _exit, mSym)); \
+        })
+
+TEST(BaseExtension, convertIfDiamondsToSelect) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+    MaxDiamondFunction func(&c, ext);
+    Strategy *strategy = new Strategy(&c, "IfConversion");
+    strategy->addPass(new Base::IfConversion(&c));
+    EXPECT_EQ((int)func.Compile(NULL, strategy->id()), (int)c.CompileSuccessful) << "Converted MaxDiamond ok";
+
+    Builder *entry = func.builderEntry();
+    EXPECT_EQ(countActions(entry, ext->aIfCmpGreaterThan), 0) << "Diamond's IfCmp removed";
+    EXPECT_EQ(countActions(entry, ext->aGreaterThan), 1) << "Diamond's condition computed as a value";
+    EXPECT_EQ(countActions(entry, ext->aSelect), 1) << "Diamond's stored value selected";
+    ASSERT_EQ(entry->operations().back()->action(), ext->aGoto) << "Entry ends with a Goto";
+    EXPECT_EQ(entry->operations().back()->builder(), func._merge) << "Entry branches directly to the merge";
+
+    EXPECT_EQ(countActions(func._merge, ext->aIfCmpGreaterThan), 0) << "Triangle's IfCmp removed";
+    EXPECT_EQ(countActions(func._merge, ext->aSelect), 1) << "Triangle's stored value selected";
+    EXPECT_EQ(func._merge->operations().back()->builder(), func._exit) << "Merge still branches to the exit";
+}
+
+TEST(BaseExtension, convertIfDiamondsInTwoFunctions) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+    Strategy *strategy = new Strategy(&c, "IfConversion");
+    strategy->addPass(new Base::IfConversion(&c))
+            ->addPass(new JB1CodeGenerator(&c));
+    typedef int32_t (FuncProto)(int32_t, int32_t);
+
+    MaxDiamondFunction first(&c, ext);
+    EXPECT_EQ((int)first.Compile(NULL, strategy->id()), (int)c.CompileSuccessful) << "Compiled first MaxDiamond ok";
+    EXPECT_EQ(countActions(first.builderEntry(), ext->aSelect), 1) << "First diamond converted";
+    FuncProto *f = first.nativeEntry<FuncProto *>();
+    EXPECT_EQ(f(3, 7), 7) << "Compiled first f(3,7) returns 7";
+    EXPECT_EQ(f(150, 2), 100) << "Compiled first f(150,2) returns 100";
+
+    MaxDiamondFunction second(&c, ext);
+    EXPECT_EQ((int)second.Compile(NULL, strategy->id()), (int)c.CompileSuccessful) << "Compiled second MaxDiamond ok";
+    EXPECT_EQ(countActions(second.builderEntry(), ext->aSelect), 1) << "Second diamond converted";
+    EXPECT_EQ(countActions(second._merge, ext->aSelect), 1) << "Second triangle converted";
+    f = second.nativeEntry<FuncProto *>();
+    EXPECT_EQ(f(9, 2), 9) << "Compiled second f(9,2) returns 9";
+    EXPECT_EQ(f(2, 150), 100) << "Compiled second f(2,150) returns 100";
+}
+
+TEST(BaseExtension, promoteLocalsInIfDiamonds) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+    MaxDiamondFunction func(&c, ext);
+    Strategy *strategy = new Strategy(&c, "SSA");
+    strategy->addPass(new Base::SSAConstruction(&c))
+            ->addPass(new Base::SSADestruction(&c))
+            ->addPass(new JB1CodeGenerator(&c));
+    EXPECT_EQ((int)func.Compile(NULL, strategy->id()), (int)c.CompileSuccessful) << "Compiled MaxDiamond ok";
+    EXPECT_EQ(countLocalAccesses(func.comp(), ext), 0) << "Loads and Stores of m removed";
+    typedef int32_t (FuncProto)(int32_t, int32_t);
+    FuncProto *f = func.nativeEntry<FuncProto *>();
+    EXPECT_EQ(f(3, 7), 7) << "Compiled f(3,7) returns 7";
+    EXPECT_EQ(f(9, 2), 9) << "Compiled f(9,2) returns 9";
+    EXPECT_EQ(f(150, 2), 100) << "Compiled f(150,2) returns 100";
+    EXPECT_EQ(f(2, 150), 100) << "Compiled f(2,150) returns 100";
+}
+
+// Test function that returns x, or -1 along a rarely taken error path when x is negative; the
+// error path branches to a report builder that nothing else reaches. Its IL is only built, not compiled
+BASE_FUNC(ErrorPathFunction, "0", "ErrorPath.cpp", Builder *_error; Builder *_report; Builder *_ok, \
+    _x, { \
+        DefineReturnType(_x->Int32); \
+        DefineParameter("x", _x->Int32); \
+        }, \
+    b, { \
+        _error = _x->OrphanBuilder(LOC, b); \
+        _report = _x->OrphanBuilder(LOC, b); \
+        _ok = _x->OrphanBuilder(LOC, b); \
+        Value *x = _x->Load(LOC, b, LookupLocal("x")); \
+        _x->IfCmpLessThan(LOC, b, _error, x, _x->ConstInt32(LOC, b, 0)); \
+        b->operations().back()->setTakenProbability(1); \
+        _x->Goto(LOC, b, _ok); \
+        _x->Goto(LOC, _error, _report); \
+        _x->Return(LOC, _report, _x->ConstInt32(LOC, _report, -1)); \
+        _x->Return(LOC, _ok, _x->Load(LOC, _ok, LookupLocal("x"))); \
+        })
+
+class BuilderOrderVisitor : public Visitor {
+public:
+    BuilderOrderVisitor(Compiler *compiler, bool coldLast) : Visitor(compiler, "BuilderOrder") { _visitColdBuildersLast = coldLast; }
+    std::vector<Builder *> _order;
+
+protected:
+    virtual void visitBuilderPreOps(Builder *b) { _order.push_back(b); }
+};
+
+TEST(BaseExtension, coldBuildersLaidOutLast) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+    ErrorPathFunction func(&c, ext);
+    Strategy *strategy = new Strategy(&c, "ColdBuilderLayout");
+    strategy->addPass(new Base::ColdBuilderLayout(&c));
+    EXPECT_EQ((int)func.Compile(NULL, strategy->id()), (int)c.CompileSuccessful) << "Laid out ErrorPath ok";
+
+    EXPECT_FALSE(func.builderEntry()->isCold()) << "Entry is not cold";
+    EXPECT_TRUE(func._error->isCold()) << "Target of rarely taken branch is cold";
+    EXPECT_TRUE(func._report->isCold()) << "Builder only reached from cold builders is cold";
+    EXPECT_FALSE(func._ok->isCold()) << "Target of the likely path is not cold";
+
+    BuilderOrderVisitor order(&c, true);
+    order.start(func.comp());
+    ASSERT_EQ(order._order.size(), 4) << "Visited every builder";
+    EXPECT_EQ(order._order[0], func.builderEntry()) << "Entry visited first";
+    EXPECT_EQ(order._order[1], func._ok) << "Hot builder visited before cold builders";
+    EXPECT_TRUE(order._order[2]->isCold() && order._order[3]->isCold()) << "Cold builders visited last";
+
+    // other visitors see the same order whether or not builders are cold
+    BuilderOrderVisitor coldOrder(&c, false);
+    coldOrder.start(func.comp());
+    func._error->setCold(false);
+    func._report->setCold(false);
+    BuilderOrderVisitor plainOrder(&c, false);
+    plainOrder.start(func.comp());
+    EXPECT_EQ(coldOrder._order, plainOrder._order) << "Cold builders only visited last when asked";
+}
+
+TEST(BaseExtension, profileFeedbackFromInstrumentedCounts) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+    Base::FunctionProfile profile;
+
+    ErrorPathFunction instrumented(&c, ext);
+    instrumented.SetProfile(&profile);
+    Strategy *instrument = new Strategy(&c, "ProfileInstrumentation");
+    instrument->addPass(new Base::ProfileInstrumentation(&c));
+    EXPECT_EQ((int)instrumented.Compile(NULL, instrument->id()), (int)c.CompileSuccessful) << "Instrumented ErrorPath ok";
+
+    Builder *entry = instrumented.builderEntry();
+    Operation *ifCmp = NULL;
+    for (OperationIterator opIt = entry->OperationsBegin(); opIt != entry->OperationsEnd(); opIt++) {
+        if ((*opIt)->action() == ext->aIfCmpLessThan)
+            ifCmp = *opIt;
+    }
+    ASSERT_NE(ifCmp, (Operation *)NULL) << "Entry still has its IfCmp";
+    EXPECT_EQ(countActions(entry, ext->aStoreAt), 3) << "Entry counts itself and both directions of its branch";
+    EXPECT_EQ(countActions(instrumented._report, ext->aStoreAt), 1) << "Report builder counted";
+    EXPECT_FALSE(profile.hasData()) << "Counters start at zero";
+
+    // as if the instrumented code had run 10 times, 3 of them along the error path
+    *profile.builderCounter(entry->id()) = 10;
+    *profile.branchCounter(ifCmp->id()) = 10;
+    *profile.branchNotTakenCounter(ifCmp->id()) = 7;
+    *profile.builderCounter(instrumented._error->id()) = 3;
+    *profile.builderCounter(instrumented._ok->id()) = 7;
+    EXPECT_EQ(profile.takenCount(ifCmp->id()), 3) << "Taken count derived from not taken count";
+    EXPECT_EQ((int)profile.takenProbability(ifCmp->id()), 30) << "Branch taken 30% of the time";
+
+    ErrorPathFunction recompiled(&c, ext);
+    recompiled.SetProfile(&profile);
+    Strategy *feedback = new Strategy(&c, "ProfileFeedback");
+    feedback->addPass(new Base::ProfileFeedback(&c));
+    EXPECT_EQ((int)recompiled.Compile(NULL, feedback->id()), (int)c.CompileSuccessful) << "Recompiled ErrorPath ok";
+
+    Builder *newEntry = recompiled.builderEntry();
+    EXPECT_EQ(countActions(newEntry, ext->aStoreAt), 0) << "Recompiled code is not instrumented";
+    for (OperationIterator opIt = newEntry->OperationsBegin(); opIt != newEntry->OperationsEnd(); opIt++) {
+        if ((*opIt)->action() == ext->aIfCmpLessThan)
+            EXPECT_EQ((int)(*opIt)->takenProbability(), 30) << "Measured probability replaces the hint";
+    }
+    EXPECT_FALSE(newEntry->isCold()) << "Entry is not cold";
+    EXPECT_FALSE(recompiled._error->isCold()) << "Error path ran so is not cold";
+    EXPECT_FALSE(recompiled._ok->isCold()) << "Ok path is not cold";
+    EXPECT_TRUE(recompiled._report->isCold()) << "Builder that never ran is cold";
+}
+
+// Test function that returns x, or (x*x + 7) along a cold path when x is negative; the cold path
+// uses x's Value and a local, so both must be passed to it if it is outlined
+BASE_FUNC(ColdTailFunction, "0", "ColdTail.cpp", Builder *_error, \
+    _x, { \
+        DefineReturnType(_x->Int32); \
+        DefineParameter("x", _x->Int32); \
+        DefineLocal("t", _x->Int32); \
+        }, \
+    b, { \
+        _error = _x->OrphanBuilder(LOC, b); \
+        _error->setCold(); \
+        Value *x = _x->Load(LOC, b, LookupLocal("x")); \
+        _x->IfCmpLessThan(LOC, b, _error, x, _x->ConstInt32(LOC, b, 0)); \
+        _x->Return(LOC, b, x); \
+        Value *square = _x->Mul(LOC, _error, x, x); \
+        _x->Store(LOC, _error, LookupLocal("t"), _x->Add(LOC, _error, square, _x->ConstInt32(LOC, _error, 7))); \
+        _x->Return(LOC, _error, _x->Load(LOC, _error, LookupLocal("t"))); \
+        })
+
+TEST(BaseExtension, outlineColdRegion) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+    ColdTailFunction func(&c, ext);
+    func.config()->setOutlineMaxFunctionSize(4);
+    Strategy *strategy = new Strategy(&c, "Outliner");
+    strategy->addPass(new Base::Outliner(&c))
+            ->addPass(new JB1CodeGenerator(&c));
+    EXPECT_EQ((int)func.Compile(NULL, strategy->id()), (int)c.CompileSuccessful) << "Outlined ColdTail ok";
+
+    Builder *entry = func.builderEntry();
+    EXPECT_EQ(countActions(entry, ext->aIfCmpLessThan), 1) << "Entry still branches to the cold path";
+    EXPECT_EQ(countActions(entry, ext->aCall), 0) << "Entry is not outlined";
+
+    ASSERT_EQ(func._error->numOperations(), 3) << "Cold path is a Load, a Call and a Return";
+    Operation *call = func._error->operations()[1];
+    ASSERT_EQ(call->action(), ext->aCall) << "Cold path calls the outlined function";
+    EXPECT_EQ(call->numOperands(), 2) << "Local and live Value passed as arguments";
+    EXPECT_EQ(call->operand(0), func._error->operations()[0]->result()) << "Local's value is the first argument";
+    EXPECT_EQ(call->operand(1), entry->operations()[0]->result()) << "x's Value is the second argument";
+    EXPECT_EQ(func._error->operations()[2]->action(), ext->aReturn) << "Cold path returns the call's result";
+    EXPECT_EQ(func._error->operations()[2]->operand(), call->result()) << "Return uses the call's result";
+    EXPECT_NE(func.LookupFunction(call->symbol()->name()), (Base::FunctionSymbol *)NULL) << "Outlined function declared";
+
+    typedef int32_t (FuncProto)(int32_t);
+    FuncProto *f = func.nativeEntry<FuncProto *>();
+    EXPECT_EQ(f(5), 5) << "Compiled f(5) returns 5 without calling the outlined function";
+    EXPECT_EQ(f(-3), 16) << "Compiled f(-3) returns -3*-3 + 7 from the outlined function";
+}
+
+TEST(BaseExtension, regionWithoutNativeCodeNotOutlined) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+    ColdTailFunction func(&c, ext);
+    func.config()->setOutlineMaxFunctionSize(4);
+    Strategy *outlinedStrategy = new Strategy(&c, "BuildOnly"); // outlined IL is only built
+    Strategy *strategy = new Strategy(&c, "Outliner");
+    strategy->addPass(new Base::Outliner(&c, outlinedStrategy->id()));
+    EXPECT_EQ((int)func.Compile(NULL, strategy->id()), (int)c.CompileSuccessful) << "Compiled ColdTail ok";
+    EXPECT_EQ(countActions(func._error, ext->aCall), 0) << "Cold path is not replaced by a call with no target";
+    EXPECT_EQ(countActions(func._error, ext->aMul), 1) << "Cold path is left in place";
+}
+
+TEST(BaseExtension, smallFunctionNotOutlined) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+    ColdTailFunction func(&c, ext);
+    Strategy *outlinedStrategy = new Strategy(&c, "BuildOnly");
+    Strategy *strategy = new Strategy(&c, "Outliner");
+    strategy->addPass(new Base::Outliner(&c, outlinedStrategy->id()));
+    EXPECT_EQ((int)func.Compile(NULL, strategy->id()), (int)c.CompileSuccessful) << "Compiled ColdTail ok";
+    EXPECT_EQ(countActions(func._error, ext->aCall), 0) << "Function within outlineMaxFunctionSize is unchanged";
+}
+
+TEST(BaseExtension, scalarReplaceLocalStruct) {
+    typedef struct { int32_t f1; int16_t f2; int16_t f3; } TheStructType;
+    typedef int16_t (FuncProto)(TheStructType *);
+    COMPILE_FUNC_WITH_PASS(CreateStruct_Int32_Int16_Int16_Function, FuncProto, f, Base::ScalarReplacement, false);
+    EXPECT_EQ(countActions(func.builderEntry(), ext->aCreateLocalStruct), 0) << "Local struct removed";
+    EXPECT_EQ(countActions(func.builderEntry(), ext->aLoadFieldAt), 1) << "Only the parameter struct's field is loaded from memory";
+    TheStructType str = { 1, 3, 2 };
+    EXPECT_EQ(f(&str), 3) << "Compiled f(&str) returns str.f2";
+}
+
+// Test function that stores x to the Int32 field of a local union and returns its low Int16 field,
+// which shares the Int32's low order bits
+BASE_FUNC(LocalUnionFunction, "0", "LocalUnion.cpp", const Base::StructType *_unionType; const Base::PointerType *_pUnionType, \
+    _x, { \
+        Base::StructTypeBuilder utb(_x, this); \
+        utb.setName("IntOrShort") \
+           ->addField("i", _x->Int32, 0) \
+           ->addField("s", _x->Int16, 0); \
+        _unionType = utb.create(LOC); \
+        _pUnionType = PointerTo(LOC, _unionType); \
+        DefineReturnType(_x->Int16); \
+        DefineParameter("x", _x->Int32); \
+        }, \
+    b, { \
+        Value *pUnion = _x->CreateLocalStruct(LOC, b, _pUnionType); \
+        _x->StoreFieldAt(LOC, b, _unionType->LookupField("i"), pUnion, _x->Load(LOC, b, LookupLocal("x"))); \
+        _x->Return(LOC, b, _x->LoadFieldAt(LOC, b, _unionType->LookupField("s"), pUnion)); \
+        })
+
+TEST(BaseExtension, scalarReplaceSkipsLocalUnion) {
+    typedef int16_t (FuncProto)(int32_t);
+    COMPILE_FUNC_WITH_PASS(LocalUnionFunction, FuncProto, f, Base::ScalarReplacement, false);
+    EXPECT_EQ(countActions(func.builderEntry(), ext->aCreateLocalStruct), 1) << "Local union kept in memory";
+    EXPECT_EQ(countActions(func.builderEntry(), ext->aStoreFieldAt), 1) << "Store to the union kept";
+    int32_t x = 0x12345678;
+    int16_t expected;
+    memcpy(&expected, &x, sizeof(expected));
+    EXPECT_EQ(f(x), expected) << "Compiled f(x) returns the Int16 sharing x's first bytes";
+}
+
+// Test function that stores x, x+1 and 2*x into elements 0, 1 and 3 of a local array of 4 Int32s and
+// returns their sum; if escape is true the array's address is also stored into a local
+#define LOCALARRAYFUNC(name, escape) \
+    BASE_FUNC(name, "0", #name ".cpp", const Base::PointerType *_pInt32, \
+        _x, { \
+            _pInt32 = PointerTo(LOC, _x->Int32); \
+            DefineParameter("x", _x->Int32); \
+            DefineLocal("p", _pInt32); \
+            DefineReturnType(_x->Int32); \
+            }, \
+        b, { \
+            Value *a = _x->CreateLocalArray(LOC, b, _x->Int32->literal(LOC, comp(), 4), _pInt32); \
+            if (escape) _x->Store(LOC, b, LookupLocal("p"), a); \
+            Value *x = _x->Load(LOC, b, LookupLocal("x")); \
+            _x->StoreAt(LOC, b, a, x); \
+            _x->StoreAt(LOC, b, _x->IndexAt(LOC, b, a, _x->ConstInt32(LOC, b, 1)), _x->Add(LOC, b, x, _x->ConstInt32(LOC, b, 1))); \
+            _x->StoreAt(LOC, b, _x->IndexAt(LOC, b, a, _x->ConstInt32(LOC, b, 3)), _x->Mul(LOC, b, x, _x->ConstInt32(LOC, b, 2))); \
+            Value *e0 = _x->LoadAt(LOC, b, a); \
+            Value *e1 = _x->LoadAt(LOC, b, _x->IndexAt(LOC, b, a, _x->ConstInt32(LOC, b, 1))); \
+            Value *e3 = _x->LoadAt(LOC, b, _x->IndexAt(LOC, b, a, _x->ConstInt32(LOC, b, 3))); \
+            _x->Return(LOC, b, _x->Add(LOC, b, _x->Add(LOC, b, e0, e1), e3)); \
+            })
+
+LOCALARRAYFUNC(LocalArrayFunction, false)
+TEST(BaseExtension, scalarReplaceLocalArray) {
+    typedef int32_t (FuncProto)(int32_t);
+    COMPILE_FUNC_WITH_PASS(LocalArrayFunction, FuncProto, f, Base::ScalarReplacement, false);
+    Builder *entry = func.builderEntry();
+    EXPECT_EQ(countActions(entry, ext->aCreateLocalArray), 0) << "Local array removed";
+    EXPECT_EQ(countActions(entry, ext->aIndexAt), 0) << "Element addresses removed";
+    EXPECT_EQ(countActions(entry, ext->aLoadAt) + countActions(entry, ext->aStoreAt), 0) << "Elements accessed as locals";
+    for (int32_t x=-2;x < 3;x++)
+        EXPECT_EQ(f(x), 4*x+1) << "Compiled f(" << x << ") returns " << 4*x+1;
+}
+
+LOCALARRAYFUNC(EscapingArrayFunction, true)
+TEST(BaseExtension, escapingArrayNotScalarReplaced) {
+    Compiler c("testBase");
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>();
+    EscapingArrayFunction func(&c, ext);
+    Strategy *strategy = new Strategy(&c, "ScalarReplacement");
+    strategy->addPass(new Base::ScalarReplacement(&c));
+    EXPECT_EQ((int)func.Compile(NULL, strategy->id()), (int)c.CompileSuccessful) << "Compiled EscapingArray ok";
+    EXPECT_EQ(countActions(func.builderEntry(), ext->aCreateLocalArray), 1) << "Array whose address is stored is kept";
+    EXPECT_EQ(countActions(func.builderEntry(), ext->aStoreAt), 3) << "Elements still stored to memory";
+}
+
+// Test function that stores x+1 into t, 3*t into u (after first storing 2*t) and x into d (never loaded), then
+// adds t into sum n times and returns u + sum
+BASE_FUNC(ForwardLocalsFunction, "0", "ForwardLocalsFunction.cpp", Base::ForLoopBuilder *_loop, \
+    _x, { \
+        DefineReturnType(_x->Int32); \
+        DefineParameter("x", _x->Int32); \
+        DefineParameter("n", _x->Int32); \
+        DefineLocal("t", _x->Int32); \
+        DefineLocal("u", _x->Int32); \
+        DefineLocal("d", _x->Int32); \
+        DefineLocal("i", _x->Int32); \
+        DefineLocal("sum", _x->Int32); \
+        }, \
+    b, { \
+        auto tSym = LookupLocal("t"); \
+        auto uSym = LookupLocal("u"); \
+        auto sumSym = LookupLocal("sum"); \
+        _x->Store(LOC, b, tSym, _x->Add(LOC, b, _x->Load(LOC, b, LookupLocal("x")), _x->ConstInt32(LOC, b, 1))); \
+        _x->Store(LOC, b, LookupLocal("d"), _x->Load(LOC, b, LookupLocal("x"))); \
+        Value *t = _x->Load(LOC, b, tSym); \
+        _x->Store(LOC, b, uSym, _x->Mul(LOC, b, t, _x->ConstInt32(LOC, b, 2))); \
+        _x->Store(LOC, b, uSym, _x->Mul(LOC, b, t, _x->ConstInt32(LOC, b, 3))); \
+        _x->Store(LOC, b, sumSym, _x->ConstInt32(LOC, b, 0)); \
+        _loop = _x->ForLoopUp(LOC, b, LookupLocal("i"), _x->ConstInt32(LOC, b, 0), _x->Load(LOC, b, LookupLocal("n")), _x->ConstInt32(LOC, b, 1)); { \
+            Builder *body = _loop->loopBody(); \
+            _x->Store(LOC, body, sumSym, _x->Add(LOC, body, _x->Load(LOC, body, sumSym), _x->Load(LOC, body, tSym))); \
+        } \
+        _x->Return(LOC, b, _x->Add(LOC, b, _x->Load(LOC, b, uSym), _x->Load(LOC, b, sumSym))); \
+        })
+
+TEST(BaseExtension, forwardStoresToLoadsOfLocals) {
+    typedef int32_t (FuncProto)(int32_t, int32_t);
+    COMPILE_FUNC_WITH_PASS(ForwardLocalsFunction, FuncProto, f, Base::LocalForwarding, false);
+    Builder *entry = func.builderEntry();
+    Builder *body = func._loop->loopBody();
+    EXPECT_EQ(countActions(entry, ext->aLoad), 3) << "Only x, n and sum after the loop loaded in entry";
+    EXPECT_EQ(countActions(body, ext->aLoad), 1) << "Only sum loaded in the loop body";
+    EXPECT_EQ(countActions(entry, ext->aStore), 1) << "Stores to t, u and d removed";
+    EXPECT_EQ(countActions(body, ext->aStore), 1) << "Store to sum kept in the loop body";
+    for (int32_t x=-2;x < 3;x++)
+        EXPECT_EQ(f(x, 4), 7*(x+1)) << "Compiled f(" << x << ", 4) returns " << 7*(x+1);
+}
@@ -0,0 +1,465 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <dlfcn.h>
+#include <limits>
+#include <stdio.h>
+#include <vector>
+#include "gtest/gtest.h"
+#include "Compiler.hpp"
+#include "Base/BaseExtension.hpp"
+#include "Base/Function.hpp"
+#include "Base/FunctionCompilation.hpp"
+#include "JB1CodeGenerator.hpp"
+#include "Operation.hpp"
+#include "Strategy.hpp"
+#include "TextWriter.hpp"
+#include "Value.hpp"
+#include "Vector/LoopVectorizer.hpp"
+#include "Vector/VectorExtension.hpp"
+#include "Vector/VectorLowering.hpp"
+#include "Vector/VectorTypes.hpp"
+
+
+using namespace OMR::JitBuilder;
+
+int main(int argc, char** argv) {
+    void *handle = dlopen("libjbcore.so", RTLD_LAZY);
+    if (!handle) {
+        fputs(dlerror(), stderr);
+        return -1;
+    }
+
+    // see testBase.cpp: one Compiler for the whole run means the JIT is initialized only once
+    Compiler c("Global");
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+static int32_t
+countActions(Builder *b, ActionID a) {
+    int32_t count = 0;
+    for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+        if ((*opIt)->action() == a)
+            count++;
+    }
+    return count;
+}
+
+static int32_t
+countVectorActions(Builder *b, Vector::VectorExtension *vec) {
+    ActionID actions[] = { vec->aVectorAdd, vec->aVectorSub, vec->aVectorMul, vec->aVectorLoadAt, vec->aVectorStoreAt,
+                           vec->aVectorBroadcast, vec->aVectorShuffle, vec->aVectorReduceAdd, vec->aVectorReduceMul };
+    int32_t count = 0;
+    for (size_t a=0;a < sizeof(actions)/sizeof(actions[0]);a++)
+        count += countActions(b, actions[a]);
+    return count;
+}
+
+#define VECTOR_FUNC(name,line,file,fields,xtor_code,entry,il_code) \
+    class name : public Base::Function { \
+    protected: \
+        Base::BaseExtension *_x; \
+        Vector::VectorExtension *_vec; \
+    public: \
+        name(Compiler *c, Base::BaseExtension *x, Vector::VectorExtension *v) : Base::Function(c), _x(x), _vec(v) { \
+            DefineName(#name); \
+            DefineLine(line); \
+            DefineFile(file); \
+            xtor_code \
+	    } \
+        virtual bool buildIL() { \
+            Builder *entry = builderEntry(); \
+            il_code \
+            return true; \
+        } \
+        fields; \
+    };
+
+#define LOAD_VECTOR_EXTENSION \
+    Compiler c("testVector"); \
+    Base::BaseExtension *ext = c.loadExtension<Base::BaseExtension>(); \
+    Vector::VectorExtension *vec = c.loadExtension<Vector::VectorExtension>(); \
+    assert(vec)
+
+// builds FuncClass's IL without lowering it: JB1 cannot generate code for vector operations,
+// so the IL is only checked to contain the vector operation with a result of a vector Type
+#define BUILD_FUNC_WITHOUT_LOWERING(FuncClass, expectedAction) { \
+    LOAD_VECTOR_EXTENSION; \
+    FuncClass func(&c, ext, vec); \
+    Strategy *strategy = new Strategy(&c, "BuildOnly"); \
+    EXPECT_EQ((int)func.Compile(NULL, strategy->id()), (int)c.CompileSuccessful) << "Built " #FuncClass " ok"; \
+    Builder *entry = func.builderEntry(); \
+    EXPECT_EQ(countActions(entry, vec->expectedAction), 1) << #FuncClass " has a " #expectedAction; \
+    for (OperationIterator opIt = entry->OperationsBegin(); opIt != entry->OperationsEnd(); opIt++) { \
+        Operation *op = *opIt; \
+        if (op->action() == vec->aVectorLoadAt || op->action() == vec->aVectorBroadcast || op->action() == vec->aVectorShuffle) \
+            EXPECT_TRUE(op->result()->type()->isKind<Vector::VectorType>()) << #FuncClass " produces a vector Value"; \
+    } \
+    }
+
+// compiles FuncClass with VectorLowering and JB1CodeGenerator, checks no vector operations are
+// left, and makes its native entry point available as f
+#define COMPILE_FUNC_WITH_LOWERING(FuncClass, FuncProto, f, DO_LOGGING) \
+    LOAD_VECTOR_EXTENSION; \
+    FuncClass func(&c, ext, vec); \
+    Base::FunctionCompilation *comp = func.comp(); \
+    TextWriter logger(comp, std::cout, std::string("    ")); \
+    TextWriter *log = (DO_LOGGING) ? &logger : NULL; \
+    Strategy *strategy = new Strategy(&c, "VectorLowering"); \
+    strategy->addPass(new Vector::VectorLowering(&c)) \
+            ->addPass(new JB1CodeGenerator(&c)); \
+    CompilerReturnCode result = func.Compile(log, strategy->id()); \
+    EXPECT_EQ((int)result, (int)c.CompileSuccessful) << "Compiled function ok"; \
+    EXPECT_EQ(countVectorActions(func.builderEntry(), vec), 0) << "Vector operations lowered"; \
+    FuncProto *f = func.nativeEntry<FuncProto *>(); \
+    assert(f)
+
+TEST(VectorExtension, loadExtension) {
+    LOAD_VECTOR_EXTENSION;
+    EXPECT_TRUE(vec != NULL) << "Vector extension loaded";
+    EXPECT_EQ(vec->VectorTypeFor(ext->Int32), vec->Int32x4) << "Int32 lanes make an Int32x4";
+    EXPECT_EQ(vec->VectorTypeFor(ext->Address), (const Vector::VectorType *)NULL) << "No vector of Address";
+}
+
+// Test function that computes c[0..lanes-1] = a[0..lanes-1] op b[0..lanes-1]
+#define LANEWISEFUNC(name, elementType, vectorType, op) \
+    VECTOR_FUNC(name, "0", #name ".cpp", , { \
+            DefineReturnType(_x->NoType); \
+            DefineParameter("a", PointerTo(LOC, _x->elementType)); \
+            DefineParameter("b", PointerTo(LOC, _x->elementType)); \
+            DefineParameter("c", PointerTo(LOC, _x->elementType)); \
+            }, \
+        b, { \
+            Value *va = _vec->VectorLoadAt(LOC, b, _vec->vectorType, _x->Load(LOC, b, LookupLocal("a"))); \
+            Value *vb = _vec->VectorLoadAt(LOC, b, _vec->vectorType, _x->Load(LOC, b, LookupLocal("b"))); \
+            _vec->VectorStoreAt(LOC, b, _x->Load(LOC, b, LookupLocal("c")), _vec->op(LOC, b, va, vb)); \
+            _x->Return(LOC, b); \
+            })
+
+#define TESTLANEWISE(name, ctype, numLanes, expectedAction, expr) \
+    TEST(VectorExtension, name) { \
+        typedef void (FuncProto)(ctype *, ctype *, ctype *); \
+        BUILD_FUNC_WITHOUT_LOWERING(name##Function, expectedAction); \
+        COMPILE_FUNC_WITH_LOWERING(name##Function, FuncProto, f, false); \
+        ctype left[numLanes], right[numLanes], out[numLanes+1]; \
+        for (int32_t l=0;l < numLanes;l++) { \
+            left[l] = (ctype)(3*l + 1); \
+            right[l] = (ctype)(l - 2); \
+        } \
+        out[numLanes] = (ctype) 99; \
+        f(left, right, out); \
+        for (int32_t l=0;l < numLanes;l++) \
+            EXPECT_EQ(out[l], (ctype)(expr)) << #name " lane " << l; \
+        EXPECT_EQ(out[numLanes], (ctype) 99) << #name " stores only " #numLanes " lanes"; \
+    }
+
+LANEWISEFUNC(VectorAddInt32x4Function, Int32, Int32x4, VectorAdd)
+TESTLANEWISE(VectorAddInt32x4, int32_t, 4, aVectorAdd, left[l] + right[l])
+LANEWISEFUNC(VectorSubInt32x4Function, Int32, Int32x4, VectorSub)
+TESTLANEWISE(VectorSubInt32x4, int32_t, 4, aVectorSub, left[l] - right[l])
+LANEWISEFUNC(VectorMulInt32x4Function, Int32, Int32x4, VectorMul)
+TESTLANEWISE(VectorMulInt32x4, int32_t, 4, aVectorMul, left[l] * right[l])
+LANEWISEFUNC(VectorAddInt16x8Function, Int16, Int16x8, VectorAdd)
+TESTLANEWISE(VectorAddInt16x8, int16_t, 8, aVectorAdd, left[l] + right[l])
+LANEWISEFUNC(VectorMulFloat64x2Function, Float64, Float64x2, VectorMul)
+TESTLANEWISE(VectorMulFloat64x2, double, 2, aVectorMul, left[l] * right[l])
+
+// Test function that copies 4 Int32s from a to c through a vector
+VECTOR_FUNC(VectorCopyFunction, "0", "VectorCopy.cpp", , {
+        DefineReturnType(_x->NoType);
+        DefineParameter("a", PointerTo(LOC, _x->Int32));
+        DefineParameter("c", PointerTo(LOC, _x->Int32));
+        },
+    b, {
+        Value *v = _vec->VectorLoadAt(LOC, b, _vec->Int32x4, _x->Load(LOC, b, LookupLocal("a")));
+        _vec->VectorStoreAt(LOC, b, _x->Load(LOC, b, LookupLocal("c")), v);
+        _x->Return(LOC, b);
+        })
+
+TEST(VectorExtension, VectorLoadAtStoreAt) {
+    typedef void (FuncProto)(int32_t *, int32_t *);
+    BUILD_FUNC_WITHOUT_LOWERING(VectorCopyFunction, aVectorStoreAt);
+    COMPILE_FUNC_WITH_LOWERING(VectorCopyFunction, FuncProto, f, false);
+    int32_t in[5] = { 5, -6, 7, -8, 9 };
+    int32_t out[5] = { 0, 0, 0, 0, 0 };
+    f(in, out);
+    for (int32_t l=0;l < 4;l++)
+        EXPECT_EQ(out[l], in[l]) << "Lane " << l << " copied";
+    EXPECT_EQ(out[4], 0) << "Only 4 lanes copied";
+}
+
+// Test function that stores x into every lane of c
+VECTOR_FUNC(VectorBroadcastFunction, "0", "VectorBroadcast.cpp", , {
+        DefineReturnType(_x->NoType);
+        DefineParameter("x", _x->Int64);
+        DefineParameter("c", PointerTo(LOC, _x->Int64));
+        },
+    b, {
+        Value *v = _vec->VectorBroadcast(LOC, b, _vec->Int64x2, _x->Load(LOC, b, LookupLocal("x")));
+        _vec->VectorStoreAt(LOC, b, _x->Load(LOC, b, LookupLocal("c")), v);
+        _x->Return(LOC, b);
+        })
+
+TEST(VectorExtension, VectorBroadcast) {
+    typedef void (FuncProto)(int64_t, int64_t *);
+    BUILD_FUNC_WITHOUT_LOWERING(VectorBroadcastFunction, aVectorBroadcast);
+    COMPILE_FUNC_WITH_LOWERING(VectorBroadcastFunction, FuncProto, f, false);
+    int64_t out[2] = { 0, 0 };
+    f(-3, out);
+    EXPECT_EQ(out[0], -3) << "Lane 0 is x";
+    EXPECT_EQ(out[1], -3) << "Lane 1 is x";
+}
+
+// Test function that reverses the lanes of a into c, keeping the vector in a local in between
+VECTOR_FUNC(VectorShuffleFunction, "0", "VectorShuffle.cpp", , {
+        DefineReturnType(_x->NoType);
+        DefineParameter("a", PointerTo(LOC, _x->Int32));
+        DefineParameter("c", PointerTo(LOC, _x->Int32));
+        DefineLocal("v", _vec->Int32x4);
+        },
+    b, {
+        std::vector<int32_t> reverse;
+        for (int32_t l=3;l >= 0;l--)
+            reverse.push_back(l);
+        Value *v = _vec->VectorLoadAt(LOC, b, _vec->Int32x4, _x->Load(LOC, b, LookupLocal("a")));
+        _x->Store(LOC, b, LookupLocal("v"), _vec->VectorShuffle(LOC, b, v, reverse));
+        _vec->VectorStoreAt(LOC, b, _x->Load(LOC, b, LookupLocal("c")), _x->Load(LOC, b, LookupLocal("v")));
+        _x->Return(LOC, b);
+        })
+
+TEST(VectorExtension, VectorShuffle) {
+    typedef void (FuncProto)(int32_t *, int32_t *);
+    BUILD_FUNC_WITHOUT_LOWERING(VectorShuffleFunction, aVectorShuffle);
+    COMPILE_FUNC_WITH_LOWERING(VectorShuffleFunction, FuncProto, f, false);
+    int32_t in[4] = { 1, 2, 3, 4 };
+    int32_t out[4] = { 0, 0, 0, 0 };
+    f(in, out);
+    for (int32_t l=0;l < 4;l++)
+        EXPECT_EQ(out[l], in[3-l]) << "Lane " << l << " comes from lane " << 3-l;
+}
+
+// Test function that returns the sum (or product) of the lanes of a
+#define REDUCEFUNC(name, elementType, vectorType, op) \
+    VECTOR_FUNC(name, "0", #name ".cpp", , { \
+            DefineReturnType(_x->elementType); \
+            DefineParameter("a", PointerTo(LOC, _x->elementType)); \
+            }, \
+        b, { \
+            Value *v = _vec->VectorLoadAt(LOC, b, _vec->vectorType, _x->Load(LOC, b, LookupLocal("a"))); \
+            _x->Return(LOC, b, _vec->op(LOC, b, v)); \
+            })
+
+REDUCEFUNC(VectorReduceAddFunction, Int32, Int32x4, VectorReduceAdd)
+TEST(VectorExtension, VectorReduceAdd) {
+    typedef int32_t (FuncProto)(int32_t *);
+    BUILD_FUNC_WITHOUT_LOWERING(VectorReduceAddFunction, aVectorReduceAdd);
+    COMPILE_FUNC_WITH_LOWERING(VectorReduceAddFunction, FuncProto, f, false);
+    int32_t in[4] = { 1, -2, 30, 400 };
+    EXPECT_EQ(f(in), 1-2+30+400) << "Lanes summed";
+}
+
+REDUCEFUNC(VectorReduceMulFunction, Float32, Float32x4, VectorReduceMul)
+TEST(VectorExtension, VectorReduceMul) {
+    typedef float (FuncProto)(float *);
+    BUILD_FUNC_WITHOUT_LOWERING(VectorReduceMulFunction, aVectorReduceMul);
+    COMPILE_FUNC_WITH_LOWERING(VectorReduceMulFunction, FuncProto, f, false);
+    float in[4] = { 1.5, -2.0, 4.0, 0.5 };
+    EXPECT_EQ(f(in), (float)(1.5*-2.0*4.0*0.5)) << "Lanes multiplied";
+}
+
+// Test function that adds vectors of different Types, which cannot be built
+VECTOR_FUNC(VectorAddMismatchFunction, "0", "VectorAddMismatch.cpp", , {
+        DefineReturnType(_x->NoType);
+        DefineParameter("a", PointerTo(LOC, _x->Int32));
+        DefineParameter("f", PointerTo(LOC, _x->Float32));
+        },
+    b, {
+        Value *va = _vec->VectorLoadAt(LOC, b, _vec->Int32x4, _x->Load(LOC, b, LookupLocal("a")));
+        Value *vf = _vec->VectorLoadAt(LOC, b, _vec->Float32x4, _x->Load(LOC, b, LookupLocal("f")));
+        _vec->VectorAdd(LOC, b, va, vf);
+        _x->Return(LOC, b);
+        })
+
+TEST(VectorExtension, VectorAddMismatchedTypesFails) {
+    LOAD_VECTOR_EXTENSION;
+    VectorAddMismatchFunction func(&c, ext, vec);
+    Strategy *strategy = new Strategy(&c, "BuildOnly");
+    EXPECT_EQ((int)func.Compile(NULL, strategy->id()), (int)vec->CompileFail_BadInputTypes_VectorAdd) << "VectorAdd of Int32x4 and Float32x4 fails";
+}
+
+// Test function with a vector parameter, which VectorLowering cannot lower
+VECTOR_FUNC(VectorParameterFunction, "0", "VectorParameter.cpp", , {
+        DefineReturnType(_x->NoType);
+        DefineParameter("v", _vec->Int32x4);
+        DefineParameter("a", PointerTo(LOC, _x->Int32));
+        },
+    b, {
+        _vec->VectorStoreAt(LOC, b, _x->Load(LOC, b, LookupLocal("a")), _x->Load(LOC, b, LookupLocal("v")));
+        _x->Return(LOC, b);
+        })
+
+TEST(VectorExtension, VectorParameterCannotBeLowered) {
+    LOAD_VECTOR_EXTENSION;
+    VectorParameterFunction func(&c, ext, vec);
+    Strategy *strategy = new Strategy(&c, "VectorLowering");
+    strategy->addPass(new Vector::VectorLowering(&c));
+    EXPECT_EQ((int)func.Compile(NULL, strategy->id()), (int)vec->CompileFail_VectorValueCannotBeLowered) << "Vector parameter fails lowering";
+}
+
+// counts operations with action a in b and in the builders bound to its operations
+static int32_t
+countNestedActions(Builder *b, ActionID a) {
+    int32_t count = 0;
+    for (OperationIterator opIt = b->OperationsBegin(); opIt != b->OperationsEnd(); opIt++) {
+        Operation *op = *opIt;
+        if (op->action() == a)
+            count++;
+        for (int32_t i=0;i < op->numBuilders();i++) {
+            Builder *inner = op->builder(i);
+            if (inner != NULL && inner->isBound() && inner->boundToOperation() == op)
+                count += countNestedActions(inner, a);
+        }
+    }
+    return count;
+}
+
+// compiles FuncClass with LoopVectorizer, VectorLowering and JB1CodeGenerator
+#define COMPILE_FUNC_WITH_VECTORIZER(FuncClass, FuncProto, f, DO_LOGGING) \
+    LOAD_VECTOR_EXTENSION; \
+    FuncClass func(&c, ext, vec); \
+    Base::FunctionCompilation *comp = func.comp(); \
+    TextWriter logger(comp, std::cout, std::string("    ")); \
+    TextWriter *log = (DO_LOGGING) ? &logger : NULL; \
+    Strategy *strategy = new Strategy(&c, "LoopVectorizer"); \
+    strategy->addPass(new Vector::LoopVectorizer(&c)) \
+            ->addPass(new Vector::VectorLowering(&c)) \
+            ->addPass(new JB1CodeGenerator(&c)); \
+    CompilerReturnCode result = func.Compile(log, strategy->id()); \
+    EXPECT_EQ((int)result, (int)c.CompileSuccessful) << "Compiled function ok"; \
+    FuncProto *f = func.nativeEntry<FuncProto *>(); \
+    assert(f)
+
+// runs only LoopVectorizer on FuncClass and checks that it created the vector operation
+#define VECTORIZE_FUNC_WITHOUT_LOWERING(FuncClass, expectedAction) { \
+    LOAD_VECTOR_EXTENSION; \
+    FuncClass func(&c, ext, vec); \
+    Strategy *strategy = new Strategy(&c, "LoopVectorizer"); \
+    strategy->addPass(new Vector::LoopVectorizer(&c)); \
+    EXPECT_EQ((int)func.Compile(NULL, strategy->id()), (int)c.CompileSuccessful) << "Vectorized " #FuncClass " ok"; \
+    EXPECT_GT(countNestedActions(func.builderEntry(), vec->expectedAction), 0) << #FuncClass " loop vectorized with " #expectedAction; \
+    }
+
+// Test function that computes c[i] = a[i] + b[i] for i from 0 up to n
+VECTOR_FUNC(AddArraysFunction, "0", "AddArrays.cpp", , {
+        DefineReturnType(_x->NoType);
+        DefineParameter("a", PointerTo(LOC, _x->Int32));
+        DefineParameter("b", PointerTo(LOC, _x->Int32));
+        DefineParameter("c", PointerTo(LOC, _x->Int32));
+        DefineParameter("n", _x->Int32);
+        DefineLocal("i", _x->Int32);
+        },
+    b, {
+        auto iSym = LookupLocal("i");
+        Base::ForLoopBuilder *loop = _x->ForLoopUp(LOC, b, iSym, _x->ConstInt32(LOC, b, 0), _x->Load(LOC, b, LookupLocal("n")), _x->ConstInt32(LOC, b, 1)); {
+            Builder *body = loop->loopBody();
+            Value *i = _x->Load(LOC, body, iSym);
+            Value *ai = _x->LoadAt(LOC, body, _x->IndexAt(LOC, body, _x->Load(LOC, body, LookupLocal("a")), i));
+            Value *bi = _x->LoadAt(LOC, body, _x->IndexAt(LOC, body, _x->Load(LOC, body, LookupLocal("b")), i));
+            _x->StoreAt(LOC, body, _x->IndexAt(LOC, body, _x->Load(LOC, body, LookupLocal("c")), i), _x->Add(LOC, body, ai, bi));
+        }
+        _x->Return(LOC, b);
+        })
+
+TEST(LoopVectorizer, vectorizeAddArrays) {
+    typedef void (FuncProto)(int32_t *, int32_t *, int32_t *, int32_t);
+    VECTORIZE_FUNC_WITHOUT_LOWERING(AddArraysFunction, aVectorAdd);
+    COMPILE_FUNC_WITH_VECTORIZER(AddArraysFunction, FuncProto, f, false);
+
+    // fewer than, exactly, and not a multiple of the 4 lanes of an Int32x4
+    for (int32_t n=0;n <= 17;n++) {
+        int32_t left[18], right[18], out[18];
+        for (int32_t e=0;e < 18;e++) {
+            left[e] = e;
+            right[e] = 100*e;
+            out[e] = -1;
+        }
+        f(left, right, out, n);
+        for (int32_t e=0;e < n;e++)
+            EXPECT_EQ(out[e], 101*e) << "n=" << n << ": out[" << e << "] is left+right";
+        for (int32_t e=n;e < 18;e++)
+            EXPECT_EQ(out[e], -1) << "n=" << n << ": out[" << e << "] not stored";
+    }
+}
+
+TEST(LoopVectorizer, overlappingArraysRunOriginalLoop) {
+    typedef void (FuncProto)(int32_t *, int32_t *, int32_t *, int32_t);
+    COMPILE_FUNC_WITH_VECTORIZER(AddArraysFunction, FuncProto, f, false);
+
+    // c is a shifted by one (or far enough to be disjoint): the result must match a scalar loop
+    int32_t shifts[] = { 1, 2, 3, -1, 32 };
+    for (size_t s=0;s < sizeof(shifts)/sizeof(shifts[0]);s++) {
+        int32_t shift = shifts[s];
+        for (int32_t n=0;n <= 13;n++) {
+            int32_t data[64], expected[64], right[16];
+            for (int32_t e=0;e < 64;e++)
+                data[e] = expected[e] = e + 1;
+            for (int32_t e=0;e < 16;e++)
+                right[e] = 10*e;
+            int32_t *a = data + 8;
+            for (int32_t e=0;e < n;e++)
+                expected[8 + shift + e] = expected[8 + e] + right[e];
+
+            f(a, right, a + shift, n);
+            for (int32_t e=0;e < 64;e++)
+                EXPECT_EQ(data[e], expected[e]) << "shift " << shift << " n=" << n << ": element " << e;
+        }
+    }
+}
+
+// Test function that counts the iterations of a loop from "from" up to "to" in a reduction
+VECTOR_FUNC(CountReductionFunction, "0", "CountReduction.cpp", , {
+        DefineReturnType(_x->Int32);
+        DefineParameter("from", _x->Int32);
+        DefineParameter("to", _x->Int32);
+        DefineLocal("i", _x->Int32);
+        DefineLocal("count", _x->Int32);
+        },
+    b, {
+        auto countSym = LookupLocal("count");
+        _x->Store(LOC, b, countSym, _x->ConstInt32(LOC, b, 0));
+        Base::ForLoopBuilder *loop = _x->ForLoopUp(LOC, b, LookupLocal("i"), _x->Load(LOC, b, LookupLocal("from")), _x->Load(LOC, b, LookupLocal("to")), _x->ConstInt32(LOC, b, 1)); {
+            Builder *body = loop->loopBody();
+            _x->Store(LOC, body, countSym, _x->Add(LOC, body, _x->Load(LOC, body, countSym), _x->ConstInt32(LOC, body, 1)));
+        }
+        _x->Return(LOC, b, _x->Load(LOC, b, countSym));
+        })
+
+TEST(LoopVectorizer, vectorizeReductionNearMinimum) {
+    typedef int32_t (FuncProto)(int32_t, int32_t);
+    VECTORIZE_FUNC_WITHOUT_LOWERING(CountReductionFunction, aVectorReduceAdd);
+    COMPILE_FUNC_WITH_VECTORIZER(CountReductionFunction, FuncProto, f, false);
+    int32_t min = std::numeric_limits<int32_t>::min();
+    for (int32_t n=0;n < 10;n++) {
+        EXPECT_EQ(f(min, min+n), n) << "Compiled f(min, min+" << n << ") runs " << n << " iterations";
+        EXPECT_EQ(f(-n, n), 2*n) << "Compiled f(" << -n << ", " << n << ") runs " << 2*n << " iterations";
+    }
+}
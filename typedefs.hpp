@@ -23,6 +23,7 @@
 #define TYPEDEFS_INCL
 
 #include <deque>
+#include <utility>
 #include <vector>
 #include "IDs.hpp"
 
@@ -32,6 +33,8 @@ namespace JitBuilder {
 class Builder;
 typedef std::vector<Builder *> BuilderVector;
 typedef std::deque<Builder *> BuilderWorklist;
+typedef std::pair<Builder *,Builder *> ControlFlowEdge; // from, to
+typedef std::vector<ControlFlowEdge> ControlFlowEdgeVector;
 
 typedef uint8_t LiteralBytes;
 class Literal;